@@ -1016,15 +1016,7 @@ namespace approaching_emergency_vehicle_plugin
   {
     double speed_limit = config_.default_speed_limit;
 
-    lanelet::Optional<carma_wm::TrafficRulesConstPtr> traffic_rules = wm_->getTrafficRules();
-    if (traffic_rules)
-    {
-      speed_limit =(*traffic_rules)->speedLimit(lanelet).speedLimit.value();
-    }
-    else
-    {
-      throw std::invalid_argument("No speed limit could be found since valid traffic rules object could not be built");
-    }
+    speed_limit = wm_->getSpeedLimit(lanelet);
     
     return speed_limit;
   }
@@ -23,9 +23,6 @@
 #include <carma_wm/WorldModel.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <geometry_msgs/msg/twist_stamped.hpp>
-#include <tf2_ros/transform_listener.h>
-#include <tf2/LinearMath/Transform.h>
-#include <tf2_geometry_msgs/tf2_geometry_msgs.h>
 
 #include "vehicle_state.hpp"
 #include "arbitrator_state_machine.hpp"
@@ -68,8 +65,7 @@ namespace arbitrator
                 capabilities_interface_(ci),
                 planning_strategy_(planning_strategy),
                 initialized_(false),
-                wm_(wm),
-                tf2_buffer_(nh_->get_clock()) {};
+                wm_(wm) {};
 
             /**
              * \brief Begin the operation of the arbitrator.
@@ -85,14 +81,10 @@ namespace arbitrator
             void twist_cb(geometry_msgs::msg::TwistStamped::UniquePtr msg);
 
             /**
-             * \brief Callback for the front bumper pose transform
+             * \brief Callback for the front bumper pose subscriber, which will update the vehicle state position, downtrack and lane
+             * \param msg Latest pose of the front bumper in the map frame
              */
-            void bumper_pose_cb();
-
-            /**
-             * \brief Initialize transform Lookup from front bumper to map
-             */
-            void initializeBumperTransformLookup();
+            void bumper_pose_cb(geometry_msgs::msg::PoseStamped::UniquePtr msg);
 
         protected:
             /**
@@ -143,13 +135,6 @@ namespace arbitrator
             std::shared_ptr<PlanningStrategy> planning_strategy_;
             bool initialized_;
             carma_wm::WorldModelConstPtr wm_;
-
-            geometry_msgs::msg::TransformStamped tf_;
-            // TF listenser
-            tf2_ros::Buffer tf2_buffer_;
-            std::unique_ptr<tf2_ros::TransformListener> tf2_listener_;
-            // transform from front bumper to map
-            tf2::Stamped<tf2::Transform> bumper_transform_;
             bool planning_in_progress_ = false;
     };
 }
@@ -64,13 +64,13 @@ namespace arbitrator
             // helper function to parse plugin_priorities param from yaml as a json
             std::map<std::string, double> plugin_priorities_map_from_json(const std::string& json_string);
             carma_ros2_utils::SubPtr<geometry_msgs::msg::TwistStamped> twist_sub_;
+            carma_ros2_utils::SubPtr<geometry_msgs::msg::PoseStamped> bumper_pose_sub_;
             
             Config config_;
              // wm listener pointer and pointer to the actual wm object
             std::shared_ptr<carma_wm::WMListener> wm_listener_;
             carma_wm::WorldModelConstPtr wm_;
             std::shared_ptr<Arbitrator> arbitrator_;
-            rclcpp::TimerBase::SharedPtr bumper_pose_timer_;
             rclcpp::TimerBase::SharedPtr arbitrator_run_;
 
     };
@@ -167,21 +167,11 @@ namespace arbitrator
         rclcpp::shutdown(); // Will stop upper level spin and shutdown node
     }
 
-    void Arbitrator::bumper_pose_cb()
+    void Arbitrator::bumper_pose_cb(geometry_msgs::msg::PoseStamped::UniquePtr msg)
     {
-        try
-        {
-            tf_ = tf2_buffer_.lookupTransform("map", "vehicle_front", rclcpp::Time(0), rclcpp::Duration(1.0, 0)); //save to local copy of transform 1 sec timeout
-            tf2::fromMsg(tf_, bumper_transform_);
-            vehicle_state_.stamp = tf_.header.stamp;
-        }
-        catch (const tf2::TransformException &ex)
-        {
-            RCLCPP_WARN_STREAM(nh_->get_logger(), ex.what());
-        }
-
-        vehicle_state_.x = bumper_transform_.getOrigin().getX();
-        vehicle_state_.y = bumper_transform_.getOrigin().getY();
+        vehicle_state_.stamp = msg->header.stamp;
+        vehicle_state_.x = msg->pose.position.x;
+        vehicle_state_.y = msg->pose.position.y;
 
         // If the route is available then set the downtrack and lane id
         if (wm_->getRoute()) {
@@ -207,10 +197,4 @@ namespace arbitrator
     {
         vehicle_state_.velocity = msg->twist.linear.x;
     }
-
-    void Arbitrator::initializeBumperTransformLookup()
-    {
-        tf2_listener_.reset(new tf2_ros::TransformListener(tf2_buffer_));
-        tf2_buffer_.setUsingDedicatedThread(true);
-    }
 }
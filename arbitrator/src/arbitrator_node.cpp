@@ -87,18 +87,13 @@ namespace arbitrator
 
 
         twist_sub_ = create_subscription<geometry_msgs::msg::TwistStamped>("current_velocity", 1, std::bind(&Arbitrator::twist_cb, arbitrator_.get(), std::placeholders::_1));
-
-        arbitrator_->initializeBumperTransformLookup();
+        bumper_pose_sub_ = create_subscription<geometry_msgs::msg::PoseStamped>("front_bumper_pose", 1, std::bind(&Arbitrator::bumper_pose_cb, arbitrator_.get(), std::placeholders::_1));
 
         return CallbackReturn::SUCCESS;
     }
 
     carma_ros2_utils::CallbackReturn ArbitratorNode::handle_on_activate(const rclcpp_lifecycle::State &)
     {
-        bumper_pose_timer_ = create_timer(get_clock(),
-                                std::chrono::milliseconds(100),
-                                [this]() {this->arbitrator_->bumper_pose_cb();});
-
         arbitrator_run_ = create_timer(get_clock(),
                                 std::chrono::duration<double>(1/(config_.planning_frequency * 2 )), //there is waiting state between each planning state
                                 [this]() {this->arbitrator_->run();});
@@ -61,12 +61,29 @@ namespace basic_autonomy
     {
         static const std::string BASIC_AUTONOMY_LOGGER = "basic_autonomy";
 
+        //! Consecutive trajectory points closer than this in meters are at the same position, which marks a terminal hold
+        constexpr double HOLD_POSITION_EPSILON = 0.001;
+
         struct PointSpeedPair
         {
             lanelet::BasicPoint2d point;
             double speed = 0;
         };
 
+        /**
+         * \brief A stop at the end of the planned motion of a trajectory which is held for a fixed duration.
+         *        In a trajectory plan a terminal hold is encoded as a point at the same position as the stop point
+         *        whose target_time is the end of the hold. The hold is a single point regardless of its duration.
+         *        Points after the hold point, if any, keep the path beyond the stop so controllers can still steer
+         *        along it, but are not driven.
+         */
+        struct TerminalHold
+        {
+            size_t stop_index = 0;             // Index of the stop point in the trajectory. The hold point follows it.
+            lanelet::BasicPoint2d position;    // Position the vehicle holds at
+            double duration = 0.0;             // Duration of the hold in seconds
+        };
+
         struct GeneralTrajConfig
         {
             std::string trajectory_type = "inlanecruising";
@@ -90,6 +107,34 @@ namespace basic_autonomy
             std::string desired_controller_plugin = "default"; //The desired controller plugin for the generated trajectory
         };
 
+        /**
+         * \brief Working buffers reused across calls to compose_lanefollow_trajectory_from_path.
+         *        The buffers keep their capacity between calls, so a plugin which keeps one workspace and passes it to every call
+         *        stops reallocating the intermediate point, speed and curvature lists once they have grown to the size of its plans.
+         *        A workspace must not be shared by concurrent calls.
+         */
+        struct TrajectoryWorkspace
+        {
+            std::vector<PointSpeedPair> time_bound_points;
+            std::vector<PointSpeedPair> back_and_future;
+            std::vector<lanelet::BasicPoint2d> curve_points;
+            std::vector<lanelet::BasicPoint2d> sampling_points;
+            std::vector<double> speeds;
+            std::vector<double> downtracks;
+            std::vector<double> distributed_speed_limits;
+            std::vector<double> raw_curvatures;
+            std::vector<double> curvatures;
+            std::vector<double> constrained_speed_limits;
+
+            size_t calls = 0;            // Number of trajectories composed with this workspace
+            size_t allocating_calls = 0; // Number of those calls which had to grow at least one buffer
+
+            /**
+             * \brief Returns the memory currently reserved by the buffers in bytes
+             */
+            size_t capacity_bytes() const;
+        };
+
 
        /**
         * \brief Applies the provided speed limits to the provided speeds such that each element is capped at its corresponding speed limit if needed
@@ -99,7 +144,16 @@ namespace basic_autonomy
         *
         * \return The capped speed limits. Has the same size as speeds
         */
-        std::vector<double> apply_speed_limits(const std::vector<double> speeds, const std::vector<double> speed_limits);
+        std::vector<double> apply_speed_limits(const std::vector<double>& speeds, const std::vector<double>& speed_limits);
+
+       /**
+        * \brief Overload: Writes the capped speeds to the provided output so its storage can be reused
+        *
+        * \param speeds The speeds to limit
+        * \param speed_limits The speed limits to apply. Must have the same size as speeds
+        * \param out The capped speed limits. Existing contents are replaced
+        */
+        void apply_speed_limits(const std::vector<double>& speeds, const std::vector<double>& speed_limits, std::vector<double>* out);
 
        /**
         * \brief Returns a 2D coordinate frame which is located at p1 and oriented so p2 lies on the +X axis
@@ -121,6 +175,15 @@ namespace basic_autonomy
         */
         std::vector<PointSpeedPair> constrain_to_time_boundary(const std::vector<PointSpeedPair> &points, double time_span);
 
+       /**
+        * \brief Overload: Reduces the input points in place, using the workspace point, speed and downtrack buffers as scratch space
+        *
+        * \param points The point speed pairs to reduce. Only the points that fit within time_span are kept
+        * \param time_span The time span in seconds which the output points will fit within
+        * \param workspace Buffers used for intermediate values
+        */
+        void constrain_to_time_boundary(std::vector<PointSpeedPair>* points, double time_span, TrajectoryWorkspace& workspace);
+
        /**
         * \brief Returns the min, and its idx, from the vector of values, excluding given set of values
         * \param values vector of values
@@ -172,6 +235,18 @@ namespace basic_autonomy
         std::vector<PointSpeedPair> attach_past_points(const std::vector<PointSpeedPair> &points_set, std::vector<PointSpeedPair> future_points,
                                                        const int nearest_pt_index, double back_distance);
 
+       /**
+        * \brief Overload: Writes the attached points to the provided output so its storage can be reused
+        *
+        * \param points_set all point speed pairs
+        * \param future_points future points before which to attach the points
+        * \param nearest_pt_index idx of the first future_point in points_set
+        * \param back_distance  the back distance to be added, in meters
+        * \param back_and_future point speed pairs with back distance length of points in front of future points. Existing contents are replaced
+        */
+        void attach_past_points(const std::vector<PointSpeedPair> &points_set, const std::vector<PointSpeedPair> &future_points,
+                                const int nearest_pt_index, double back_distance, std::vector<PointSpeedPair>* back_and_future);
+
        /**
         * \brief Computes a spline based on the provided points
         * \param basic_points The points to use for fitting the spline
@@ -249,6 +324,20 @@ namespace basic_autonomy
                                                       const carma_planning_msgs::msg::VehicleState &ending_state_before_buffer, carma_debug_ros2_msgs::msg::TrajectoryCurvatureSpeeds& debug_msg,
                                                       const DetailedTrajConfig &detailed_config);
 
+       /**
+        * \brief Overload: Composes the trajectory using the working buffers of the provided workspace instead of allocating new ones.
+        *        Plugins which replan frequently should keep a workspace and pass it to every call.
+        *
+        * \param workspace Buffers reused for intermediate values. Its call counters are updated
+        *
+        * \return A list of trajectory points to send to the carma planning stack
+        */
+        std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint>
+        compose_lanefollow_trajectory_from_path(const std::vector<PointSpeedPair> &points, const carma_planning_msgs::msg::VehicleState &state,
+                                                      const rclcpp::Time &state_time, const carma_wm::WorldModelConstPtr &wm,
+                                                      const carma_planning_msgs::msg::VehicleState &ending_state_before_buffer, carma_debug_ros2_msgs::msg::TrajectoryCurvatureSpeeds& debug_msg,
+                                                      const DetailedTrajConfig &detailed_config, TrajectoryWorkspace& workspace);
+
        //Functions specific to lane change
        /**
         * \brief Converts a set of requested LANE_CHANGE maneuvers to point speed limit pairs.
@@ -271,20 +360,24 @@ namespace basic_autonomy
 
         /**
           * \brief Creates a vector of lane change points using parameters defined.
+          *        The points are generated in a single pass over the starting lane centerline, which is shifted towards the
+          *        ending lane by a smooth lateral offset profile. The downtrack of each point is measured along the starting
+          *        lane centerline, so only one routeTrackPos lookup is needed regardless of centerline density.
           *
           * \param starting_lane_id lanelet id for where lane change plan should start
           * \param ending_lane_id lanelet id for where lane change plan should end
           * \param starting_downtrack The downtrack distance from which the lane change maneuver starts
           * \param ending_downtrack The downtrack distance at which the lane change maneuver end
           * \param wm Pointer to intialized world model for semantic map access
-          * \param downsample_ratio TODO: add description
+          * \param downsample_ratio Ratio by which the starting lane centerline is downsampled before generating points
           * \param buffer_ending_downtrack The additional downtrack beyond requested end dist used to fit points along spline
+          * \param downtracks Optional output of the route downtrack of each returned point
           *
           * \return A vector of geometry points as lanelet::basicpoint2d
           */
         std::vector<lanelet::BasicPoint2d> create_lanechange_geometry(lanelet::Id starting_lane_id, lanelet::Id ending_lane_id, double starting_downtrack, double ending_downtrack,
-                                                            const carma_wm::WorldModelConstPtr &wm, int downsample_ratio, double buffer_ending_downtrack);
-
+                                                            const carma_wm::WorldModelConstPtr &wm, int downsample_ratio, double buffer_ending_downtrack,
+                                                            std::vector<double>* downtracks = nullptr);
 
         /**
           * \brief Resamples a pair of basicpoint2d lines to get lines of same number of points.
@@ -314,6 +407,18 @@ namespace basic_autonomy
                const carma_wm::WorldModelConstPtr &wm, const carma_planning_msgs::msg::VehicleState &ending_state_before_buffer,
                const DetailedTrajConfig &detailed_config);
 
+       /**
+        * \brief Overload: Composes the lane change trajectory using the working buffers of the provided workspace instead of allocating new ones.
+        *
+        * \param workspace Buffers reused for intermediate values. Its call counters are updated
+        *
+        * \return A list of trajectory points to send to the carma planning stack
+        */
+        std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> compose_lanechange_trajectory_from_path(
+               const std::vector<PointSpeedPair> &points, const carma_planning_msgs::msg::VehicleState &state, const rclcpp::Time &state_time,
+               const carma_wm::WorldModelConstPtr &wm, const carma_planning_msgs::msg::VehicleState &ending_state_before_buffer,
+               const DetailedTrajConfig &detailed_config, TrajectoryWorkspace& workspace);
+
         /**
         * \brief Creates a Lanelet2 Linestring from a vector or points along the geometry
         * \param starting_downtrack downtrack along route where maneuver starts
@@ -349,10 +454,34 @@ namespace basic_autonomy
                                                             int default_downsample_ratio,
                                                             int turn_downsample_ratio);
 
+        /**
+         * \brief Ends the provided trajectory with a terminal hold at its final point
+         *
+         * \param points The trajectory to modify. Must not be empty. The final point becomes the stop point.
+         * \param hold_duration The duration of the hold in seconds. Nothing is appended if it is not positive, as a hold point
+         *                      with the target_time of the stop point would give consumers a segment of zero duration.
+         * \param planner_plugin_name The planner name to set on the hold point
+         *
+         * \return True if the hold was appended
+         */
+        bool append_terminal_hold(std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint>& points, double hold_duration,
+                                  const std::string& planner_plugin_name);
+
+        /**
+         * \brief Returns the terminal hold of the provided trajectory
+         *
+         * \param points The trajectory to check
+         *
+         * \return The hold formed by the first two consecutive points at the same position with increasing target_time.
+         *         boost::none if there is no such pair.
+         */
+        boost::optional<TerminalHold> get_terminal_hold(const std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint>& points);
+
         /**
         * \brief Given a carma type of trajectory_plan, generate autoware type of trajectory accounting for speed_lag and stopping case
         *        Generated trajectory is meant to be used in autoware.auto's pure_pursuit library using set_trajectory() function
-        * \param tp trajectory plan from tactical plugins
+        * \param tp trajectory plan from tactical plugins. If it contains a terminal hold the hold point is dropped and the stop point
+        *           and any points after it are commanded zero speed.
         *
         * \return trajectory plan of autoware_auto_msgs type
         */
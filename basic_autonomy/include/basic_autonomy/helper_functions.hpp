@@ -57,6 +57,36 @@ namespace waypoint_generation
      */
     int get_nearest_index_by_downtrack(const std::vector<lanelet::BasicPoint2d>& points, const carma_wm::WorldModelConstPtr& wm, double target_downtrack);
 
+    /**
+     * \brief Overload: Returns the nearest "less than" index to the target downtrack in a list of already computed, non-decreasing downtracks.
+     * Unlike the overloads taking points, this does not call routeTrackPos and runs in logarithmic time.
+     * 
+     * \param downtracks Downtrack of each point along the route
+     * \param target_downtrack target downtrack along the route to get index near to
+     * 
+     * \return index of nearest downtrack in downtracks
+     */
+    int get_nearest_index_by_downtrack(const std::vector<double>& downtracks, double target_downtrack);
+
+    /**
+     * \brief Fraction of the full lateral offset reached at a given fraction of the lane change length.
+     * Uses a quintic profile so lateral velocity and acceleration are zero at the start and end of the lane change.
+     * 
+     * \param progress Fraction of the lane change length travelled. Values outside [0, 1] are clamped
+     * 
+     * \return Fraction of the lateral offset between the lanes in [0, 1]
+     */
+    double lanechange_lateral_offset_fraction(double progress);
+
+    /**
+     * \brief Computes the cumulative distance along the provided points, starting at zero for the first point.
+     * Writes to the provided output so its storage can be reused.
+     * 
+     * \param points The points to measure
+     * \param arc_lengths The distance of each point from the first point along the points. Existing contents are replaced
+     */
+    void compute_arc_lengths(const std::vector<lanelet::BasicPoint2d>& points, std::vector<double>* arc_lengths);
+
     /**
      * \brief Helper method to split a list of PointSpeedPair into separate point and speed lists 
      * \param points Point Speed pair to split
@@ -34,7 +34,17 @@ namespace smoothing
  * 
  * \return The filterted points
  */
-std::vector<double> moving_average_filter(const std::vector<double> input, int window_size, bool ignore_first_point=true);
+std::vector<double> moving_average_filter(const std::vector<double>& input, int window_size, bool ignore_first_point=true);
+
+/**
+ * \brief Overload: Writes the filtered points to the provided output so its storage can be reused
+ * 
+ * \param input The points to be filtered. Must not be the same vector as output
+ * \param window_size The number of points to use in the moving window for averaging
+ * \param ignore_first_point If true the first point is copied to the output unfiltered
+ * \param output The filtered points. Existing contents are replaced
+ */
+void moving_average_filter(const std::vector<double>& input, int window_size, bool ignore_first_point, std::vector<double>* output);
 
 }  // namespace smoothing
 }  // namespace basic_autonomy
\ No newline at end of file
@@ -111,15 +111,11 @@ namespace basic_autonomy
             // Add extra lanelet to ensure there are sufficient points for buffer
             auto extra_following_lanelets = wm->getMapRoutingGraph()->following(lanelets.back());
 
-            for (auto llt : wm->getRoute()->shortestPath())
+            for (const auto& llt : extra_following_lanelets)
             {
-                for (size_t i = 0; i < extra_following_lanelets.size(); i++)
+                if (wm->isOnRoute(llt.id()))
                 {
-                    if (llt.id() == extra_following_lanelets[i].id())
-                    {
-                        lanelets.push_back(extra_following_lanelets[i]);
-                        break;
-                    }
+                    lanelets.push_back(llt);
                 }
             }
 
@@ -304,163 +300,155 @@ namespace basic_autonomy
             return constrained_points;
         }
 
-        std::vector<lanelet::BasicPoint2d> create_lanechange_geometry(lanelet::Id starting_lane_id, lanelet::Id ending_lane_id, double starting_downtrack, double ending_downtrack,
-                                                                   const carma_wm::WorldModelConstPtr &wm, int downsample_ratio, double buffer_ending_downtrack)
+        namespace
         {
-            std::vector<lanelet::BasicPoint2d> centerline_points;
-
-            //Get starting lanelet and ending lanelets
-            lanelet::ConstLanelet starting_lanelet = wm->getMap()->laneletLayer.get(starting_lane_id);
-            lanelet::ConstLanelet ending_lanelet = wm->getMap()->laneletLayer.get(ending_lane_id);
-
-            lanelet::ConstLanelets starting_lane;
-            starting_lane.push_back(starting_lanelet);
-
-            std::vector<lanelet::BasicPoint2d> reference_centerline;
-            // 400 value here is an arbitrary attempt at improving performance by reducing copy operations.
-            // Value picked based on annecdotal evidence from STOL system testing
-            reference_centerline.reserve(400);
-            bool shared_boundary_found = false;
-            bool is_lanechange_left = false;
+            /**
+             * \brief Returns the lanelets of the starting lane from the starting lanelet up to the lanelet which shares a boundary with the ending lanelet
+             *
+             * \param starting_lanelet Lanelet where the lane change starts
+             * \param ending_lanelet Lanelet where the lane change ends
+             * \param wm Pointer to intialized world model for semantic map access
+             * \param is_lanechange_left Set to true if the ending lanelet is to the left of the starting lane
+             *
+             * \throw std::invalid_argument if no lanelet of the starting lane shares a boundary with the ending lanelet
+             */
+            lanelet::ConstLanelets get_lanechange_starting_lane(const lanelet::ConstLanelet& starting_lanelet, const lanelet::ConstLanelet& ending_lanelet,
+                                                               const carma_wm::WorldModelConstPtr &wm, bool& is_lanechange_left)
+            {
+                lanelet::ConstLanelets starting_lane;
+                starting_lane.push_back(starting_lanelet);
 
-            lanelet::BasicLineString2d current_lanelet_centerline = starting_lanelet.centerline2d().basicLineString();
-            lanelet::ConstLanelet current_lanelet = starting_lanelet;
-            reference_centerline.insert(reference_centerline.end(), current_lanelet_centerline.begin(), current_lanelet_centerline.end());
-
-            RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Searching for shared boundary with starting lanechange lanelet " << std::to_string(current_lanelet.id()) << " and ending lanelet " << std::to_string(ending_lanelet.id()));
-            while(!shared_boundary_found){
-                //Assumption- Adjacent lanelets share lane boundary
-                if(current_lanelet.leftBound() == ending_lanelet.rightBound()){
-                    RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Lanelet " << std::to_string(current_lanelet.id()) << " shares left boundary with " << std::to_string(ending_lanelet.id()));
-                    is_lanechange_left = true;
-                    shared_boundary_found = true;
-                }
+                bool shared_boundary_found = false;
+                is_lanechange_left = false;
 
-                else if(current_lanelet.rightBound() == ending_lanelet.leftBound()){
-                    RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Lanelet " << std::to_string(current_lanelet.id()) << " shares right boundary with " << std::to_string(ending_lanelet.id()));
-                    shared_boundary_found = true;
-                }
+                lanelet::ConstLanelet current_lanelet = starting_lanelet;
 
-                else{
-                    //If there are no following lanelets on route, lanechange should be completing before reaching it
-                    if(wm->getMapRoutingGraph()->following(current_lanelet, false).empty())
-                    {
-                        // Maneuver requires we travel further before completing lane change, but no routable lanelet directly ahead
-                        //In this case we have reached a lanelet which does not have a routable lanelet ahead + isn't adjacent to the lanelet where lane change ends
-                        //A lane change should have already happened at this point
-                        throw(std::invalid_argument("No following lanelets from current lanelet reachable without a lane change, incorrectly chosen end lanelet"));
+                RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Searching for shared boundary with starting lanechange lanelet " << std::to_string(current_lanelet.id()) << " and ending lanelet " << std::to_string(ending_lanelet.id()));
+                while(!shared_boundary_found){
+                    //Assumption- Adjacent lanelets share lane boundary
+                    if(current_lanelet.leftBound() == ending_lanelet.rightBound()){
+                        RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Lanelet " << std::to_string(current_lanelet.id()) << " shares left boundary with " << std::to_string(ending_lanelet.id()));
+                        is_lanechange_left = true;
+                        shared_boundary_found = true;
                     }
 
-                    current_lanelet = wm->getMapRoutingGraph()->following(current_lanelet, false).front();
-                    if(current_lanelet.id() == starting_lanelet.id()){
-                        //Looped back to starting lanelet
-                        throw(std::invalid_argument("No lane change in path"));
+                    else if(current_lanelet.rightBound() == ending_lanelet.leftBound()){
+                        RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Lanelet " << std::to_string(current_lanelet.id()) << " shares right boundary with " << std::to_string(ending_lanelet.id()));
+                        shared_boundary_found = true;
                     }
-                    RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Now checking for shared lane boundary with lanelet " << std::to_string(current_lanelet.id()) << " and ending lanelet " << std::to_string(ending_lanelet.id()));
-                    auto current_lanelet_linestring = current_lanelet.centerline2d().basicLineString();
-                    //Concatenate linestring starting from + 1 to avoid overlap
-                    reference_centerline.insert(reference_centerline.end(), current_lanelet_linestring.begin() + 1, current_lanelet_linestring.end());
-                    starting_lane.push_back(current_lanelet);
-                }
-            }
-
-            // Create the target lane centerline using lanelets adjacent to the lanechange lanelets in the starting lane
-            std::vector<lanelet::BasicPoint2d> target_lane_centerline;
-            for(size_t i = 0;i<starting_lane.size();++i){
-                lanelet::ConstLanelet curr_end_lanelet;
-
-                if(is_lanechange_left){
 
-                    //get left lanelet
-                    if(wm->getMapRoutingGraph()->left(starting_lane[i])){
-                        curr_end_lanelet = wm->getMapRoutingGraph()->left(starting_lane[i]).get();
-                    }
                     else{
-                        curr_end_lanelet = wm->getMapRoutingGraph()->adjacentLeft(starting_lane[i]).get();
+                        //If there are no following lanelets on route, lanechange should be completing before reaching it
+                        if(wm->getMapRoutingGraph()->following(current_lanelet, false).empty())
+                        {
+                            // Maneuver requires we travel further before completing lane change, but no routable lanelet directly ahead
+                            //In this case we have reached a lanelet which does not have a routable lanelet ahead + isn't adjacent to the lanelet where lane change ends
+                            //A lane change should have already happened at this point
+                            throw(std::invalid_argument("No following lanelets from current lanelet reachable without a lane change, incorrectly chosen end lanelet"));
+                        }
+
+                        current_lanelet = wm->getMapRoutingGraph()->following(current_lanelet, false).front();
+                        if(current_lanelet.id() == starting_lanelet.id()){
+                            //Looped back to starting lanelet
+                            throw(std::invalid_argument("No lane change in path"));
+                        }
+                        RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Now checking for shared lane boundary with lanelet " << std::to_string(current_lanelet.id()) << " and ending lanelet " << std::to_string(ending_lanelet.id()));
+                        starting_lane.push_back(current_lanelet);
                     }
                 }
-                else{
 
-                    //get right lanelet
-                    if(wm->getMapRoutingGraph()->right(starting_lane[i])){
-                        curr_end_lanelet = wm->getMapRoutingGraph()->right(starting_lane[i]).get();
-                    }
-                    else{
-                        curr_end_lanelet = wm->getMapRoutingGraph()->adjacentRight(starting_lane[i]).get();
-                    }
-                }
+                return starting_lane;
+            }
+        }
 
-                auto target_lane_linestring = curr_end_lanelet.centerline2d().basicLineString();
-                //Concatenate linestring starting from + 1 to avoid overlap
-                target_lane_centerline.insert(target_lane_centerline.end(), target_lane_linestring.begin() + 1, target_lane_linestring.end());
+        std::vector<lanelet::BasicPoint2d> create_lanechange_geometry(lanelet::Id starting_lane_id, lanelet::Id ending_lane_id, double starting_downtrack, double ending_downtrack,
+                                                                   const carma_wm::WorldModelConstPtr &wm, int downsample_ratio, double buffer_ending_downtrack,
+                                                                   std::vector<double>* downtracks)
+        {
+            //Get starting lanelet and ending lanelets
+            lanelet::ConstLanelet starting_lanelet = wm->getMap()->laneletLayer.get(starting_lane_id);
+            lanelet::ConstLanelet ending_lanelet = wm->getMap()->laneletLayer.get(ending_lane_id);
 
-            }
+            bool is_lanechange_left = false;
+            lanelet::ConstLanelets starting_lane = get_lanechange_starting_lane(starting_lanelet, ending_lanelet, wm, is_lanechange_left);
 
-            //Downsample centerlines
-            // 400 value here is an arbitrary attempt at improving performance by reducing copy operations.
-            // Value picked based on annecdotal evidence from STOL system testing
+            // The starting lane centerline is the reference line the lane change is offset from
+            std::vector<lanelet::BasicPoint2d> reference_centerline;
+            for (const auto& llt : starting_lane)
+            {
+                auto lanelet_centerline = llt.centerline2d().basicLineString();
+                //Concatenate linestring starting from + 1 to avoid overlap
+                reference_centerline.insert(reference_centerline.end(), lanelet_centerline.begin() + (reference_centerline.empty() ? 0 : 1), lanelet_centerline.end());
+            }
+            reference_centerline = carma_ros2_utils::containers::downsample_vector(reference_centerline, downsample_ratio);
 
-            std::vector<lanelet::BasicPoint2d> downsampled_starting_centerline;
-            downsampled_starting_centerline.reserve(400);
-            downsampled_starting_centerline = carma_ros2_utils::containers::downsample_vector(reference_centerline, downsample_ratio);
+            if (reference_centerline.size() < 2)
+            {
+                throw std::invalid_argument("Starting lane centerline of lane change has fewer than two points");
+            }
 
-            std::vector<lanelet::BasicPoint2d> downsampled_target_centerline;
-            downsampled_target_centerline.reserve(400);
-            downsampled_target_centerline = carma_ros2_utils::containers::downsample_vector(target_lane_centerline, downsample_ratio);
+            // Downtrack of each reference point. A single routeTrackPos call anchors the arc length along the reference line to the route
+            std::vector<double> reference_downtracks;
+            reference_downtracks.reserve(reference_centerline.size());
+            reference_downtracks.push_back(wm->routeTrackPos(reference_centerline.front()).downtrack);
+            for (size_t i = 1; i < reference_centerline.size(); ++i)
+            {
+                reference_downtracks.push_back(reference_downtracks.back() + lanelet::geometry::distance2d(reference_centerline[i - 1], reference_centerline[i]));
+            }
 
-            // Constrain centerlines to starting and ending downtrack
-            int start_index_starting_centerline = waypoint_generation::get_nearest_index_by_downtrack(downsampled_starting_centerline, wm, starting_downtrack);
-            carma_planning_msgs::msg::VehicleState start_state;
-            start_state.x_pos_global = downsampled_starting_centerline[start_index_starting_centerline].x();
-            start_state.y_pos_global = downsampled_starting_centerline[start_index_starting_centerline].y();
-            int start_index_target_centerline = waypoint_generation::get_nearest_point_index(downsampled_target_centerline, start_state);
+            size_t start_index = get_nearest_index_by_downtrack(reference_downtracks, starting_downtrack);
+            size_t end_index = get_nearest_index_by_downtrack(reference_downtracks, ending_downtrack);
 
-            int end_index_target_centerline = waypoint_generation::get_nearest_index_by_downtrack(downsampled_target_centerline, wm, ending_downtrack);
-            carma_planning_msgs::msg::VehicleState end_state;
-            end_state.x_pos_global = downsampled_target_centerline[end_index_target_centerline].x();
-            end_state.y_pos_global = downsampled_target_centerline[end_index_target_centerline].y();
-            int end_index_starting_centerline = waypoint_generation::get_nearest_point_index(downsampled_starting_centerline, end_state);
+            // Lateral distance between the lane centerlines where the lane change ends
+            double lane_offset = std::fabs(carma_wm::geometry::trackPos(ending_lanelet, reference_centerline[end_index]).crosstrack);
+            double offset_direction = is_lanechange_left ? 1.0 : -1.0;
 
-            std::vector<lanelet::BasicPoint2d> constrained_start_centerline(downsampled_starting_centerline.begin() + start_index_starting_centerline, downsampled_starting_centerline.begin() + end_index_starting_centerline);
-            std::vector<lanelet::BasicPoint2d> constrained_target_centerline(downsampled_target_centerline.begin() + start_index_target_centerline, downsampled_target_centerline.begin() + end_index_target_centerline);
+            double lanechange_start_downtrack = reference_downtracks[start_index];
+            double lanechange_length = ending_downtrack - lanechange_start_downtrack;
 
-            // If constrained centerlines are not the same size - resample to ensure same size along both centerlines
-            if(constrained_start_centerline.size() != constrained_target_centerline.size())
+            std::vector<lanelet::BasicPoint2d> centerline_points;
+            centerline_points.reserve(reference_centerline.size() - start_index);
+            if (downtracks)
             {
-                auto centerlines = resample_linestring_pair_to_same_size(constrained_start_centerline, constrained_target_centerline);
-                constrained_start_centerline = centerlines[0];
-                constrained_target_centerline = centerlines[1];
-
+                downtracks->clear();
+                downtracks->reserve(reference_centerline.size() - start_index);
             }
 
-            //Create Trajectory geometry
-            double delta_step = 1.0 / constrained_start_centerline.size();
-
-            for (size_t i = 0; i < constrained_start_centerline.size(); ++i)
+            for (size_t i = start_index; i < reference_centerline.size(); ++i)
             {
-                lanelet::BasicPoint2d current_position;
-                lanelet::BasicPoint2d start_lane_pt = constrained_start_centerline[i];
-                lanelet::BasicPoint2d target_lane_pt = constrained_target_centerline[i];
-                double delta = delta_step * i;
-                current_position.x() = target_lane_pt.x() * delta + (1 - delta) * start_lane_pt.x();
-                current_position.y() = target_lane_pt.y() * delta + (1 - delta) * start_lane_pt.y();
-
-                centerline_points.push_back(current_position);
+                // Left normal of the reference line from the neighboring points
+                const auto& previous = reference_centerline[i == 0 ? 0 : i - 1];
+                const auto& next = reference_centerline[std::min(i + 1, reference_centerline.size() - 1)];
+                lanelet::BasicPoint2d tangent = next - previous;
+                double tangent_norm = tangent.norm();
+                lanelet::BasicPoint2d left_normal = tangent_norm > epsilon_ ? lanelet::BasicPoint2d(-tangent.y() / tangent_norm, tangent.x() / tangent_norm)
+                                                                            : lanelet::BasicPoint2d(0.0, 0.0);
+
+                double progress = lanechange_length > epsilon_ ? (reference_downtracks[i] - lanechange_start_downtrack) / lanechange_length : 1.0;
+                double lateral_offset = offset_direction * lane_offset * lanechange_lateral_offset_fraction(progress);
+
+                centerline_points.push_back(reference_centerline[i] + lateral_offset * left_normal);
+                if (downtracks)
+                {
+                    downtracks->push_back(reference_downtracks[i]);
+                }
             }
 
-            // Add points from the remaining length of the target lanelet to provide sufficient distance for adding buffer
-            double dist_to_target_lane_end = lanelet::geometry::distance2d(centerline_points.back(), downsampled_target_centerline.back());
-            centerline_points.insert(centerline_points.end(), downsampled_target_centerline.begin() + end_index_target_centerline, downsampled_target_centerline.end());
-
-            // If the additional distance from the remaining length of the target lanelet does not provide more than the required
-            // buffer_ending_downtrack, then also add points from the lanelet following the target lanelet
-            if (dist_to_target_lane_end < buffer_ending_downtrack) {
+            // If the remaining length of the starting lane does not provide more than the required buffer_ending_downtrack,
+            // then also add points from the lanelet following the ending lanelet
+            if (reference_downtracks.back() - ending_downtrack < buffer_ending_downtrack) {
                 auto following_lanelets = wm->getMapRoutingGraph()->following(ending_lanelet, false);
                 if(!following_lanelets.empty()){
                     //Arbitrarily choosing first following lanelet for buffer since points are only being used to fit spline
                     auto following_lanelet_centerline = following_lanelets.front().centerline2d().basicLineString();
-                    centerline_points.insert(centerline_points.end(), following_lanelet_centerline.begin(),
-                                                                                following_lanelet_centerline.end());
+                    for (size_t i = 1; i < following_lanelet_centerline.size(); ++i)
+                    {
+                        if (downtracks)
+                        {
+                            downtracks->push_back(downtracks->back() + lanelet::geometry::distance2d(centerline_points.back(), following_lanelet_centerline[i]));
+                        }
+                        centerline_points.push_back(following_lanelet_centerline[i]);
+                    }
                 }
             }
 
@@ -548,14 +536,16 @@ namespace basic_autonomy
             }
 
             //get route between starting and ending downtracks - downtracks should be constant for complete length of maneuver
+            std::vector<double> route_geometry_downtracks;
             std::vector<lanelet::BasicPoint2d> route_geometry = create_lanechange_geometry(std::stoi(lane_change_maneuver.starting_lane_id),std::stoi(lane_change_maneuver.ending_lane_id),
-                                                                                        starting_downtrack, ending_downtrack, wm, general_config.default_downsample_ratio, detailed_config.buffer_ending_downtrack);
+                                                                                        starting_downtrack, ending_downtrack, wm, general_config.default_downsample_ratio, detailed_config.buffer_ending_downtrack,
+                                                                                        &route_geometry_downtracks);
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Route geometry size:"<<route_geometry.size());
 
             lanelet::BasicPoint2d state_pos(state.x_pos_global, state.y_pos_global);
             double current_downtrack = wm->routeTrackPos(state_pos).downtrack;
-            int nearest_pt_index = get_nearest_index_by_downtrack(route_geometry, wm, current_downtrack);
-            int ending_pt_index = get_nearest_index_by_downtrack(route_geometry, wm, ending_downtrack);
+            int nearest_pt_index = get_nearest_index_by_downtrack(route_geometry_downtracks, current_downtrack);
+            int ending_pt_index = get_nearest_index_by_downtrack(route_geometry_downtracks, ending_downtrack);
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Nearest pt index in maneuvers to points: "<< nearest_pt_index);
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Ending pt index in maneuvers to points: "<< ending_pt_index);
 
@@ -570,7 +560,7 @@ namespace basic_autonomy
 
             if (ending_downtrack + detailed_config.buffer_ending_downtrack < route_length)
             {
-                ending_pt_index = get_nearest_index_by_downtrack(route_geometry, wm, ending_downtrack + detailed_config.buffer_ending_downtrack);
+                ending_pt_index = get_nearest_index_by_downtrack(route_geometry_downtracks, ending_downtrack + detailed_config.buffer_ending_downtrack);
             }
             else
             {
@@ -601,8 +591,15 @@ namespace basic_autonomy
 
         }
 
-        std::vector<double> apply_speed_limits(const std::vector<double> speeds,
-                                               const std::vector<double> speed_limits)
+        std::vector<double> apply_speed_limits(const std::vector<double>& speeds,
+                                               const std::vector<double>& speed_limits)
+        {
+            std::vector<double> out;
+            apply_speed_limits(speeds, speed_limits, &out);
+            return out;
+        }
+
+        void apply_speed_limits(const std::vector<double>& speeds, const std::vector<double>& speed_limits, std::vector<double>* out)
         {
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Speeds list size: " << speeds.size());
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "SpeedLimits list size: " << speed_limits.size());
@@ -611,13 +608,12 @@ namespace basic_autonomy
             {
                 throw std::invalid_argument("Speeds and speed limit lists not same size");
             }
-            std::vector<double> out;
+            out->clear();
+            out->reserve(speeds.size());
             for (size_t i = 0; i < speeds.size(); i++)
             {
-                out.push_back(std::min(speeds[i], speed_limits[i]));
+                out->push_back(std::min(speeds[i], speed_limits[i]));
             }
-
-            return out;
         }
 
         Eigen::Isometry2d compute_heading_frame(const lanelet::BasicPoint2d &p1,
@@ -631,14 +627,22 @@ namespace basic_autonomy
         std::vector<PointSpeedPair> constrain_to_time_boundary(const std::vector<PointSpeedPair> &points,
                                                                double time_span)
         {
-            std::vector<lanelet::BasicPoint2d> basic_points;
-            std::vector<double> speeds;
-            split_point_speed_pairs(points, &basic_points, &speeds);
+            std::vector<PointSpeedPair> time_bound_points = points;
+            TrajectoryWorkspace workspace;
+            constrain_to_time_boundary(&time_bound_points, time_span, workspace);
+            return time_bound_points;
+        }
 
-            std::vector<double> downtracks = carma_wm::geometry::compute_arc_lengths(basic_points);
+        void constrain_to_time_boundary(std::vector<PointSpeedPair>* points, double time_span, TrajectoryWorkspace& workspace)
+        {
+            workspace.curve_points.clear();
+            workspace.speeds.clear();
+            split_point_speed_pairs(*points, &workspace.curve_points, &workspace.speeds);
+
+            compute_arc_lengths(workspace.curve_points, &workspace.downtracks);
 
             size_t time_boundary_exclusive_index =
-                trajectory_utils::time_boundary_index(downtracks, speeds, time_span);
+                trajectory_utils::time_boundary_index(workspace.downtracks, workspace.speeds, time_span);
 
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "time_boundary_exclusive_index = " << time_boundary_exclusive_index);
 
@@ -647,21 +651,10 @@ namespace basic_autonomy
                 throw std::invalid_argument("No points to fit in timespan");
             }
 
-            std::vector<PointSpeedPair> time_bound_points;
-            time_bound_points.reserve(time_boundary_exclusive_index);
-
-            if (time_boundary_exclusive_index == points.size())
-            {
-                time_bound_points.insert(time_bound_points.end(), points.begin(),
-                                         points.end()); // All points fit within time boundary
-            }
-            else
+            if (time_boundary_exclusive_index != points->size())
             {
-                time_bound_points.insert(time_bound_points.end(), points.begin(),
-                                         points.begin() + time_boundary_exclusive_index - 1); // Limit points by time boundary
+                points->resize(time_boundary_exclusive_index - 1); // Limit points by time boundary
             }
-
-            return time_bound_points;
         }
 
         std::pair<double, size_t> min_with_exclusions(const std::vector<double> &values, const std::unordered_set<size_t> &excluded)
@@ -782,7 +775,15 @@ namespace basic_autonomy
                                                        const int nearest_pt_index,  double back_distance)
         {
             std::vector<PointSpeedPair> back_and_future;
-            back_and_future.reserve(points_set.size());
+            attach_past_points(points_set, future_points, nearest_pt_index, back_distance, &back_and_future);
+            return back_and_future;
+        }
+
+        void attach_past_points(const std::vector<PointSpeedPair> &points_set, const std::vector<PointSpeedPair> &future_points,
+                                const int nearest_pt_index, double back_distance, std::vector<PointSpeedPair>* back_and_future)
+        {
+            back_and_future->clear();
+            back_and_future->reserve(points_set.size());
             double total_dist = 0;
             int min_i = 0;
 
@@ -798,9 +799,8 @@ namespace basic_autonomy
                 }
             }
 
-            back_and_future.insert(back_and_future.end(), points_set.begin() + min_i, points_set.begin() + nearest_pt_index + 1);
-            back_and_future.insert(back_and_future.end(), future_points.begin(), future_points.end());
-            return back_and_future;
+            back_and_future->insert(back_and_future->end(), points_set.begin() + min_i, points_set.begin() + nearest_pt_index + 1);
+            back_and_future->insert(back_and_future->end(), future_points.begin(), future_points.end());
         }
 
         std::unique_ptr<basic_autonomy::smoothing::SplineI> compute_fit(const std::vector<lanelet::BasicPoint2d> &basic_points)
@@ -850,10 +850,56 @@ namespace basic_autonomy
             return (f_prime.cross(f_prime_prime)).norm() / (pow(f_prime.norm(), 3));
         }
 
+        size_t TrajectoryWorkspace::capacity_bytes() const
+        {
+            return time_bound_points.capacity() * sizeof(PointSpeedPair)
+                + back_and_future.capacity() * sizeof(PointSpeedPair)
+                + curve_points.capacity() * sizeof(lanelet::BasicPoint2d)
+                + sampling_points.capacity() * sizeof(lanelet::BasicPoint2d)
+                + (speeds.capacity() + downtracks.capacity() + distributed_speed_limits.capacity() + raw_curvatures.capacity()
+                    + curvatures.capacity() + constrained_speed_limits.capacity()) * sizeof(double);
+        }
+
+        namespace
+        {
+            // Updates the call counters of a workspace once the trajectory has been composed, including on early returns
+            class WorkspaceUsage
+            {
+            public:
+                explicit WorkspaceUsage(TrajectoryWorkspace& workspace)
+                    : workspace_(workspace), initial_capacity_bytes_(workspace.capacity_bytes())
+                {}
+
+                ~WorkspaceUsage()
+                {
+                    workspace_.calls++;
+                    if (workspace_.capacity_bytes() > initial_capacity_bytes_)
+                    {
+                        workspace_.allocating_calls++;
+                    }
+                }
+
+            private:
+                TrajectoryWorkspace& workspace_;
+                size_t initial_capacity_bytes_;
+            };
+        }
+
         std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> compose_lanefollow_trajectory_from_path(
             const std::vector<PointSpeedPair> &points, const carma_planning_msgs::msg::VehicleState &state, const rclcpp::Time &state_time, const carma_wm::WorldModelConstPtr &wm,
             const carma_planning_msgs::msg::VehicleState &ending_state_before_buffer, carma_debug_ros2_msgs::msg::TrajectoryCurvatureSpeeds& debug_msg, const DetailedTrajConfig &detailed_config)
         {
+            TrajectoryWorkspace workspace;
+            return compose_lanefollow_trajectory_from_path(points, state, state_time, wm, ending_state_before_buffer, debug_msg, detailed_config, workspace);
+        }
+
+        std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> compose_lanefollow_trajectory_from_path(
+            const std::vector<PointSpeedPair> &points, const carma_planning_msgs::msg::VehicleState &state, const rclcpp::Time &state_time, const carma_wm::WorldModelConstPtr &wm,
+            const carma_planning_msgs::msg::VehicleState &ending_state_before_buffer, carma_debug_ros2_msgs::msg::TrajectoryCurvatureSpeeds& debug_msg, const DetailedTrajConfig &detailed_config,
+            TrajectoryWorkspace& workspace)
+        {
+            WorkspaceUsage workspace_usage(workspace);
+
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "VehicleState: "
                              << " x: " << state.x_pos_global << " y: " << state.y_pos_global << " yaw: " << state.orientation
                              << " speed: " << state.longitudinal_vel);
@@ -864,22 +910,26 @@ namespace basic_autonomy
 
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "NearestPtIndex: " << nearest_pt_index);
 
-            std::vector<PointSpeedPair> future_points(points.begin() + nearest_pt_index + 1, points.end()); // Points in front of current vehicle position
+            auto& time_bound_points = workspace.time_bound_points;
+            time_bound_points.assign(points.begin() + nearest_pt_index + 1, points.end()); // Points in front of current vehicle position
 
-            RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Ready to call constrain_to_time_boundary: future_points size = " << future_points.size() << ", trajectory_time_length = " << detailed_config.trajectory_time_length);
+            RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Ready to call constrain_to_time_boundary: future_points size = " << time_bound_points.size() << ", trajectory_time_length = " << detailed_config.trajectory_time_length);
 
-            auto time_bound_points = constrain_to_time_boundary(future_points, detailed_config.trajectory_time_length);
+            constrain_to_time_boundary(&time_bound_points, detailed_config.trajectory_time_length, workspace);
 
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Got time_bound_points with size:" << time_bound_points.size());
             log::printDebugPerLine(time_bound_points, &log::pointSpeedPairToStream);
 
-            std::vector<PointSpeedPair> back_and_future = attach_past_points(points, time_bound_points, nearest_pt_index, detailed_config.back_distance);
+            auto& back_and_future = workspace.back_and_future;
+            attach_past_points(points, time_bound_points, nearest_pt_index, detailed_config.back_distance, &back_and_future);
 
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Got back_and_future points with size" << back_and_future.size());
             log::printDebugPerLine(back_and_future, &log::pointSpeedPairToStream);
 
-            std::vector<double> speed_limits;
-            std::vector<lanelet::BasicPoint2d> curve_points;
+            auto& speed_limits = workspace.speeds;
+            auto& curve_points = workspace.curve_points;
+            speed_limits.clear();
+            curve_points.clear();
             split_point_speed_pairs(back_and_future, &curve_points, &speed_limits);
 
             std::unique_ptr<smoothing::SplineI> fit_curve = compute_fit(curve_points); // Compute splines based on curve points
@@ -892,15 +942,10 @@ namespace basic_autonomy
 
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "speed_limits.size() " << speed_limits.size());
 
-            std::vector<lanelet::BasicPoint2d> all_sampling_points;
-            all_sampling_points.reserve(1 + curve_points.size() * 2);
-
-            std::vector<double> distributed_speed_limits;
-            distributed_speed_limits.reserve(1 + curve_points.size() * 2);
-
             // compute total length of the trajectory to get correct number of points
             // we expect using curve_resample_step_size
-            std::vector<double> downtracks_raw = carma_wm::geometry::compute_arc_lengths(curve_points);
+            auto& downtracks_raw = workspace.downtracks;
+            compute_arc_lengths(curve_points, &downtracks_raw);
 
             auto total_step_along_curve = static_cast<int>(downtracks_raw.back() / detailed_config.curve_resample_step_size);
 
@@ -909,8 +954,18 @@ namespace basic_autonomy
 
             double step_threshold_for_next_speed = (double)total_step_along_curve / (double)total_point_size;
             double scaled_steps_along_curve = 0.0; // from 0 (start) to 1 (end) for the whole trajectory
-            std::vector<double> better_curvature;
-            better_curvature.reserve(1 + curve_points.size() * 2);
+
+            auto& all_sampling_points = workspace.sampling_points;
+            all_sampling_points.clear();
+            all_sampling_points.reserve(total_step_along_curve + 1);
+
+            auto& distributed_speed_limits = workspace.distributed_speed_limits;
+            distributed_speed_limits.clear();
+            distributed_speed_limits.reserve(total_step_along_curve + 1);
+
+            auto& better_curvature = workspace.raw_curvatures;
+            better_curvature.clear();
+            better_curvature.reserve(total_step_along_curve + 1);
 
             for (int steps_along_curve = 0; steps_along_curve < total_step_along_curve; steps_along_curve++) // Resample curve at tighter resolution
             {
@@ -935,7 +990,8 @@ namespace basic_autonomy
 
             log::printDoublesPerLineWithPrefix("raw_curvatures[i]: ", better_curvature);
 
-            std::vector<double> curvatures = smoothing::moving_average_filter(better_curvature, detailed_config.curvature_moving_average_window_size, false);
+            auto& curvatures = workspace.curvatures;
+            smoothing::moving_average_filter(better_curvature, detailed_config.curvature_moving_average_window_size, false, &curvatures);
             std::vector<double> ideal_speeds =
                 trajectory_utils::constrained_speeds_for_curvatures(curvatures, detailed_config.lateral_accel_limit);
 
@@ -943,7 +999,8 @@ namespace basic_autonomy
             log::printDoublesPerLineWithPrefix("ideal_speeds: ", ideal_speeds);
             log::printDoublesPerLineWithPrefix("final_yaw_values[i]: ", final_yaw_values);
 
-            std::vector<double> constrained_speed_limits = apply_speed_limits(ideal_speeds, distributed_speed_limits);
+            auto& constrained_speed_limits = workspace.constrained_speed_limits;
+            apply_speed_limits(ideal_speeds, distributed_speed_limits, &constrained_speed_limits);
 
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Processed all points in computed fit");
 
@@ -996,36 +1053,33 @@ namespace basic_autonomy
 
             //drop buffer points here
 
-             std::vector<lanelet::BasicPoint2d> future_basic_points(all_sampling_points.begin() + nearest_pt_index + 1,
-                                            all_sampling_points.begin()+ buffer_pt_index);  // Points in front of current vehicle position
-
-            std::vector<double> future_speeds(constrained_speed_limits.begin() + nearest_pt_index + 1,
-                                                        constrained_speed_limits.begin() + buffer_pt_index);  // Points in front of current vehicle position
-            std::vector<double> future_yaw(final_yaw_values.begin() + nearest_pt_index + 1,
-                                                        final_yaw_values.begin() + buffer_pt_index);  // Points in front of current vehicle position
-            std::vector<double>  final_actual_speeds = future_speeds;
-            all_sampling_points = future_basic_points;
-            final_yaw_values = future_yaw;
-            RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Trimmed future points to size: "<< future_basic_points.size());
-
-            lanelet::BasicPoint2d cur_veh_point(state.x_pos_global, state.y_pos_global);
-
-            all_sampling_points.insert(all_sampling_points.begin(),
-                                       cur_veh_point); // Add current vehicle position to front of sample points
+            // Keep the points in front of the current vehicle position up to the buffer. The point just behind the vehicle is kept
+            // and replaced by the current vehicle state so no elements have to be shifted to add it.
+            all_sampling_points.erase(all_sampling_points.begin() + buffer_pt_index, all_sampling_points.end());
+            all_sampling_points.erase(all_sampling_points.begin(), all_sampling_points.begin() + nearest_pt_index);
+            final_yaw_values.erase(final_yaw_values.begin() + buffer_pt_index, final_yaw_values.end());
+            final_yaw_values.erase(final_yaw_values.begin(), final_yaw_values.begin() + nearest_pt_index);
+            RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Trimmed future points to size: "<< all_sampling_points.size() - 1);
 
-            final_actual_speeds.insert(final_actual_speeds.begin(), state.longitudinal_vel);
+            all_sampling_points.front() = lanelet::BasicPoint2d(state.x_pos_global, state.y_pos_global); // Add current vehicle position to front of sample points
+            final_yaw_values.front() = state.orientation;
 
-            final_yaw_values.insert(final_yaw_values.begin(), state.orientation);
+            auto& final_actual_speeds = workspace.speeds;
+            final_actual_speeds.clear();
+            final_actual_speeds.push_back(state.longitudinal_vel);
+            final_actual_speeds.insert(final_actual_speeds.end(), constrained_speed_limits.begin() + nearest_pt_index + 1,
+                                                                  constrained_speed_limits.begin() + buffer_pt_index);  // Points in front of current vehicle position
 
             // Compute points to local downtracks
-            std::vector<double> downtracks = carma_wm::geometry::compute_arc_lengths(all_sampling_points);
+            auto& downtracks = workspace.downtracks;
+            compute_arc_lengths(all_sampling_points, &downtracks);
 
             // Apply accel limits
-            final_actual_speeds = optimize_speed(downtracks, final_actual_speeds, detailed_config.max_accel);
+            std::vector<double> accel_limited_speeds = optimize_speed(downtracks, final_actual_speeds, detailed_config.max_accel);
 
-            log::printDoublesPerLineWithPrefix("postAccel[i]: ", final_actual_speeds);
+            log::printDoublesPerLineWithPrefix("postAccel[i]: ", accel_limited_speeds);
 
-            final_actual_speeds = smoothing::moving_average_filter(final_actual_speeds, detailed_config.speed_moving_average_window_size);
+            smoothing::moving_average_filter(accel_limited_speeds, detailed_config.speed_moving_average_window_size, true, &final_actual_speeds);
 
             log::printDoublesPerLineWithPrefix("post_average[i]: ", final_actual_speeds);
 
@@ -1051,13 +1105,10 @@ namespace basic_autonomy
             msg.velocity_profile = final_actual_speeds;
             msg.relative_downtrack = downtracks;
             msg.tangent_headings = final_yaw_values;
-            std::vector<double> aligned_speed_limits(constrained_speed_limits.begin() + nearest_pt_index,
-                                                    constrained_speed_limits.end());
-
-            msg.speed_limits = aligned_speed_limits;
-            std::vector<double> aligned_curvatures(curvatures.begin() + nearest_pt_index,
-                                                    curvatures.end());
-            msg.curvatures = aligned_curvatures;
+            msg.speed_limits.assign(constrained_speed_limits.begin() + nearest_pt_index,
+                                    constrained_speed_limits.end());
+            msg.curvatures.assign(curvatures.begin() + nearest_pt_index,
+                                  curvatures.end());
             msg.lat_accel_limit = detailed_config.lateral_accel_limit;
             msg.lon_accel_limit = detailed_config.max_accel;
             msg.starting_state = state;
@@ -1113,38 +1164,55 @@ namespace basic_autonomy
             const std::vector<PointSpeedPair> &points, const carma_planning_msgs::msg::VehicleState &state, const rclcpp::Time &state_time,
             const carma_wm::WorldModelConstPtr &wm, const carma_planning_msgs::msg::VehicleState &ending_state_before_buffer, const DetailedTrajConfig &detailed_config)
         {
+            TrajectoryWorkspace workspace;
+            return compose_lanechange_trajectory_from_path(points, state, state_time, wm, ending_state_before_buffer, detailed_config, workspace);
+        }
+
+        std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> compose_lanechange_trajectory_from_path(
+            const std::vector<PointSpeedPair> &points, const carma_planning_msgs::msg::VehicleState &state, const rclcpp::Time &state_time,
+            const carma_wm::WorldModelConstPtr &wm, const carma_planning_msgs::msg::VehicleState &ending_state_before_buffer, const DetailedTrajConfig &detailed_config,
+            TrajectoryWorkspace& workspace)
+        {
+            WorkspaceUsage workspace_usage(workspace);
+
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Input points size in compose traj from centerline: "<< points.size());
             int nearest_pt_index = get_nearest_index_by_downtrack(points, wm, state);
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "nearest_pt_index: "<< nearest_pt_index);
 
-            std::vector<PointSpeedPair> future_points(points.begin() + nearest_pt_index + 1, points.end());
+            auto& future_points = workspace.time_bound_points;
+            future_points.assign(points.begin() + nearest_pt_index + 1, points.end());
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "future_points size: "<< future_points.size());
 
             //Compute yaw values from original trajectory.
-            std::vector<lanelet::BasicPoint2d> future_geom_points;
-            std::vector<double> final_actual_speeds;
-            split_point_speed_pairs(future_points, &future_geom_points, &final_actual_speeds);
+            auto& future_geom_points = workspace.curve_points;
+            auto& speed_limits = workspace.distributed_speed_limits;
+            future_geom_points.clear();
+            speed_limits.clear();
+            split_point_speed_pairs(future_points, &future_geom_points, &speed_limits);
 
             std::unique_ptr<smoothing::SplineI> fit_curve = compute_fit(future_geom_points);
             if(!fit_curve){
                 throw std::invalid_argument("Could not fit a spline curve along the given trajectory!");
             }
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Got fit");
-            std::vector<lanelet::BasicPoint2d> all_sampling_points;
-            all_sampling_points.reserve(1 + future_geom_points.size() * 2);
 
             lanelet::BasicPoint2d current_vehicle_point(state.x_pos_global, state.y_pos_global);
 
             future_geom_points.insert(future_geom_points.begin(),
                                        current_vehicle_point); // Add current vehicle position to front of future geometry points
 
-            final_actual_speeds.insert(final_actual_speeds.begin(), state.longitudinal_vel);
+            speed_limits.insert(speed_limits.begin(), state.longitudinal_vel);
 
             //Compute points to local downtracks
-            std::vector<double> downtracks = carma_wm::geometry::compute_arc_lengths(future_geom_points);
+            auto& downtracks = workspace.downtracks;
+            compute_arc_lengths(future_geom_points, &downtracks);
 
             auto total_step_along_curve = static_cast<int>(downtracks.back() /detailed_config.curve_resample_step_size);
 
+            auto& all_sampling_points = workspace.sampling_points;
+            all_sampling_points.clear();
+            all_sampling_points.reserve(total_step_along_curve + 1);
+
             double scaled_steps_along_curve = 0.0; //from 0 (start) to 1 (end) for the whole trajectory
 
             for(int steps_along_curve = 0; steps_along_curve < total_step_along_curve; steps_along_curve++){
@@ -1161,7 +1229,8 @@ namespace basic_autonomy
                 final_yaw_values[0] = state.orientation; // Set the initial yaw value based on the initial state
             }
 
-            final_actual_speeds = smoothing::moving_average_filter(final_actual_speeds, detailed_config.speed_moving_average_window_size);
+            auto& final_actual_speeds = workspace.speeds;
+            smoothing::moving_average_filter(speed_limits, detailed_config.speed_moving_average_window_size, true, &final_actual_speeds);
 
             //Convert speeds to time
             std::vector<double> times;
@@ -1181,6 +1250,52 @@ namespace basic_autonomy
             return traj_points;
         }
 
+        bool append_terminal_hold(std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint>& points, double hold_duration,
+                                  const std::string& planner_plugin_name)
+        {
+            if (points.empty())
+            {
+                throw std::invalid_argument("Cannot append a terminal hold to an empty trajectory");
+            }
+
+            if (hold_duration <= 0.0)
+            {
+                return false;
+            }
+
+            carma_planning_msgs::msg::TrajectoryPlanPoint hold_point = points.back();
+            hold_point.target_time = rclcpp::Time(hold_point.target_time) + rclcpp::Duration::from_seconds(hold_duration);
+            hold_point.planner_plugin_name = planner_plugin_name;
+            points.push_back(hold_point);
+
+            return true;
+        }
+
+        boost::optional<TerminalHold> get_terminal_hold(const std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint>& points)
+        {
+            for (size_t i = 1; i < points.size(); i++)
+            {
+                const auto& stop_point = points[i - 1];
+                const auto& hold_point = points[i];
+
+                const double duration = (rclcpp::Time(hold_point.target_time) - rclcpp::Time(stop_point.target_time)).seconds();
+
+                if (duration <= 0.0 || std::hypot(hold_point.x - stop_point.x, hold_point.y - stop_point.y) > HOLD_POSITION_EPSILON)
+                {
+                    continue;
+                }
+
+                TerminalHold hold;
+                hold.stop_index = i - 1;
+                hold.position = lanelet::BasicPoint2d(stop_point.x, stop_point.y);
+                hold.duration = duration;
+
+                return hold;
+            }
+
+            return boost::none;
+        }
+
         autoware_auto_msgs::msg::Trajectory process_trajectory_plan(const carma_planning_msgs::msg::TrajectoryPlan& tp, double vehicle_response_lag )
         {
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Processing latest TrajectoryPlan message");
@@ -1192,6 +1307,14 @@ namespace basic_autonomy
 
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Original Trajectory size:"<<trajectory_points.size());
 
+            // The hold point repeats the stop point so only the stop point is passed to the controller
+            auto terminal_hold = get_terminal_hold(trajectory_points);
+            if (terminal_hold)
+            {
+                RCLCPP_DEBUG_STREAM(rclcpp::get_logger(BASIC_AUTONOMY_LOGGER), "Detected a terminal hold of " << terminal_hold->duration
+                                        << "s at index: " << terminal_hold->stop_index);
+                trajectory_points.erase(trajectory_points.begin() + terminal_hold->stop_index + 1);
+            }
 
             trajectory_utils::conversions::trajectory_to_downtrack_time(trajectory_points, &downtracks, &times);
 
@@ -1208,6 +1331,11 @@ namespace basic_autonomy
                 }
             }
 
+            if (stopping_index == 0 && terminal_hold)
+            {
+                stopping_index = terminal_hold->stop_index + 1; // The stop point is commanded to 0
+            }
+
             std::vector<double> speeds;
             try
             {
@@ -14,6 +14,8 @@
  * the License.
  */
 
+#include <algorithm>
+#include <iterator>
 #include <basic_autonomy/helper_functions.hpp>
 
 
@@ -80,6 +82,48 @@ namespace waypoint_generation
         return static_cast<int>(best_index);
     }
 
+    int get_nearest_index_by_downtrack(const std::vector<double>& downtracks, double target_downtrack)
+    {
+        if (downtracks.empty())
+        {
+            return 0;
+        }
+
+        // First downtrack strictly greater than the target, the best index is the one before it
+        auto greater = std::upper_bound(downtracks.begin(), downtracks.end(), target_downtrack);
+        if (greater == downtracks.end())
+        {
+            return static_cast<int>(downtracks.size() - 1);
+        }
+        if (greater == downtracks.begin())
+        {
+            return 0;
+        }
+        return static_cast<int>(std::distance(downtracks.begin(), greater) - 1);
+    }
+
+    double lanechange_lateral_offset_fraction(double progress)
+    {
+        double t = std::min(std::max(progress, 0.0), 1.0);
+        return t * t * t * (10.0 + t * (-15.0 + 6.0 * t));
+    }
+
+    void compute_arc_lengths(const std::vector<lanelet::BasicPoint2d>& points, std::vector<double>* arc_lengths)
+    {
+        arc_lengths->clear();
+        arc_lengths->reserve(points.size());
+
+        double total = 0;
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            if (i > 0)
+            {
+                total += carma_wm::geometry::compute_euclidean_distance(points[i - 1], points[i]);
+            }
+            arc_lengths->push_back(total);
+        }
+    }
+
     void split_point_speed_pairs(const std::vector<PointSpeedPair>& points,
                                                 std::vector<lanelet::BasicPoint2d>* basic_points,
                                                 std::vector<double>* speeds)
@@ -21,23 +21,30 @@ namespace basic_autonomy
 namespace smoothing
 {
 
-std::vector<double> moving_average_filter(const std::vector<double> input, int window_size, bool ignore_first_point)
+std::vector<double> moving_average_filter(const std::vector<double>& input, int window_size, bool ignore_first_point)
+{
+  std::vector<double> output;
+  moving_average_filter(input, window_size, ignore_first_point, &output);
+  return output;
+}
+
+void moving_average_filter(const std::vector<double>& input, int window_size, bool ignore_first_point, std::vector<double>* output)
 {
   if (window_size % 2 == 0) {
     throw std::invalid_argument("moving_average_filter window size must be odd");
   }
 
-  std::vector<double> output;
-  output.reserve(input.size());
+  output->clear();
+  output->reserve(input.size());
 
   if (input.size() == 0) {
-    return output;
+    return;
   }
 
   int start_index = 0;
   if (ignore_first_point) {
     start_index = 1;
-    output.push_back(input[0]);
+    output->push_back(input[0]);
   }
 
   for (int i = start_index; i < static_cast<int>(input.size()); i++) {
@@ -48,16 +55,12 @@ std::vector<double> moving_average_filter(const std::vector<double> input, int w
     int sample_max = std::min((int) input.size() - 1 , i + window_size / 2);
 
     int count = sample_max - sample_min + 1;
-    std::vector<double> sample;
-    sample.reserve(count);
     for (int j = sample_min; j <= sample_max; j++) {
       total += input[j];
     }
-    output.push_back(total / (double) count);
+    output->push_back(total / (double) count);
 
   }
-
-  return output;
 }
 
 }  // namespace smoothing
@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <basic_autonomy/basic_autonomy.hpp>
+#include <basic_autonomy/helper_functions.hpp>
+#include <lanelet2_core/geometry/LineString.h>
+#include <gtest/gtest.h>
+#include <carma_wm/CARMAWorldModel.hpp>
+#include <carma_wm/WMTestLibForGuidance.hpp>
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+namespace basic_autonomy
+{
+
+namespace
+{
+    /**
+     * \brief Lane change geometry made by blending the starting and ending lane centerlines point by point.
+     *        This is how create_lanechange_geometry made lane change points before it used a lateral offset profile.
+     *        It is kept here only as the baseline the current geometry is compared against.
+     */
+    std::vector<lanelet::BasicPoint2d> create_blended_lanechange_geometry(lanelet::Id starting_lane_id, lanelet::Id ending_lane_id, double starting_downtrack, double ending_downtrack,
+                                                                       const carma_wm::WorldModelConstPtr &wm, int downsample_ratio, double buffer_ending_downtrack)
+    {
+        std::vector<lanelet::BasicPoint2d> centerline_points;
+
+        //Get starting lanelet and ending lanelets
+        lanelet::ConstLanelet starting_lanelet = wm->getMap()->laneletLayer.get(starting_lane_id);
+        lanelet::ConstLanelet ending_lanelet = wm->getMap()->laneletLayer.get(ending_lane_id);
+
+        lanelet::ConstLanelets starting_lane;
+        starting_lane.push_back(starting_lanelet);
+
+        std::vector<lanelet::BasicPoint2d> reference_centerline;
+        reference_centerline.reserve(400);
+        bool shared_boundary_found = false;
+        bool is_lanechange_left = false;
+
+        lanelet::BasicLineString2d current_lanelet_centerline = starting_lanelet.centerline2d().basicLineString();
+        lanelet::ConstLanelet current_lanelet = starting_lanelet;
+        reference_centerline.insert(reference_centerline.end(), current_lanelet_centerline.begin(), current_lanelet_centerline.end());
+
+        while(!shared_boundary_found){
+            //Assumption- Adjacent lanelets share lane boundary
+            if(current_lanelet.leftBound() == ending_lanelet.rightBound()){
+                is_lanechange_left = true;
+                shared_boundary_found = true;
+            }
+
+            else if(current_lanelet.rightBound() == ending_lanelet.leftBound()){
+                shared_boundary_found = true;
+            }
+
+            else{
+                if(wm->getMapRoutingGraph()->following(current_lanelet, false).empty())
+                {
+                    throw(std::invalid_argument("No following lanelets from current lanelet reachable without a lane change, incorrectly chosen end lanelet"));
+                }
+
+                current_lanelet = wm->getMapRoutingGraph()->following(current_lanelet, false).front();
+                if(current_lanelet.id() == starting_lanelet.id()){
+                    //Looped back to starting lanelet
+                    throw(std::invalid_argument("No lane change in path"));
+                }
+                auto next_lanelet_centerline = current_lanelet.centerline2d().basicLineString();
+                //Concatenate linestring starting from + 1 to avoid overlap
+                reference_centerline.insert(reference_centerline.end(), next_lanelet_centerline.begin() + 1, next_lanelet_centerline.end());
+                starting_lane.push_back(current_lanelet);
+            }
+        }
+
+        // Create the target lane centerline using lanelets adjacent to the lanechange lanelets in the starting lane
+        std::vector<lanelet::BasicPoint2d> target_lane_centerline;
+        for(size_t i = 0;i<starting_lane.size();++i){
+            lanelet::ConstLanelet curr_end_lanelet;
+
+            if(is_lanechange_left){
+                if(wm->getMapRoutingGraph()->left(starting_lane[i])){
+                    curr_end_lanelet = wm->getMapRoutingGraph()->left(starting_lane[i]).get();
+                }
+                else{
+                    curr_end_lanelet = wm->getMapRoutingGraph()->adjacentLeft(starting_lane[i]).get();
+                }
+            }
+            else{
+                if(wm->getMapRoutingGraph()->right(starting_lane[i])){
+                    curr_end_lanelet = wm->getMapRoutingGraph()->right(starting_lane[i]).get();
+                }
+                else{
+                    curr_end_lanelet = wm->getMapRoutingGraph()->adjacentRight(starting_lane[i]).get();
+                }
+            }
+
+            auto target_lane_linestring = curr_end_lanelet.centerline2d().basicLineString();
+            //Concatenate linestring starting from + 1 to avoid overlap
+            target_lane_centerline.insert(target_lane_centerline.end(), target_lane_linestring.begin() + 1, target_lane_linestring.end());
+        }
+
+        //Downsample centerlines
+        std::vector<lanelet::BasicPoint2d> downsampled_starting_centerline = carma_ros2_utils::containers::downsample_vector(reference_centerline, downsample_ratio);
+        std::vector<lanelet::BasicPoint2d> downsampled_target_centerline = carma_ros2_utils::containers::downsample_vector(target_lane_centerline, downsample_ratio);
+
+        // Constrain centerlines to starting and ending downtrack
+        int start_index_starting_centerline = waypoint_generation::get_nearest_index_by_downtrack(downsampled_starting_centerline, wm, starting_downtrack);
+        carma_planning_msgs::msg::VehicleState start_state;
+        start_state.x_pos_global = downsampled_starting_centerline[start_index_starting_centerline].x();
+        start_state.y_pos_global = downsampled_starting_centerline[start_index_starting_centerline].y();
+        int start_index_target_centerline = waypoint_generation::get_nearest_point_index(downsampled_target_centerline, start_state);
+
+        int end_index_target_centerline = waypoint_generation::get_nearest_index_by_downtrack(downsampled_target_centerline, wm, ending_downtrack);
+        carma_planning_msgs::msg::VehicleState end_state;
+        end_state.x_pos_global = downsampled_target_centerline[end_index_target_centerline].x();
+        end_state.y_pos_global = downsampled_target_centerline[end_index_target_centerline].y();
+        int end_index_starting_centerline = waypoint_generation::get_nearest_point_index(downsampled_starting_centerline, end_state);
+
+        std::vector<lanelet::BasicPoint2d> constrained_start_centerline(downsampled_starting_centerline.begin() + start_index_starting_centerline, downsampled_starting_centerline.begin() + end_index_starting_centerline);
+        std::vector<lanelet::BasicPoint2d> constrained_target_centerline(downsampled_target_centerline.begin() + start_index_target_centerline, downsampled_target_centerline.begin() + end_index_target_centerline);
+
+        // If constrained centerlines are not the same size - resample to ensure same size along both centerlines
+        if(constrained_start_centerline.size() != constrained_target_centerline.size())
+        {
+            auto centerlines = waypoint_generation::resample_linestring_pair_to_same_size(constrained_start_centerline, constrained_target_centerline);
+            constrained_start_centerline = centerlines[0];
+            constrained_target_centerline = centerlines[1];
+        }
+
+        //Create Trajectory geometry
+        double delta_step = 1.0 / constrained_start_centerline.size();
+
+        for (size_t i = 0; i < constrained_start_centerline.size(); ++i)
+        {
+            lanelet::BasicPoint2d current_position;
+            lanelet::BasicPoint2d start_lane_pt = constrained_start_centerline[i];
+            lanelet::BasicPoint2d target_lane_pt = constrained_target_centerline[i];
+            double delta = delta_step * i;
+            current_position.x() = target_lane_pt.x() * delta + (1 - delta) * start_lane_pt.x();
+            current_position.y() = target_lane_pt.y() * delta + (1 - delta) * start_lane_pt.y();
+
+            centerline_points.push_back(current_position);
+        }
+
+        // Add points from the remaining length of the target lanelet to provide sufficient distance for adding buffer
+        double dist_to_target_lane_end = lanelet::geometry::distance2d(centerline_points.back(), downsampled_target_centerline.back());
+        centerline_points.insert(centerline_points.end(), downsampled_target_centerline.begin() + end_index_target_centerline, downsampled_target_centerline.end());
+
+        // If the additional distance from the remaining length of the target lanelet does not provide more than the required
+        // buffer_ending_downtrack, then also add points from the lanelet following the target lanelet
+        if (dist_to_target_lane_end < buffer_ending_downtrack) {
+            auto following_lanelets = wm->getMapRoutingGraph()->following(ending_lanelet, false);
+            if(!following_lanelets.empty()){
+                auto following_lanelet_centerline = following_lanelets.front().centerline2d().basicLineString();
+                centerline_points.insert(centerline_points.end(), following_lanelet_centerline.begin(),
+                                                                            following_lanelet_centerline.end());
+            }
+        }
+
+        return centerline_points;
+    }
+
+    /**
+     * \brief Returns the mean execution time in ms of the provided lane change geometry function over several runs
+     */
+    double mean_execution_time_ms(const std::function<std::vector<lanelet::BasicPoint2d>()>& create_geometry, int runs)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+        size_t point_count = 0;
+        for (int i = 0; i < runs; ++i)
+        {
+            point_count += create_geometry().size();
+        }
+        auto end_time = std::chrono::steady_clock::now();
+
+        EXPECT_GT(point_count, 0u);
+
+        return std::chrono::duration<double, std::milli>(end_time - start_time).count() / runs;
+    }
+}
+
+// Reports the cost of the blended and lateral offset lane change geometry as centerline density increases.
+// Timing is only reported, not asserted, as the result depends on the load of the host.
+TEST(BasicAutonomyTest, lanechange_geometry_benchmark)
+{
+    const int runs = 10;
+
+    for (int segments_per_lanelet : { 10, 100, 1000 })
+    {
+        std::shared_ptr<carma_wm::CARMAWorldModel> wm = std::make_shared<carma_wm::CARMAWorldModel>();
+        wm->setMap(carma_wm::test::buildGuidanceTestMap(3.7, 25, segments_per_lanelet));
+        carma_wm::test::setRouteByIds({ 1200, 1201, 1202, 1203 }, wm);
+
+        double blended_ms = mean_execution_time_ms([&wm]() {
+            return create_blended_lanechange_geometry(1200, 1212, 5.0, 60.0, wm, 1, 5.0);
+        }, runs);
+
+        double lateral_offset_ms = mean_execution_time_ms([&wm]() {
+            return waypoint_generation::create_lanechange_geometry(1200, 1212, 5.0, 60.0, wm, 1, 5.0);
+        }, runs);
+
+        std::cout << "Lane change geometry with " << segments_per_lanelet << " segments per lanelet: blended "
+                  << blended_ms << " ms, lateral offset " << lateral_offset_ms << " ms" << std::endl;
+    }
+}
+
+// The lateral offset geometry follows the same path as the blended geometry. The blend moves across the lane linearly while the
+// lateral offset profile eases in and out, which puts the two paths up to about 15% of the lane width apart mid lane change.
+TEST(BasicAutonomyTest, lanechange_geometry_matches_blended)
+{
+    const double starting_downtrack = 5.0;
+    const double ending_downtrack = 60.0;
+    const double lane_width = 3.7;
+
+    for (int segments_per_lanelet : { 10, 100, 1000 })
+    {
+        std::shared_ptr<carma_wm::CARMAWorldModel> wm = std::make_shared<carma_wm::CARMAWorldModel>();
+        wm->setMap(carma_wm::test::buildGuidanceTestMap(lane_width, 25, segments_per_lanelet));
+        carma_wm::test::setRouteByIds({ 1200, 1201, 1202, 1203 }, wm);
+
+        auto blended = create_blended_lanechange_geometry(1200, 1212, starting_downtrack, ending_downtrack, wm, 1, 5.0);
+
+        std::vector<double> downtracks;
+        auto lateral_offset = waypoint_generation::create_lanechange_geometry(1200, 1212, starting_downtrack, ending_downtrack, wm, 1, 5.0, &downtracks);
+
+        ASSERT_EQ(lateral_offset.size(), downtracks.size());
+
+        lanelet::BasicLineString2d blended_line(blended.begin(), blended.end());
+
+        size_t compared_points = 0;
+        for (size_t i = 0; i < lateral_offset.size(); ++i)
+        {
+            // The blended geometry only starts at the starting downtrack
+            if (downtracks[i] < starting_downtrack)
+            {
+                continue;
+            }
+
+            EXPECT_LT(boost::geometry::distance(lateral_offset[i], blended_line), 0.25 * lane_width)
+                << "Point " << i << " at downtrack " << downtracks[i] << " with " << segments_per_lanelet << " segments per lanelet";
+            ++compared_points;
+        }
+
+        ASSERT_GT(compared_points, 0u);
+
+        // Both end on the ending lane centerline
+        auto ending_point = lateral_offset[waypoint_generation::get_nearest_index_by_downtrack(downtracks, ending_downtrack)];
+        ASSERT_NEAR(1.5 * lane_width, ending_point.x(), 0.1 * lane_width);
+    }
+}
+
+} // basic_autonomy
+
+// Run all the tests
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    //Initialize ROS
+    rclcpp::init(argc, argv);
+
+    bool success = RUN_ALL_TESTS();
+
+    //shutdown ROS
+    rclcpp::shutdown();
+
+    return success;
+}
+
@@ -28,6 +28,7 @@
 #include <lanelet2_core/geometry/LineString.h>
 #include <lanelet2_extension/projection/local_frame_projector.h>
 #include <lanelet2_extension/io/autoware_osm_parser.h>
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <carma_planning_msgs/msg/maneuver.hpp>
@@ -743,6 +744,57 @@ TEST(BasicAutonomyTest, get_nearest_basic_point_index)
         basic_autonomy::waypoint_generation::create_lanechange_geometry(start_id, end_id,starting_downtrack, ending_downtrack, cmw, 1, 5);
     }
 
+    TEST(BasicAutonomyTest, lanechange_geometry_lateral_offset)
+    {
+        // 2.5 m between centerline points
+        std::shared_ptr<carma_wm::CARMAWorldModel> wm = std::make_shared<carma_wm::CARMAWorldModel>();
+        wm->setMap(carma_wm::test::buildGuidanceTestMap(3.7, 25, 10));
+        carma_wm::test::setRouteByIds({ 1200, 1201, 1202, 1203 }, wm);
+
+        // Change from the center of 1200 one lane to the right into 1212 between downtracks 5 and 60
+        std::vector<double> downtracks;
+        auto points = waypoint_generation::create_lanechange_geometry(1200, 1212, 5.0, 60.0, wm, 1, 5.0, &downtracks);
+
+        ASSERT_EQ(points.size(), downtracks.size());
+        ASSERT_FALSE(points.empty());
+        EXPECT_TRUE(std::is_sorted(downtracks.begin(), downtracks.end()));
+
+        EXPECT_NEAR(downtracks.front(), 5.0, 0.0001);
+        EXPECT_NEAR(points.front().x(), 1.85, 0.0001);
+        EXPECT_NEAR(points.front().y(), 5.0, 0.0001);
+
+        int midpoint = waypoint_generation::get_nearest_index_by_downtrack(downtracks, 32.5);
+        EXPECT_NEAR(points[midpoint].x(), 3.7, 0.0001);
+
+        int end = waypoint_generation::get_nearest_index_by_downtrack(downtracks, 60.0);
+        EXPECT_NEAR(points[end].x(), 5.55, 0.0001);
+        EXPECT_NEAR(points[end].y(), 60.0, 0.0001);
+        EXPECT_NEAR(points.back().x(), 5.55, 0.0001);
+        EXPECT_NEAR(points.back().y(), 75.0, 0.0001);
+
+        // A buffer longer than the rest of the starting lane adds the lanelet following the ending lanelet
+        points = waypoint_generation::create_lanechange_geometry(1200, 1212, 5.0, 60.0, wm, 1, 20.0, &downtracks);
+        ASSERT_EQ(points.size(), downtracks.size());
+        EXPECT_NEAR(points.back().x(), 5.55, 0.0001);
+        EXPECT_NEAR(points.back().y(), 100.0, 0.0001);
+        EXPECT_NEAR(downtracks.back(), 100.0, 0.0001);
+    }
+
+    TEST(BasicAutonomyTest, lanechange_lateral_offset_fraction)
+    {
+        EXPECT_NEAR(waypoint_generation::lanechange_lateral_offset_fraction(-1.0), 0.0, 0.0001);
+        EXPECT_NEAR(waypoint_generation::lanechange_lateral_offset_fraction(0.0), 0.0, 0.0001);
+        EXPECT_NEAR(waypoint_generation::lanechange_lateral_offset_fraction(0.5), 0.5, 0.0001);
+        EXPECT_NEAR(waypoint_generation::lanechange_lateral_offset_fraction(1.0), 1.0, 0.0001);
+        EXPECT_NEAR(waypoint_generation::lanechange_lateral_offset_fraction(2.0), 1.0, 0.0001);
+
+        std::vector<double> downtracks = { 0.0, 1.0, 2.0, 3.0 };
+        EXPECT_EQ(waypoint_generation::get_nearest_index_by_downtrack(downtracks, -1.0), 0);
+        EXPECT_EQ(waypoint_generation::get_nearest_index_by_downtrack(downtracks, 1.5), 1);
+        EXPECT_EQ(waypoint_generation::get_nearest_index_by_downtrack(downtracks, 2.0), 2);
+        EXPECT_EQ(waypoint_generation::get_nearest_index_by_downtrack(downtracks, 10.0), 3);
+    }
+
     TEST(BasicAutonomyTest, lanefollow_geometry_visited_lanelets)
     {
 
@@ -898,6 +950,185 @@ TEST(BasicAutonomyTest, get_nearest_basic_point_index)
     }
 */
 
+    TEST(BasicAutonomyTest, terminal_hold)
+    {
+        carma_planning_msgs::msg::TrajectoryPlan tp;
+        tp.initial_longitudinal_velocity = 5.0;
+
+        carma_planning_msgs::msg::TrajectoryPlanPoint point;
+        for (int i = 0; i < 4; i++)
+        {
+            point.x = i * 5.0;
+            point.y = 0.0;
+            point.target_time = rclcpp::Time(i * 1e9);
+            tp.trajectory_points.push_back(point);
+        }
+
+        ASSERT_FALSE(!!waypoint_generation::get_terminal_hold(tp.trajectory_points));
+
+        waypoint_generation::append_terminal_hold(tp.trajectory_points, 10.0, "test_plugin");
+
+        ASSERT_EQ(5u, tp.trajectory_points.size());
+        ASSERT_EQ("test_plugin", tp.trajectory_points.back().planner_plugin_name);
+
+        auto hold = waypoint_generation::get_terminal_hold(tp.trajectory_points);
+        ASSERT_TRUE(!!hold);
+        ASSERT_EQ(3u, hold->stop_index);
+        ASSERT_NEAR(15.0, hold->position.x(), 0.00001);
+        ASSERT_NEAR(10.0, hold->duration, 0.00001);
+
+        // Holds which are not positive are not appended so target times stay strictly increasing
+        std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> short_points = { tp.trajectory_points.front() };
+        ASSERT_FALSE(waypoint_generation::append_terminal_hold(short_points, -1.0, "test_plugin"));
+        ASSERT_FALSE(waypoint_generation::append_terminal_hold(short_points, 0.0, "test_plugin"));
+        ASSERT_EQ(1u, short_points.size());
+        ASSERT_FALSE(!!waypoint_generation::get_terminal_hold(short_points));
+
+        // Repeated points without a time gap are not a hold
+        short_points.push_back(short_points.back());
+        ASSERT_FALSE(!!waypoint_generation::get_terminal_hold(short_points));
+
+        std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> empty_points;
+        ASSERT_THROW(waypoint_generation::append_terminal_hold(empty_points, 1.0, "test_plugin"), std::invalid_argument);
+
+        // The controller trajectory ends at the stop point with zero speed
+        auto traj = waypoint_generation::process_trajectory_plan(tp, 0.0);
+        ASSERT_EQ(4u, traj.points.size());
+        ASSERT_NEAR(15.0, traj.points.back().x, 0.00001);
+        ASSERT_NEAR(0.0, traj.points.back().longitudinal_velocity_mps, 0.00001);
+        ASSERT_GT(traj.points[1].longitudinal_velocity_mps, 0.0);
+
+        // Points after the hold keep the path beyond the stop but are commanded zero speed
+        carma_planning_msgs::msg::TrajectoryPlan geometry_tp = tp;
+        for (int i = 1; i < 3; i++)
+        {
+            point.x = 15.0 + i * 5.0;
+            point.target_time = rclcpp::Time(static_cast<int64_t>((13 + i) * 1e9));
+            geometry_tp.trajectory_points.push_back(point);
+        }
+
+        hold = waypoint_generation::get_terminal_hold(geometry_tp.trajectory_points);
+        ASSERT_TRUE(!!hold);
+        ASSERT_EQ(3u, hold->stop_index);
+        ASSERT_NEAR(10.0, hold->duration, 0.00001);
+
+        traj = waypoint_generation::process_trajectory_plan(geometry_tp, 0.0);
+        ASSERT_EQ(6u, traj.points.size());
+        ASSERT_NEAR(25.0, traj.points.back().x, 0.00001);
+        ASSERT_GT(traj.points[1].longitudinal_velocity_mps, 0.0);
+        for (size_t i = 3; i < traj.points.size(); i++)
+        {
+            ASSERT_NEAR(0.0, traj.points[i].longitudinal_velocity_mps, 0.00001);
+        }
+    }
+
+    TEST(BasicAutonomyTest, lanefollow_trajectory_workspace)
+    {
+        std::shared_ptr<carma_wm::CARMAWorldModel> wm = std::make_shared<carma_wm::CARMAWorldModel>();
+        auto map = carma_wm::test::buildGuidanceTestMap(3.7, 25);
+        wm->setMap(map);
+        carma_wm::test::setRouteByIds({ 1200, 1201, 1202, 1203 }, wm);
+
+        // Points along the center of the first lane
+        std::vector<waypoint_generation::PointSpeedPair> points;
+        for (int i = 0; i <= 100; i++)
+        {
+            waypoint_generation::PointSpeedPair pair;
+            pair.point = lanelet::BasicPoint2d(1.85, i);
+            pair.speed = 10.0;
+            points.push_back(pair);
+        }
+
+        carma_planning_msgs::msg::VehicleState state;
+        state.x_pos_global = 1.85;
+        state.y_pos_global = 5.2;
+        state.orientation = M_PI_2;
+        state.longitudinal_vel = 5.0;
+
+        carma_planning_msgs::msg::VehicleState ending_state;
+        ending_state.x_pos_global = 1.85;
+        ending_state.y_pos_global = 80.0;
+
+        waypoint_generation::DetailedTrajConfig config = waypoint_generation::compose_detailed_trajectory_config(6.0, 1.0, 2.2352, 3.0, 2.5, 5, 9, 20, 20);
+        carma_debug_ros2_msgs::msg::TrajectoryCurvatureSpeeds debug_msg;
+
+        auto expected = waypoint_generation::compose_lanefollow_trajectory_from_path(points, state, rclcpp::Time(0), wm, ending_state, debug_msg, config);
+        ASSERT_GT(expected.size(), 2u);
+
+        waypoint_generation::TrajectoryWorkspace workspace;
+        for (size_t call = 1; call <= 3; call++)
+        {
+            auto traj = waypoint_generation::compose_lanefollow_trajectory_from_path(points, state, rclcpp::Time(0), wm, ending_state, debug_msg, config, workspace);
+
+            ASSERT_EQ(expected.size(), traj.size());
+            for (size_t i = 0; i < traj.size(); i++)
+            {
+                ASSERT_NEAR(expected[i].x, traj[i].x, 0.000001);
+                ASSERT_NEAR(expected[i].y, traj[i].y, 0.000001);
+                ASSERT_NEAR(expected[i].yaw, traj[i].yaw, 0.000001);
+                ASSERT_EQ(rclcpp::Time(expected[i].target_time), rclcpp::Time(traj[i].target_time));
+            }
+
+            // Only the first plan grows the working buffers
+            ASSERT_EQ(call, workspace.calls);
+            ASSERT_EQ(1u, workspace.allocating_calls);
+        }
+
+        ASSERT_GT(workspace.capacity_bytes(), 0u);
+    }
+
+    TEST(BasicAutonomyTest, lanechange_trajectory_workspace)
+    {
+        std::shared_ptr<carma_wm::CARMAWorldModel> wm = std::make_shared<carma_wm::CARMAWorldModel>();
+        auto map = carma_wm::test::buildGuidanceTestMap(3.7, 25);
+        wm->setMap(map);
+        carma_wm::test::setRouteByIds({ 1200, 1201, 1202, 1203 }, wm);
+
+        // Points moving from the center of the first lane to the center of the second lane
+        std::vector<waypoint_generation::PointSpeedPair> points;
+        for (int i = 0; i <= 100; i++)
+        {
+            waypoint_generation::PointSpeedPair pair;
+            pair.point = lanelet::BasicPoint2d(1.85 + 3.7 * std::min(std::max(i - 20, 0), 40) / 40.0, i);
+            pair.speed = 10.0;
+            points.push_back(pair);
+        }
+
+        carma_planning_msgs::msg::VehicleState state;
+        state.x_pos_global = 1.85;
+        state.y_pos_global = 5.2;
+        state.orientation = M_PI_2;
+        state.longitudinal_vel = 5.0;
+
+        carma_planning_msgs::msg::VehicleState ending_state;
+        ending_state.x_pos_global = 5.55;
+        ending_state.y_pos_global = 80.0;
+
+        waypoint_generation::DetailedTrajConfig config = waypoint_generation::compose_detailed_trajectory_config(6.0, 1.0, 2.2352, 3.0, 2.5, 5, 9, 20, 20);
+
+        auto expected = waypoint_generation::compose_lanechange_trajectory_from_path(points, state, rclcpp::Time(0), wm, ending_state, config);
+        ASSERT_GT(expected.size(), 2u);
+
+        waypoint_generation::TrajectoryWorkspace workspace;
+        for (size_t call = 1; call <= 3; call++)
+        {
+            auto traj = waypoint_generation::compose_lanechange_trajectory_from_path(points, state, rclcpp::Time(0), wm, ending_state, config, workspace);
+
+            ASSERT_EQ(expected.size(), traj.size());
+            for (size_t i = 0; i < traj.size(); i++)
+            {
+                ASSERT_NEAR(expected[i].x, traj[i].x, 0.000001);
+                ASSERT_NEAR(expected[i].y, traj[i].y, 0.000001);
+                ASSERT_NEAR(expected[i].yaw, traj[i].yaw, 0.000001);
+                ASSERT_EQ(rclcpp::Time(expected[i].target_time), rclcpp::Time(traj[i].target_time));
+            }
+
+            // Only the first plan grows the working buffers
+            ASSERT_EQ(call, workspace.calls);
+            ASSERT_EQ(1u, workspace.allocating_calls);
+        }
+    }
+
 } // namespace basic_autonomy
 
 // Run all the tests
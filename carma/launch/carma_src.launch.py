@@ -123,6 +123,14 @@ def generate_launch_description():
         description='Flag indicating whether the Guidance Plugin Validator node will actively validate guidance strategic, tactical, and control plugins'
     )
 
+    # Declare enable_realtime_control
+    enable_realtime_control = LaunchConfiguration('enable_realtime_control')
+    declare_enable_realtime_control = DeclareLaunchArgument(
+        name = 'enable_realtime_control',
+        default_value='false',
+        description='Flag indicating whether the trajectory executor and pure pursuit wrapper are run as standalone processes with their real-time profile enabled'
+    )
+
     # Declare strategic_plugins_to_validate
     strategic_plugins_to_validate = LaunchConfiguration('strategic_plugins_to_validate')
     declare_strategic_plugins_to_validate = DeclareLaunchArgument(
@@ -276,6 +284,7 @@ def generate_launch_description():
                     'vehicle_characteristics_param_file' : vehicle_characteristics_param_file,
                     'vehicle_config_param_file' : vehicle_config_param_file,
                     'enable_guidance_plugin_validator' : enable_guidance_plugin_validator,
+                    'enable_realtime_control' : enable_realtime_control,
                     'strategic_plugins_to_validate' : strategic_plugins_to_validate,
                     'tactical_plugins_to_validate' : tactical_plugins_to_validate,
                     'control_plugins_to_validate' : control_plugins_to_validate,
@@ -332,6 +341,7 @@ def generate_launch_description():
         declare_use_sim_time_arg,
         declare_route_file_folder,
         declare_enable_guidance_plugin_validator,
+        declare_enable_realtime_control,
         declare_strategic_plugins_to_validate,
         declare_tactical_plugins_to_validate,
         declare_control_plugins_to_validate,
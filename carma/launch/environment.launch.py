@@ -100,6 +100,7 @@ def generate_launch_description():
 
     cp_multiple_object_tracker_node_file = str(PurePath(get_package_share_directory("carma_cooperative_perception"), "config/cp_multiple_object_tracker_node.yaml"))
     cp_host_vehicle_filter_node_file = str(PurePath(get_package_share_directory("carma_cooperative_perception"), "config/cp_host_vehicle_filter_node.yaml"))
+    cp_sdsm_to_detection_list_node_file = str(PurePath(get_package_share_directory("carma_cooperative_perception"), "config/cp_sdsm_to_detection_list_node.yaml"))
 
     # lidar_perception_container contains all nodes for lidar based object perception
     # a failure in any one node in the chain would invalidate the rest of it, so they can all be
@@ -489,6 +490,7 @@ def generate_launch_description():
                     ("output/detections", "full_detection_list"),
                 ],
                 parameters=[
+                    cp_sdsm_to_detection_list_node_file,
                     vehicle_config_param_file
                 ]
             ),
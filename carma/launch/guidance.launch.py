@@ -32,6 +32,7 @@ from launch.actions import GroupAction
 from launch_ros.actions import set_remap
 from launch.actions import DeclareLaunchArgument
 from launch_ros.actions import PushRosNamespace
+from launch.conditions import IfCondition, UnlessCondition
 
 
 # Launch file for launching the nodes in the CARMA guidance stack
@@ -42,6 +43,12 @@ def generate_launch_description():
     vehicle_calibration_dir = LaunchConfiguration('vehicle_calibration_dir')
     vehicle_characteristics_param_file = LaunchConfiguration('vehicle_characteristics_param_file')
     enable_guidance_plugin_validator = LaunchConfiguration('enable_guidance_plugin_validator')
+    enable_realtime_control = LaunchConfiguration('enable_realtime_control')
+    declare_enable_realtime_control = DeclareLaunchArgument(
+        name = 'enable_realtime_control',
+        default_value = 'false',
+        description = 'Flag indicating whether the trajectory executor and pure pursuit wrapper are run as standalone processes with their real-time profile enabled'
+    )
     strategic_plugins_to_validate = LaunchConfiguration('strategic_plugins_to_validate')
     tactical_plugins_to_validate = LaunchConfiguration('tactical_plugins_to_validate')
     control_plugins_to_validate = LaunchConfiguration('control_plugins_to_validate')
@@ -162,6 +169,7 @@ def generate_launch_description():
                     ("current_pose", [ EnvironmentVariable('CARMA_LOCZ_NS', default_value=''), "/current_pose" ] ),
                     ("vehicle_status", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/vehicle_status" ] ),
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -175,51 +183,87 @@ def generate_launch_description():
         ]
     )
 
+    route_node = ComposableNode(
+        package='route',
+        plugin='route::Route',
+        name='route_node',
+        extra_arguments=[
+            {'use_intra_process_comms': True},
+            {'--log-level' : GetLogLevel('route', env_log_levels) }
+        ],
+        remappings = [
+            ("current_velocity", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/vehicle/twist" ] ),
+            ("current_pose", [ EnvironmentVariable('CARMA_LOCZ_NS', default_value=''), "/current_pose" ] ),
+            ("georeference", [ EnvironmentVariable('CARMA_LOCZ_NS', default_value=''), "/map_param_loader/georeference" ] ),
+            ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+            ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
+            ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
+            ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
+            ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] )
+        ],
+        parameters=[
+            {'route_file_path': route_file_folder},
+            route_param_file,
+            vehicle_config_param_file
+        ]
+    )
+
+    trajectory_executor_node = ComposableNode(
+        package='trajectory_executor',
+        plugin='trajectory_executor::TrajectoryExecutor',
+        name='trajectory_executor_node',
+        extra_arguments=[
+            {'use_intra_process_comms': True},
+            {'--log-level' : GetLogLevel('trajectory_executor', env_log_levels) }
+        ],
+        remappings = [
+            ("trajectory", "plan_trajectory"),
+        ],
+        parameters=[
+            trajectory_executor_param_file,
+            vehicle_config_param_file
+        ]
+    )
+
     carma_trajectory_executor_and_route_container = ComposableNodeContainer(
         package='carma_ros2_utils',
         name='carma_trajectory_executor_and_route_container',
         executable='carma_component_container_mt',
         namespace=GetCurrentNamespace(),
         composable_node_descriptions=[
-            ComposableNode(
-                package='route',
-                plugin='route::Route',
-                name='route_node',
-                extra_arguments=[
-                    {'use_intra_process_comms': True},
-                    {'--log-level' : GetLogLevel('route', env_log_levels) }
-                ],
-                remappings = [
-                    ("current_velocity", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/vehicle/twist" ] ),
-                    ("georeference", [ EnvironmentVariable('CARMA_LOCZ_NS', default_value=''), "/map_param_loader/georeference" ] ),
-                    ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
-                    ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
-                    ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
-                    ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] )
-                ],
-                parameters=[
-                    {'route_file_path': route_file_folder},
-                    route_param_file,
-                    vehicle_config_param_file
-                ]
-            ),
-            ComposableNode(
-                package='trajectory_executor',
-                plugin='trajectory_executor::TrajectoryExecutor',
-                name='trajectory_executor_node',
-                extra_arguments=[
-                    {'use_intra_process_comms': True},
-                    {'--log-level' : GetLogLevel('trajectory_executor', env_log_levels) }
-                ],
-                remappings = [
-                    ("trajectory", "plan_trajectory"),
-                ],
-                parameters=[
-                    trajectory_executor_param_file,
-                    vehicle_config_param_file
-                ]
-            )
-        ]
+            route_node,
+            trajectory_executor_node
+        ],
+        condition=UnlessCondition(enable_realtime_control)
+    )
+
+    # With real-time control enabled the trajectory executor runs in its own process, as the real-time profile
+    # is only applied by the standalone executable
+    carma_route_container = ComposableNodeContainer(
+        package='carma_ros2_utils',
+        name='carma_route_container',
+        executable='carma_component_container_mt',
+        namespace=GetCurrentNamespace(),
+        composable_node_descriptions=[
+            route_node
+        ],
+        condition=IfCondition(enable_realtime_control)
+    )
+
+    realtime_trajectory_executor = Node(
+        package='trajectory_executor',
+        name='trajectory_executor_node',
+        executable='trajectory_executor_node_exec',
+        remappings = [
+            ("trajectory", "plan_trajectory"),
+        ],
+        parameters=[
+            trajectory_executor_param_file,
+            vehicle_config_param_file,
+            {'realtime_profile.enabled': True}
+        ],
+        arguments=['--ros-args', '--log-level', GetLogLevel('trajectory_executor', env_log_levels)],
+        condition=IfCondition(enable_realtime_control)
     )
 
     carma_arbitrator_container = ComposableNodeContainer(
@@ -240,6 +284,7 @@ def generate_launch_description():
                     ("current_velocity", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/vehicle/twist" ] ),
                     ("guidance_state", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/state" ] ),
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] )
@@ -376,6 +421,7 @@ def generate_launch_description():
                     'vehicle_characteristics_param_file' : vehicle_characteristics_param_file,
                     'vehicle_config_param_file' : vehicle_config_param_file,
                     'enable_guidance_plugin_validator' : enable_guidance_plugin_validator,
+                    'enable_realtime_control' : enable_realtime_control,
                     'strategic_plugins_to_validate' : strategic_plugins_to_validate,
                     'tactical_plugins_to_validate' : tactical_plugins_to_validate,
                     'control_plugins_to_validate' : control_plugins_to_validate,
@@ -394,6 +440,15 @@ def generate_launch_description():
             subsystem_controller_default_param_file,
             subsystem_controller_param_file,
             {"use_sim_time" : use_sim_time}],
+        remappings = [
+            ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+            ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
+            ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
+            ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
+            ("incoming_bsm", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_bsm" ] ),
+            ("incoming_mobility_request", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_mobility_request" ] ),
+            ("incoming_mobility_operation", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_mobility_operation" ] )
+        ],
         on_exit= Shutdown(), # Mark the subsystem controller as required
         arguments=['--ros-args', '--log-level', GetLogLevel('subsystem_controllers', env_log_levels)]
     )
@@ -402,7 +457,10 @@ def generate_launch_description():
         declare_vehicle_config_param_file_arg,
         declare_use_sim_time_arg,
         declare_subsystem_controller_param_file_arg,
+        declare_enable_realtime_control,
         carma_trajectory_executor_and_route_container,
+        carma_route_container,
+        realtime_trajectory_executor,
         carma_guidance_visualizer_container,
         carma_guidance_worker_container,
         carma_plan_delegator_container,
@@ -52,6 +52,9 @@ def generate_launch_description():
     bsm_generator_param_file = os.path.join(
         get_package_share_directory('bsm_generator'), 'config/parameters.yaml')
 
+    v2x_scheduler_param_file = os.path.join(
+        get_package_share_directory('v2x_scheduler'), 'config/parameters.yaml')
+
     vehicle_characteristics_param_file = LaunchConfiguration('vehicle_characteristics_param_file')
     declare_vehicle_characteristics_param_file_arg = DeclareLaunchArgument(
         name = 'vehicle_characteristics_param_file',
@@ -155,9 +158,25 @@ def generate_launch_description():
                 ],
                 remappings=[
                     ("inbound_binary_msg", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/comms/inbound_binary_msg" ] ),
+                    ("outbound_binary_msg", "unscheduled_outbound_binary_msg" ), # Outbound messages are budgeted by the v2x_scheduler before reaching the radio
+                ],
+                parameters=[
+                    vehicle_config_param_file
+                ]
+            ),
+            ComposableNode(
+                package='v2x_scheduler',
+                plugin='v2x_scheduler::V2XScheduler',
+                name='v2x_scheduler_node',
+                extra_arguments=[
+                    {'use_intra_process_comms': True},
+                    {'--log-level' : GetLogLevel('v2x_scheduler', env_log_levels) }
+                ],
+                remappings=[
                     ("outbound_binary_msg", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/comms/outbound_binary_msg" ] ),
                 ],
                 parameters=[
+                    v2x_scheduler_param_file,
                     vehicle_config_param_file
                 ]
             ),
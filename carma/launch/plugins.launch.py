@@ -30,6 +30,7 @@ from launch.launch_description_sources import PythonLaunchDescriptionSource
 from launch.actions import GroupAction
 from launch_ros.actions import set_remap
 from launch.actions import DeclareLaunchArgument
+from launch.conditions import IfCondition, UnlessCondition
 
 # Launch file for launching the nodes in the CARMA guidance stack
 
@@ -39,6 +40,12 @@ def generate_launch_description():
     vehicle_calibration_dir = LaunchConfiguration('vehicle_calibration_dir')
     vehicle_characteristics_param_file = LaunchConfiguration('vehicle_characteristics_param_file')
     enable_guidance_plugin_validator = LaunchConfiguration('enable_guidance_plugin_validator')
+    enable_realtime_control = LaunchConfiguration('enable_realtime_control')
+    declare_enable_realtime_control = DeclareLaunchArgument(
+        name = 'enable_realtime_control',
+        default_value = 'false',
+        description = 'Flag indicating whether the pure pursuit wrapper is run as a standalone process with its real-time profile enabled'
+    )
     strategic_plugins_to_validate = LaunchConfiguration('strategic_plugins_to_validate')
     tactical_plugins_to_validate = LaunchConfiguration('tactical_plugins_to_validate')
     control_plugins_to_validate = LaunchConfiguration('control_plugins_to_validate')
@@ -106,6 +113,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -137,6 +145,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -144,6 +153,8 @@ def generate_launch_description():
                     ("route", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/route" ] ),
                     ("current_velocity", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/vehicle/twist" ] ),
                     ("maneuver_plan", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/final_maneuver_plan" ] ),
+                    ("front_bumper_pose", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/front_bumper_pose" ] ),
+                    ("route_state", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/route_state" ] ),
                 ],
                 parameters=[
                     route_following_plugin_file_path,
@@ -170,6 +181,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -211,6 +223,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -241,6 +254,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -276,6 +290,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -311,6 +326,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -341,6 +357,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -379,6 +396,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("external_object_predictions", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/external_object_predictions" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -414,6 +432,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -428,6 +447,20 @@ def generate_launch_description():
         ]
     )
 
+    pure_pursuit_wrapper_remappings = [
+        ("plugin_discovery", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/plugin_discovery" ] ),
+        ("ctrl_raw", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/ctrl_raw" ] ),
+        ("pure_pursuit_wrapper/plan_trajectory", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/plugins/pure_pursuit/plan_trajectory" ] ),
+        ("current_pose", [ EnvironmentVariable('CARMA_LOCZ_NS', default_value=''), "/current_pose" ] ),
+        ("vehicle/twist", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/vehicle/twist" ] ),
+    ]
+
+    pure_pursuit_wrapper_parameters = [
+        vehicle_characteristics_param_file, #vehicle_response_lag
+        pure_pursuit_tuning_parameters, #pure_pursuit calibration parameters
+        vehicle_config_param_file
+    ]
+
     carma_pure_pursuit_wrapper_container = ComposableNodeContainer(
         package='carma_ros2_utils',
         name='carma_pure_pursuit_wrapper_container',
@@ -442,20 +475,22 @@ def generate_launch_description():
                     {'use_intra_process_comms': True},
                     {'--log-level' : GetLogLevel('pure_pursuit_wrapper', env_log_levels) }
                 ],
-                remappings = [
-                    ("plugin_discovery", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/plugin_discovery" ] ),
-                    ("ctrl_raw", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/ctrl_raw" ] ),
-                    ("pure_pursuit_wrapper/plan_trajectory", [ EnvironmentVariable('CARMA_GUIDE_NS', default_value=''), "/plugins/pure_pursuit/plan_trajectory" ] ),
-                    ("current_pose", [ EnvironmentVariable('CARMA_LOCZ_NS', default_value=''), "/current_pose" ] ),
-                    ("vehicle/twist", [ EnvironmentVariable('CARMA_INTR_NS', default_value=''), "/vehicle/twist" ] ),
-                ],
-                parameters=[
-                    vehicle_characteristics_param_file, #vehicle_response_lag
-                    pure_pursuit_tuning_parameters, #pure_pursuit calibration parameters
-                    vehicle_config_param_file
-                ]
+                remappings = pure_pursuit_wrapper_remappings,
+                parameters = pure_pursuit_wrapper_parameters
             ),
-        ]
+        ],
+        condition=UnlessCondition(enable_realtime_control)
+    )
+
+    # The real-time profile is only applied when the wrapper runs from its own executable
+    realtime_pure_pursuit_wrapper = Node(
+        package='pure_pursuit_wrapper',
+        name='pure_pursuit_wrapper',
+        executable='pure_pursuit_wrapper_node_exec',
+        remappings = pure_pursuit_wrapper_remappings,
+        parameters = pure_pursuit_wrapper_parameters + [ {'realtime_profile.enabled': True} ],
+        arguments=['--ros-args', '--log-level', GetLogLevel('pure_pursuit_wrapper', env_log_levels)],
+        condition=IfCondition(enable_realtime_control)
     )
 
     platooning_strategic_plugin_container = ComposableNodeContainer(
@@ -474,6 +509,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("georeference", [ EnvironmentVariable('CARMA_LOCZ_NS', default_value=''), "/map_param_loader/georeference" ] ),
@@ -515,6 +551,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("georeference", [ EnvironmentVariable('CARMA_LOCZ_NS', default_value=''), "/map_param_loader/georeference" ] ),
@@ -543,6 +580,7 @@ def generate_launch_description():
                 ],
                 remappings = [
                     ("semantic_map", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map" ] ),
+                    ("semantic_map_corridor", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/semantic_map_corridor" ] ),
                     ("map_update", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/map_update" ] ),
                     ("roadway_objects", [ EnvironmentVariable('CARMA_ENV_NS', default_value=''), "/roadway_objects" ] ),
                     ("incoming_spat", [ EnvironmentVariable('CARMA_MSG_NS', default_value=''), "/incoming_spat" ] ),
@@ -583,6 +621,7 @@ def generate_launch_description():
     )
 
     return LaunchDescription([
+        declare_enable_realtime_control,
         carma_inlanecruising_plugin_container,
         carma_route_following_plugin_container,
         carma_approaching_emergency_vehicle_plugin_container,
@@ -595,6 +634,7 @@ def generate_launch_description():
         carma_yield_plugin_container,
         carma_light_controlled_intersection_plugins_container,
         carma_pure_pursuit_wrapper_container,
+        realtime_pure_pursuit_wrapper,
         #platooning_strategic_plugin_container,
         platooning_tactical_plugin_container,
         intersection_transit_maneuvering_container
@@ -0,0 +1,58 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CARMA_COOPERATIVE_PERCEPTION__DIAGNOSTICS_HPP_
+#define CARMA_COOPERATIVE_PERCEPTION__DIAGNOSTICS_HPP_
+
+#include <diagnostic_msgs/msg/diagnostic_status.hpp>
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace carma_cooperative_perception
+{
+/**
+ * @brief Period at which nodes publish their counters on their diagnostics topic
+ */
+inline constexpr std::chrono::seconds kDiagnosticsPeriod{1};
+
+/**
+ * @brief Append a key-value pair to a diagnostic status
+ *
+ * Arithmetic values are converted with std::to_string; anything else must be convertible to
+ * std::string.
+ */
+template <typename Value>
+auto add_diagnostic_value(
+  diagnostic_msgs::msg::DiagnosticStatus & status, const std::string & key, const Value & value)
+  -> void
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+
+  if constexpr (std::is_arithmetic_v<Value>) {
+    key_value.value = std::to_string(value);
+  } else {
+    key_value.value = value;
+  }
+
+  status.values.push_back(std::move(key_value));
+}
+
+}  // namespace carma_cooperative_perception
+
+#endif  // CARMA_COOPERATIVE_PERCEPTION__DIAGNOSTICS_HPP_
@@ -17,9 +17,15 @@
 
 #include <carma_cooperative_perception_interfaces/msg/detection_list.hpp>
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <cstddef>
+#include <optional>
+
+#include "carma_cooperative_perception/host_vehicle_footprint.hpp"
+
 namespace carma_cooperative_perception
 {
 
@@ -48,6 +54,23 @@ public:
   auto attempt_filter_and_republish(carma_cooperative_perception_interfaces::msg::DetectionList msg)
     -> void;
 
+  /**
+   * @brief Publish the suppressed and unaligned detection counters on the diagnostics topic
+   *
+   * The status level is WARN if detections passed through unfiltered since the previous report.
+   */
+  auto publish_diagnostics() -> void;
+
+  auto get_suppressed_detection_count() const noexcept -> std::size_t
+  {
+    return suppressed_detection_count_;
+  }
+
+  auto get_unaligned_detection_count() const noexcept -> std::size_t
+  {
+    return unaligned_detection_count_;
+  }
+
 private:
   rclcpp::Subscription<carma_cooperative_perception_interfaces::msg::DetectionList>::SharedPtr
     detection_list_sub_{nullptr};
@@ -58,15 +81,33 @@ private:
     carma_cooperative_perception_interfaces::msg::DetectionList>::SharedPtr detection_list_pub_{
     nullptr};
 
-  std::optional<geometry_msgs::msg::PoseStamped> host_vehicle_pose_{std::nullopt};
+  rclcpp_lifecycle::LifecyclePublisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr
+    diagnostics_pub_{nullptr};
+
+  rclcpp::TimerBase::SharedPtr diagnostics_timer_{nullptr};
+
+  HostPoseHistory host_vehicle_pose_history_{
+    units::time::second_t{1.0}, units::time::second_t{0.2}};
 
   OnSetParametersCallbackHandle::SharedPtr on_set_parameters_callback_{nullptr};
 
   double squared_distance_threshold_meters_{0.0};
+
+  VehicleFootprint footprint_;
+
+  double squared_covariance_gate_{0.0};
+
+  std::size_t suppressed_detection_count_{0U};
+  std::size_t unaligned_detection_count_{0U};
+
+  // Count at the previous diagnostics report, used to tell whether new problems occurred since
+  std::size_t reported_unaligned_detection_count_{0U};
 };
 
-auto euclidean_distance_squared(
-  const geometry_msgs::msg::Pose & a, const geometry_msgs::msg::Pose & b) -> double;
+/**
+ * @brief Squared distance between two positions in the map plane
+ */
+auto planar_distance_squared(const PlanarPose & a, const geometry_msgs::msg::Point & b) -> double;
 
 }  // namespace carma_cooperative_perception
 
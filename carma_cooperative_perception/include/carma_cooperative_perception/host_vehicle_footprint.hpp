@@ -0,0 +1,128 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CARMA_COOPERATIVE_PERCEPTION__HOST_VEHICLE_FOOTPRINT_HPP_
+#define CARMA_COOPERATIVE_PERCEPTION__HOST_VEHICLE_FOOTPRINT_HPP_
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/pose_with_covariance.hpp>
+#include <units.h>
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <optional>
+
+namespace carma_cooperative_perception
+{
+
+/**
+ * @brief Position and heading of the host vehicle in the map plane
+ */
+struct PlanarPose
+{
+  double x{0.0};
+  double y{0.0};
+  double yaw{0.0};
+};
+
+auto to_planar_pose(const geometry_msgs::msg::Pose & pose) -> PlanarPose;
+
+/**
+ * @brief Short, time-ordered history of host vehicle poses used to look up the host pose at a
+ * detection's timestamp
+ *
+ * Poses older than max_age before the newest pose are discarded. Lookups between two poses are
+ * linearly interpolated (shortest-arc for heading). Lookups outside the history are extrapolated
+ * by at most max_extrapolation: forward using the velocity between the two newest poses and
+ * backward by holding the oldest pose.
+ */
+class HostPoseHistory
+{
+public:
+  struct Sample
+  {
+    units::time::second_t stamp;
+    PlanarPose pose;
+  };
+
+  HostPoseHistory(units::time::second_t max_age, units::time::second_t max_extrapolation)
+  : max_age_{max_age}, max_extrapolation_{max_extrapolation}
+  {
+  }
+
+  auto set_max_age(units::time::second_t max_age) -> void
+  {
+    max_age_ = max_age;
+    prune();
+  }
+
+  auto set_max_extrapolation(units::time::second_t max_extrapolation) noexcept -> void
+  {
+    max_extrapolation_ = max_extrapolation;
+  }
+
+  auto clear() noexcept -> void { samples_.clear(); }
+
+  auto empty() const noexcept -> bool { return samples_.empty(); }
+
+  auto size() const noexcept -> std::size_t { return std::size(samples_); }
+
+  /**
+   * @brief Add a pose. Poses may arrive slightly out of order; a pose with the same stamp as a
+   * buffered one replaces it.
+   */
+  auto insert(units::time::second_t stamp, const PlanarPose & pose) -> void;
+
+  /**
+   * @brief Host pose at the given time, or std::nullopt if the time is further than
+   * max_extrapolation outside the history
+   */
+  auto pose_at(units::time::second_t stamp) const -> std::optional<PlanarPose>;
+
+private:
+  auto prune() -> void;
+
+  units::time::second_t max_age_;
+  units::time::second_t max_extrapolation_;
+  std::deque<Sample> samples_;
+};
+
+/**
+ * @brief Rectangular host vehicle outline
+ *
+ * center_offset is the distance from the pose origin to the rectangle center along the vehicle's
+ * heading. CARMA host poses are given at base_link, which is behind the vehicle center.
+ */
+struct VehicleFootprint
+{
+  double length{0.0};
+  double width{0.0};
+  double center_offset{0.0};
+};
+
+/**
+ * @brief Squared Mahalanobis distance from a detection to the closest point of the host footprint
+ *
+ * Uses the planar (x, y) block of the detection's position covariance. Returns zero if the
+ * detection lies inside the footprint and infinity if it lies outside and its covariance is
+ * degenerate.
+ */
+auto footprint_mahalanobis_distance_squared(
+  const PlanarPose & host_pose, const VehicleFootprint & footprint,
+  const geometry_msgs::msg::PoseWithCovariance & detection_pose) -> double;
+
+}  // namespace carma_cooperative_perception
+
+#endif  // CARMA_COOPERATIVE_PERCEPTION__HOST_VEHICLE_FOOTPRINT_HPP_
@@ -0,0 +1,175 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CARMA_COOPERATIVE_PERCEPTION__MEASUREMENT_HISTORY_HPP_
+#define CARMA_COOPERATIVE_PERCEPTION__MEASUREMENT_HISTORY_HPP_
+
+#include <units.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace carma_cooperative_perception
+{
+
+/**
+ * @brief Bounded, time-ordered history of tracking cycles used to fuse out-of-sequence measurements
+ *
+ * Each cycle covers the measurement times (start_time, end_time] and remembers the tracker state
+ * from before the cycle ran along with the measurements it consumed. A measurement that arrives
+ * after its cycle already ran is inserted into that cycle, after which the caller can restore the
+ * cycle's state and replay it and every later cycle. Cycles that end more than max_lateness before
+ * the newest cycle are discarded, so measurements older than that can no longer be fused.
+ *
+ * At most max_cycles cycles are kept, which bounds both the number of stored states and the number
+ * of cycles a replay has to re-run. A measurement that is within max_lateness but older than every
+ * kept cycle goes into the oldest kept cycle instead.
+ *
+ * @tparam Measurement Measurement type stored in each cycle
+ * @tparam State Tracker state snapshot type
+ */
+template <typename Measurement, typename State>
+class MeasurementHistory
+{
+public:
+  struct Cycle
+  {
+    units::time::second_t start_time;
+    units::time::second_t end_time;
+    State state_before;
+    std::vector<Measurement> measurements;
+  };
+
+  explicit MeasurementHistory(units::time::second_t max_lateness, std::size_t max_cycles = 5U)
+  : max_lateness_{max_lateness}, max_cycles_{std::max(max_cycles, std::size_t{1U})}
+  {
+  }
+
+  auto set_max_lateness(units::time::second_t max_lateness) -> void
+  {
+    max_lateness_ = max_lateness;
+    prune();
+  }
+
+  auto get_max_lateness() const noexcept -> units::time::second_t { return max_lateness_; }
+
+  /**
+   * @brief Set the number of cycles kept. At least one cycle is always kept.
+   */
+  auto set_max_cycles(std::size_t max_cycles) -> void
+  {
+    max_cycles_ = std::max(max_cycles, std::size_t{1U});
+    prune();
+  }
+
+  auto get_max_cycles() const noexcept -> std::size_t { return max_cycles_; }
+
+  auto clear() noexcept -> void { cycles_.clear(); }
+
+  auto empty() const noexcept -> bool { return cycles_.empty(); }
+
+  auto size() const noexcept -> std::size_t { return std::size(cycles_); }
+
+  auto at(std::size_t index) -> Cycle & { return cycles_.at(index); }
+
+  auto at(std::size_t index) const -> const Cycle & { return cycles_.at(index); }
+
+  /**
+   * @brief End time of the most recent cycle, or std::nullopt if there is no history
+   */
+  auto latest_time() const -> std::optional<units::time::second_t>
+  {
+    if (cycles_.empty()) {
+      return std::nullopt;
+    }
+
+    return cycles_.back().end_time;
+  }
+
+  /**
+   * @brief Append a cycle and discard cycles that fell out of the lateness window
+   *
+   * A cycle that ends before the current latest cycle (e.g., the clock was reset) invalidates the
+   * whole history, since the stored states no longer precede the new cycle.
+   */
+  auto add_cycle(Cycle cycle) -> void
+  {
+    if (!cycles_.empty() && cycle.end_time < cycles_.back().end_time) {
+      cycles_.clear();
+    }
+
+    cycles_.push_back(std::move(cycle));
+    prune();
+  }
+
+  /**
+   * @brief Insert a measurement into the cycle covering its timestamp
+   *
+   * Measurements older than the oldest kept cycle but within max_lateness of the newest cycle are
+   * inserted into the oldest kept cycle.
+   *
+   * @return Index of the cycle that received the measurement, or std::nullopt if the measurement
+   * is newer than every cycle or older than max_lateness (i.e., too old to fuse)
+   */
+  auto insert(Measurement measurement, units::time::second_t stamp) -> std::optional<std::size_t>
+  {
+    if (cycles_.empty()) {
+      return std::nullopt;
+    }
+
+    if (stamp <= cycles_.front().start_time && stamp >= cycles_.back().end_time - max_lateness_) {
+      cycles_.front().measurements.push_back(std::move(measurement));
+      return 0U;
+    }
+
+    for (std::size_t i{0U}; i < std::size(cycles_); ++i) {
+      auto & cycle{cycles_.at(i)};
+      if (stamp > cycle.start_time && stamp <= cycle.end_time) {
+        cycle.measurements.push_back(std::move(measurement));
+        return i;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+private:
+  auto prune() -> void
+  {
+    if (cycles_.empty()) {
+      return;
+    }
+
+    const auto oldest_allowed{cycles_.back().end_time - max_lateness_};
+    while (std::size(cycles_) > 1U && cycles_.front().end_time < oldest_allowed) {
+      cycles_.pop_front();
+    }
+
+    while (std::size(cycles_) > max_cycles_) {
+      cycles_.pop_front();
+    }
+  }
+
+  units::time::second_t max_lateness_;
+  std::size_t max_cycles_;
+  std::deque<Cycle> cycles_;
+};
+
+}  // namespace carma_cooperative_perception
+
+#endif  // CARMA_COOPERATIVE_PERCEPTION__MEASUREMENT_HISTORY_HPP_
@@ -38,6 +38,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace carma_cooperative_perception
 {
@@ -103,6 +104,28 @@ auto to_external_object_list_msg(
   const carma_cooperative_perception_interfaces::msg::TrackList & track_list)
   -> carma_perception_msgs::msg::ExternalObjectList;
 
+struct TrackPredictionSettings
+{
+  units::time::second_t time_step{0.1};
+  units::time::second_t period{2.0};
+
+  // Sum of the position variances at which the prediction confidence reaches zero
+  double process_noise_max{1000.0};
+};
+
+/**
+ * @brief Propagate a track forward in time with the track's own motion model
+ *
+ * Predictions start one time step after the track's timestamp. Each prediction's
+ * confidence decreases linearly with the propagated position variance.
+ *
+ * @throws std::runtime_error if the track's motion model is not supported
+*/
+auto to_predicted_states(
+  const carma_cooperative_perception_interfaces::msg::Track & track,
+  const TrackPredictionSettings & settings)
+  -> std::vector<carma_perception_msgs::msg::PredictedState>;
+
 auto to_sdsm_msg(
   const carma_perception_msgs::msg::ExternalObjectList & external_object_list,
   const geometry_msgs::msg::PoseStamped & current_pose,
@@ -21,23 +21,31 @@
 #include <carma_cooperative_perception_interfaces/msg/detection_list.hpp>
 #include <carma_cooperative_perception_interfaces/msg/track_list.hpp>
 
+#include "carma_cooperative_perception/measurement_history.hpp"
+#include "carma_cooperative_perception/tracking_types.hpp"
+
 #include <multiple_object_tracking/ctra_model.hpp>
 #include <multiple_object_tracking/ctrv_model.hpp>
 #include <multiple_object_tracking/track_management.hpp>
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
 #include <variant>
 #include <vector>
 
 namespace carma_cooperative_perception
 {
 
-using Detection =
-  std::variant<multiple_object_tracking::CtrvDetection, multiple_object_tracking::CtraDetection>;
-using Track =
-  std::variant<multiple_object_tracking::CtrvTrack, multiple_object_tracking::CtraTrack>;
-
-auto make_detection(const carma_cooperative_perception_interfaces::msg::Detection & msg)
-  -> Detection;
+/**
+ * @brief Snapshot of the tracks a tracking cycle modifies, so the tracker can rewind and replay
+ * cycles when an out-of-sequence detection arrives
+ *
+ * The track handle counter is deliberately not part of the snapshot. It keeps increasing across
+ * replays so a handle that has already been published is never given to a different object.
+*/
+struct TrackerState
+{
+  multiple_object_tracking::FixedThresholdTrackManager<Track> track_manager;
+};
 
 class MultipleObjectTrackerNode : public carma_ros2_utils::CarmaLifecycleNode
 {
@@ -64,7 +72,47 @@ public:
 
   auto execute_pipeline() -> void;
 
+  /**
+   * @brief Run one pipeline cycle ending at the given time instead of the node clock's time
+   *
+   * Lets callers such as benchmarks drive the tracker in-process on a synthetic timeline. The
+   * track list is only published once the node has been configured.
+  */
+  auto execute_pipeline(units::time::second_t current_time) -> void;
+
+  auto get_confirmed_tracks() const -> std::vector<Track>
+  {
+    return track_manager_.get_confirmed_tracks();
+  }
+
+  auto get_late_measurement_count() const noexcept -> std::size_t
+  {
+    return late_measurement_count_;
+  }
+
+  auto get_dropped_measurement_count() const noexcept -> std::size_t
+  {
+    return dropped_measurement_count_;
+  }
+
 private:
+  /**
+   * @brief Create a tentative track from a detection and assign it the next track handle
+   *
+   * The track's UUID is replaced by the decimal representation of a monotonically increasing
+   * handle. The handle stays with the track for its entire lifetime, so it can be used as a
+   * stable numeric object ID downstream.
+  */
+  auto make_tentative_track(const Detection & detection) -> Track;
+
+  /**
+   * @brief Associate and fuse one cycle's detections after aligning them to the cycle's end time
+   *
+   * Detections that share a UUID are reduced to the most recent one before association.
+  */
+  auto run_tracking_cycle(
+    const std::vector<Detection> & cycle_detections, units::time::second_t time) -> void;
+
   rclcpp::Subscription<carma_cooperative_perception_interfaces::msg::DetectionList>::SharedPtr
     detection_list_sub_{nullptr};
 
@@ -73,8 +121,18 @@ private:
 
   rclcpp::TimerBase::SharedPtr pipeline_execution_timer_{nullptr};
 
+  // Detections received since the last pipeline execution, in arrival order
   std::vector<Detection> detections_;
-  std::unordered_map<multiple_object_tracking::Uuid, std::size_t> uuid_index_map_;
+
+  // Past cycles kept so detections that arrive after their cycle ran can still be fused at their
+  // own time instead of being extrapolated to the current time. The cycle limit bounds how much
+  // work a single execution spends replaying.
+  MeasurementHistory<Detection, TrackerState> measurement_history_{
+    units::time::millisecond_t{500.0}, 5U};
+  std::size_t late_measurement_count_{0U};
+  std::size_t dropped_measurement_count_{0U};
+
+  std::uint32_t next_track_handle_{1U};
   multiple_object_tracking::FixedThresholdTrackManager<Track> track_manager_{
     multiple_object_tracking::PromotionThreshold{3U},
     multiple_object_tracking::RemovalThreshold{0U}};
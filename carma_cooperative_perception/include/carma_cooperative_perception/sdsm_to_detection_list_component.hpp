@@ -15,19 +15,30 @@
 #ifndef CARMA_COOPERATIVE_PERCEPTION__SDSM_TO_DETECTION_LIST_COMPONENT_HPP_
 #define CARMA_COOPERATIVE_PERCEPTION__SDSM_TO_DETECTION_LIST_COMPONENT_HPP_
 
+#include <cstddef>
+#include <optional>
 #include <string>
 
 #include <carma_cooperative_perception_interfaces/msg/detection_list.hpp>
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
 #include <carma_v2x_msgs/msg/sensor_data_sharing_message.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <rosgraph_msgs/msg/clock.hpp>
 #include <std_msgs/msg/string.hpp>
 
 #include "carma_cooperative_perception/msg_conversion.hpp"
+#include "carma_cooperative_perception/source_buffer.hpp"
 
 namespace carma_cooperative_perception
 {
+/**
+ * @brief Converts SDSMs from any number of senders into detection lists
+ *
+ * Incoming SDSMs are buffered per source ID. Each pipeline execution converts the latest SDSM
+ * from every sender that reported since the previous execution and publishes the result as a
+ * single detection list, so one busy sender cannot crowd out the others.
+*/
 class SdsmToDetectionListNode : public carma_ros2_utils::CarmaLifecycleNode
 {
   using input_msg_type = carma_v2x_msgs::msg::SensorDataSharingMessage;
@@ -35,50 +46,88 @@ class SdsmToDetectionListNode : public carma_ros2_utils::CarmaLifecycleNode
   using output_msg_type = carma_cooperative_perception_interfaces::msg::DetectionList;
 
 public:
-  explicit SdsmToDetectionListNode(const rclcpp::NodeOptions & options)
-  : CarmaLifecycleNode{options},
-    publisher_{create_publisher<output_msg_type>("output/detections", 1)},
-    subscription_{create_subscription<input_msg_type>(
-      "input/sdsm", 1, [this](input_msg_shared_pointer msg_ptr) { sdsm_msg_callback(*msg_ptr); })},
-    georeference_subscription_{create_subscription<std_msgs::msg::String>(
-      "input/georeference", 1,
-      [this](std_msgs::msg::String::SharedPtr msg_ptr) { georeference_ = msg_ptr->data; })},
-    cdasim_clock_sub_{create_subscription<rosgraph_msgs::msg::Clock>(
-      "input/cdasim_clock", 1, [this](rosgraph_msgs::msg::Clock::ConstSharedPtr msg_ptr) {
-        cdasim_time_ = msg_ptr->clock;
-      })}
-  {
-  }
+  explicit SdsmToDetectionListNode(const rclcpp::NodeOptions & options);
+
+  auto handle_on_configure(const rclcpp_lifecycle::State & /* previous_state */)
+    -> carma_ros2_utils::CallbackReturn override;
+
+  auto handle_on_activate(const rclcpp_lifecycle::State & /* previous_state */)
+    -> carma_ros2_utils::CallbackReturn override;
+
+  auto handle_on_deactivate(const rclcpp_lifecycle::State & /* previous_state */)
+    -> carma_ros2_utils::CallbackReturn override;
+
+  auto handle_on_cleanup(const rclcpp_lifecycle::State & /* previous_state */)
+    -> carma_ros2_utils::CallbackReturn override;
+
+  auto handle_on_shutdown(const rclcpp_lifecycle::State & /* previous_state */)
+    -> carma_ros2_utils::CallbackReturn override;
+
+  auto sdsm_msg_callback(const input_msg_type & msg) -> void;
+
+  auto execute_pipeline() -> void;
+
+  /**
+   * @brief Publish the SDSM counters and latency on the diagnostics topic
+   *
+   * The status level is WARN if SDSMs were dropped or failed conversion since the previous report.
+  */
+  auto publish_diagnostics() -> void;
 
-  auto sdsm_msg_callback(const input_msg_type & msg) const -> void
+  auto get_received_sdsm_count() const noexcept -> std::size_t { return received_sdsm_count_; }
+
+  /**
+   * @brief Number of SDSMs replaced by a newer SDSM from the same sender before conversion
+  */
+  auto get_coalesced_sdsm_count() const noexcept -> std::size_t { return coalesced_sdsm_count_; }
+
+  /**
+   * @brief Number of SDSMs dropped because max_sources_per_cycle senders were already buffered
+  */
+  auto get_dropped_sdsm_count() const noexcept -> std::size_t { return dropped_sdsm_count_; }
+
+  auto get_failed_conversion_count() const noexcept -> std::size_t
   {
-    try {
-      auto detection_list_msg{to_detection_list_msg(msg, georeference_)};
-
-      if (cdasim_time_) {
-        // When in simulation, ROS time is CARLA time, but SDSMs use CDASim time
-        const auto time_delta{now() - cdasim_time_.value()};
-
-        for (auto & detection : detection_list_msg.detections) {
-          detection.header.stamp = rclcpp::Time(detection.header.stamp) + time_delta;
-        }
-      }
-
-      publisher_->publish(detection_list_msg);
-    } catch (const std::runtime_error & e) {
-      RCLCPP_ERROR_STREAM(get_logger(), "Failed to convert SDSM to detection list: " << e.what());
-    }
+    return failed_conversion_count_;
   }
 
+  /**
+   * @brief Largest time between receiving an SDSM and publishing its detections in the last
+   * execution that published
+  */
+  auto get_last_max_latency() const noexcept -> rclcpp::Duration { return last_max_latency_; }
+
 private:
-  rclcpp::Publisher<output_msg_type>::SharedPtr publisher_;
-  rclcpp::Subscription<input_msg_type>::SharedPtr subscription_;
-  rclcpp::Subscription<std_msgs::msg::String>::SharedPtr georeference_subscription_;
+  rclcpp_lifecycle::LifecyclePublisher<output_msg_type>::SharedPtr publisher_{nullptr};
+  rclcpp_lifecycle::LifecyclePublisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr
+    diagnostics_publisher_{nullptr};
+  rclcpp::Subscription<input_msg_type>::SharedPtr subscription_{nullptr};
+  rclcpp::Subscription<std_msgs::msg::String>::SharedPtr georeference_subscription_{nullptr};
 
-  rclcpp::Subscription<rosgraph_msgs::msg::Clock>::SharedPtr cdasim_clock_sub_;
+  rclcpp::Subscription<rosgraph_msgs::msg::Clock>::SharedPtr cdasim_clock_sub_{nullptr};
   std::optional<rclcpp::Time> cdasim_time_{std::nullopt};
 
+  rclcpp::TimerBase::SharedPtr pipeline_execution_timer_{nullptr};
+  rclcpp::TimerBase::SharedPtr diagnostics_timer_{nullptr};
+
   std::string georeference_{""};
+
+  // Latest SDSM from each sender since the last pipeline execution
+  LatestBySourceBuffer<input_msg_type, rclcpp::Time> sdsm_buffer_{64U};
+
+  std::size_t received_sdsm_count_{0U};
+  std::size_t coalesced_sdsm_count_{0U};
+  std::size_t dropped_sdsm_count_{0U};
+  std::size_t failed_conversion_count_{0U};
+  rclcpp::Duration last_max_latency_{0, 0};
+
+  // Counts at the previous diagnostics report, used to tell whether new problems occurred since
+  std::size_t reported_dropped_sdsm_count_{0U};
+  std::size_t reported_failed_conversion_count_{0U};
+
+  double execution_frequency_hz_{20.0};
+  int input_queue_depth_{10};
+  OnSetParametersCallbackHandle::SharedPtr on_set_parameters_callback_{nullptr};
 };
 
 }  // namespace carma_cooperative_perception
@@ -0,0 +1,110 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CARMA_COOPERATIVE_PERCEPTION__SOURCE_BUFFER_HPP_
+#define CARMA_COOPERATIVE_PERCEPTION__SOURCE_BUFFER_HPP_
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace carma_cooperative_perception
+{
+
+/**
+ * @brief Bounded buffer that keeps the latest message from each source until it is taken
+ *
+ * A message from a source that already has a buffered message replaces it, so each source
+ * contributes at most one message per take. Sources are returned in the order their first
+ * buffered message arrived. Messages from new sources are rejected once max_sources sources are
+ * buffered.
+ *
+ * @tparam Message Buffered message type
+ * @tparam Stamp Type of the time each message was received
+ */
+template <typename Message, typename Stamp>
+class LatestBySourceBuffer
+{
+public:
+  struct Entry
+  {
+    std::string source_id;
+    Message message;
+    Stamp receive_time;
+  };
+
+  enum class InsertResult { kAdded, kReplaced, kRejected };
+
+  explicit LatestBySourceBuffer(std::size_t max_sources) : max_sources_{max_sources} {}
+
+  auto set_max_sources(std::size_t max_sources) noexcept -> void { max_sources_ = max_sources; }
+
+  auto get_max_sources() const noexcept -> std::size_t { return max_sources_; }
+
+  auto clear() noexcept -> void
+  {
+    entries_.clear();
+    source_indices_.clear();
+  }
+
+  auto empty() const noexcept -> bool { return entries_.empty(); }
+
+  auto size() const noexcept -> std::size_t { return std::size(entries_); }
+
+  /**
+   * @brief Buffer a message, replacing any message already buffered for the same source
+   *
+   * @return Whether the message was added for a new source, replaced an older message, or was
+   * rejected because max_sources sources are already buffered
+   */
+  auto insert(std::string source_id, Message message, Stamp receive_time) -> InsertResult
+  {
+    if (const auto it{source_indices_.find(source_id)}; it != std::end(source_indices_)) {
+      auto & entry{entries_.at(it->second)};
+      entry.message = std::move(message);
+      entry.receive_time = std::move(receive_time);
+
+      return InsertResult::kReplaced;
+    }
+
+    if (std::size(entries_) >= max_sources_) {
+      return InsertResult::kRejected;
+    }
+
+    source_indices_.emplace(source_id, std::size(entries_));
+    entries_.push_back({std::move(source_id), std::move(message), std::move(receive_time)});
+
+    return InsertResult::kAdded;
+  }
+
+  /**
+   * @brief Remove and return every buffered message in source arrival order
+   */
+  auto take() -> std::vector<Entry>
+  {
+    source_indices_.clear();
+    return std::exchange(entries_, {});
+  }
+
+private:
+  std::size_t max_sources_;
+  std::vector<Entry> entries_;
+  std::unordered_map<std::string, std::size_t> source_indices_;
+};
+
+}  // namespace carma_cooperative_perception
+
+#endif  // CARMA_COOPERATIVE_PERCEPTION__SOURCE_BUFFER_HPP_
@@ -52,6 +52,8 @@ private:
   rclcpp::Subscription<carma_cooperative_perception_interfaces::msg::TrackList>::SharedPtr
     track_list_subscription_{nullptr};
   std::string map_georeference_{""};
+  bool enable_track_predictions_{false};
+  TrackPredictionSettings prediction_settings_;
   OnSetParametersCallbackHandle::SharedPtr on_set_parameters_callback_{nullptr};
 };
 
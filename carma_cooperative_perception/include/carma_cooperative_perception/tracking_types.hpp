@@ -0,0 +1,43 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CARMA_COOPERATIVE_PERCEPTION__TRACKING_TYPES_HPP_
+#define CARMA_COOPERATIVE_PERCEPTION__TRACKING_TYPES_HPP_
+
+#include <carma_cooperative_perception_interfaces/msg/detection.hpp>
+
+#include <multiple_object_tracking/ctra_model.hpp>
+#include <multiple_object_tracking/ctrv_model.hpp>
+#include <multiple_object_tracking/track_management.hpp>
+#include <variant>
+
+namespace carma_cooperative_perception
+{
+
+using Detection =
+  std::variant<multiple_object_tracking::CtrvDetection, multiple_object_tracking::CtraDetection>;
+using Track =
+  std::variant<multiple_object_tracking::CtrvTrack, multiple_object_tracking::CtraTrack>;
+
+/**
+ * @brief Convert a detection message to the tracking library's detection for its motion model
+ *
+ * @throws std::runtime_error if the detection's motion model is not supported
+*/
+auto make_detection(const carma_cooperative_perception_interfaces::msg::Detection & msg)
+  -> Detection;
+
+}  // namespace carma_cooperative_perception
+
+#endif  // CARMA_COOPERATIVE_PERCEPTION__TRACKING_TYPES_HPP_
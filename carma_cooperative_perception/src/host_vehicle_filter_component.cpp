@@ -18,10 +18,28 @@
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "carma_cooperative_perception/diagnostics.hpp"
+
 namespace carma_cooperative_perception
 {
+namespace
+{
+auto to_seconds(const builtin_interfaces::msg::Time & stamp) -> units::time::second_t
+{
+  return units::time::second_t{static_cast<double>(stamp.sec)} +
+         units::time::nanosecond_t{static_cast<double>(stamp.nanosec)};
+}
+
+}  // namespace
+
 auto HostVehicleFilterNode::handle_on_configure(
   const rclcpp_lifecycle::State & /* previous_state */) -> carma_ros2_utils::CallbackReturn
 {
@@ -59,6 +77,9 @@ auto HostVehicleFilterNode::handle_on_configure(
     create_publisher<carma_cooperative_perception_interfaces::msg::DetectionList>(
       "output/detection_list", 1);
 
+  diagnostics_pub_ =
+    create_publisher<diagnostic_msgs::msg::DiagnosticArray>("output/diagnostics", 1);
+
   RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully configured");
 
   on_set_parameters_callback_ =
@@ -67,36 +88,59 @@ auto HostVehicleFilterNode::handle_on_configure(
       result.successful = true;
       result.reason = "success";
 
+      const std::vector<std::string> nonnegative_parameters{
+        "distance_threshold_meters", "vehicle_length",
+        "vehicle_width",             "footprint_center_offset_meters",
+        "covariance_gate",           "pose_history_duration_seconds",
+        "max_pose_extrapolation_seconds"};
+
       for (const auto & parameter : parameters) {
-        if (parameter.get_name() == "distance_threshold_meters") {
-          if (this->get_current_state().label() == "active") {
-            result.successful = false;
-            result.reason = "parameter is read-only while node is in 'Active' state";
-
-            RCLCPP_ERROR(
-              get_logger(),
-              "Cannot change parameter 'distance_threshold_meters': " + result.reason);
-
-            break;
-          }
-
-          if (const auto value{parameter.as_double()}; value < 0) {
-            result.successful = false;
-            result.reason = "parameter must be nonnegative";
-
-            RCLCPP_ERROR(
-              get_logger(),
-              "Cannot change parameter 'distance_threshold_meters': " + result.reason);
-
-            break;
-          } else {
-            this->squared_distance_threshold_meters_ = std::pow(value, 2);
-          }
-        } else {
+        const auto & name{parameter.get_name()};
+
+        if (
+          std::find(std::cbegin(nonnegative_parameters), std::cend(nonnegative_parameters), name) ==
+          std::cend(nonnegative_parameters)) {
           result.successful = false;
-          result.reason = "Unexpected parameter name '" + parameter.get_name() + '\'';
+          result.reason = "Unexpected parameter name '" + name + '\'';
           break;
         }
+
+        if (this->get_current_state().label() == "active") {
+          result.successful = false;
+          result.reason = "parameter is read-only while node is in 'Active' state";
+
+          RCLCPP_ERROR(get_logger(), "Cannot change parameter '" + name + "': " + result.reason);
+
+          break;
+        }
+
+        const auto value{parameter.as_double()};
+
+        // The footprint center may lie behind the pose origin
+        if (value < 0 && name != "footprint_center_offset_meters") {
+          result.successful = false;
+          result.reason = "parameter must be nonnegative";
+
+          RCLCPP_ERROR(get_logger(), "Cannot change parameter '" + name + "': " + result.reason);
+
+          break;
+        }
+
+        if (name == "distance_threshold_meters") {
+          this->squared_distance_threshold_meters_ = std::pow(value, 2);
+        } else if (name == "vehicle_length") {
+          this->footprint_.length = value;
+        } else if (name == "vehicle_width") {
+          this->footprint_.width = value;
+        } else if (name == "footprint_center_offset_meters") {
+          this->footprint_.center_offset = value;
+        } else if (name == "covariance_gate") {
+          this->squared_covariance_gate_ = std::pow(value, 2);
+        } else if (name == "pose_history_duration_seconds") {
+          this->host_vehicle_pose_history_.set_max_age(units::time::second_t{value});
+        } else if (name == "max_pose_extrapolation_seconds") {
+          this->host_vehicle_pose_history_.set_max_extrapolation(units::time::second_t{value});
+        }
       }
 
       return result;
@@ -104,6 +148,14 @@ auto HostVehicleFilterNode::handle_on_configure(
 
   declare_parameter("distance_threshold_meters", 0.0);
 
+  // A zero length or width disables footprint suppression, leaving only the distance threshold
+  declare_parameter("vehicle_length", footprint_.length);
+  declare_parameter("vehicle_width", footprint_.width);
+  declare_parameter("footprint_center_offset_meters", footprint_.center_offset);
+  declare_parameter("covariance_gate", 0.0);
+  declare_parameter("pose_history_duration_seconds", 1.0);
+  declare_parameter("max_pose_extrapolation_seconds", 0.2);
+
   return carma_ros2_utils::CallbackReturn::SUCCESS;
 }
 
@@ -111,6 +163,14 @@ auto HostVehicleFilterNode::handle_on_activate(const rclcpp_lifecycle::State & /
   -> carma_ros2_utils::CallbackReturn
 {
   RCLCPP_INFO(get_logger(), "Lifecycle transition: activating");
+
+  // Poses received before a previous deactivation are stale by now
+  host_vehicle_pose_history_.clear();
+
+  diagnostics_timer_ = rclcpp::create_timer(
+    this, this->get_clock(), std::chrono::nanoseconds{kDiagnosticsPeriod},
+    [this] { publish_diagnostics(); });
+
   RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully activated");
 
   return carma_ros2_utils::CallbackReturn::SUCCESS;
@@ -120,6 +180,9 @@ auto HostVehicleFilterNode::handle_on_deactivate(
   const rclcpp_lifecycle::State & /* previous_state */) -> carma_ros2_utils::CallbackReturn
 {
   RCLCPP_INFO(get_logger(), "Lifecycle transition: deactivating");
+
+  diagnostics_timer_.reset();
+
   RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully deactivated");
 
   return carma_ros2_utils::CallbackReturn::SUCCESS;
@@ -156,38 +219,104 @@ auto HostVehicleFilterNode::handle_on_shutdown(const rclcpp_lifecycle::State & /
 auto HostVehicleFilterNode::update_host_vehicle_pose(const geometry_msgs::msg::PoseStamped & msg)
   -> void
 {
-  host_vehicle_pose_ = msg;
+  host_vehicle_pose_history_.insert(to_seconds(msg.header.stamp), to_planar_pose(msg.pose));
 }
 
 auto HostVehicleFilterNode::attempt_filter_and_republish(
   carma_cooperative_perception_interfaces::msg::DetectionList msg) -> void
 {
-  if (!host_vehicle_pose_.has_value()) {
+  if (host_vehicle_pose_history_.empty()) {
     RCLCPP_WARN(get_logger(), "Could not filter detection list: host vehicle pose unknown");
     return;
   }
 
-  const auto is_within_distance = [this](const auto & detection) {
-    return euclidean_distance_squared(host_vehicle_pose_.value().pose, detection.pose.pose) <=
-           this->squared_distance_threshold_meters_;
+  const auto use_footprint{footprint_.length > 0.0 && footprint_.width > 0.0};
+
+  std::size_t suppressed_count{0U};
+  std::size_t unaligned_count{0U};
+
+  const auto is_host_vehicle = [&](const auto & detection) {
+    // Compare against where the host was when the detection was measured, not where it is now
+    const auto host_pose{host_vehicle_pose_history_.pose_at(to_seconds(detection.header.stamp))};
+
+    if (!host_pose.has_value()) {
+      ++unaligned_count;
+      return false;
+    }
+
+    auto suppress{
+      planar_distance_squared(host_pose.value(), detection.pose.pose.position) <=
+      squared_distance_threshold_meters_};
+
+    if (!suppress && use_footprint) {
+      suppress =
+        footprint_mahalanobis_distance_squared(host_pose.value(), footprint_, detection.pose) <=
+        squared_covariance_gate_;
+    }
+
+    if (suppress) {
+      ++suppressed_count;
+    }
+
+    return suppress;
   };
 
   const auto new_end{
-    std::remove_if(std::begin(msg.detections), std::end(msg.detections), is_within_distance)};
+    std::remove_if(std::begin(msg.detections), std::end(msg.detections), is_host_vehicle)};
 
   msg.detections.erase(new_end, std::end(msg.detections));
 
+  suppressed_detection_count_ += suppressed_count;
+  unaligned_detection_count_ += unaligned_count;
+
+  if (unaligned_count > 0U) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      get_logger(), *get_clock(), 1000,
+      "Passing through " << unaligned_count
+                         << " detections without filtering: no host vehicle pose within "
+                            "max_pose_extrapolation_seconds of their timestamps");
+  }
+
+  RCLCPP_DEBUG_STREAM(
+    get_logger(), "Suppressed " << suppressed_count << " host vehicle detections, published "
+                                << std::size(msg.detections) << ". Total suppressed: "
+                                << suppressed_detection_count_
+                                << ", unaligned: " << unaligned_detection_count_);
+
   this->detection_list_pub_->publish(msg);
 }
 
-auto euclidean_distance_squared(
-  const geometry_msgs::msg::Pose & a, const geometry_msgs::msg::Pose & b) -> double
+auto HostVehicleFilterNode::publish_diagnostics() -> void
+{
+  diagnostic_msgs::msg::DiagnosticStatus status;
+  status.name = get_fully_qualified_name();
+
+  if (const auto new_unaligned_count{
+        unaligned_detection_count_ - reported_unaligned_detection_count_};
+      new_unaligned_count > 0U) {
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::WARN;
+    status.message = "Passed through " + std::to_string(new_unaligned_count) +
+                     " detections without a host vehicle pose since last report";
+  } else {
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+    status.message = "OK";
+  }
+
+  reported_unaligned_detection_count_ = unaligned_detection_count_;
+
+  add_diagnostic_value(status, "suppressed", suppressed_detection_count_);
+  add_diagnostic_value(status, "unaligned", unaligned_detection_count_);
+
+  diagnostic_msgs::msg::DiagnosticArray diagnostics;
+  diagnostics.header.stamp = now();
+  diagnostics.status.push_back(std::move(status));
+
+  diagnostics_pub_->publish(diagnostics);
+}
+
+auto planar_distance_squared(const PlanarPose & a, const geometry_msgs::msg::Point & b) -> double
 {
-  return std::pow(a.position.x - b.position.x, 2) + std::pow(a.position.y - b.position.y, 2) +
-         std::pow(a.position.z - b.position.z, 2) + std::pow(a.orientation.x - b.orientation.x, 2) +
-         std::pow(a.orientation.y - b.orientation.y, 2) +
-         std::pow(a.orientation.z - b.orientation.z, 2) +
-         std::pow(a.orientation.w - b.orientation.w, 2);
+  return std::pow(a.x - b.x, 2) + std::pow(a.y - b.y, 2);
 }
 
 }  // namespace carma_cooperative_perception
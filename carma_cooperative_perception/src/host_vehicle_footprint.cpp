@@ -0,0 +1,159 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "carma_cooperative_perception/host_vehicle_footprint.hpp"
+
+#include "carma_cooperative_perception/units_extensions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace carma_cooperative_perception
+{
+namespace
+{
+auto wrap_angle(double angle) -> double { return std::remainder(angle, 2.0 * M_PI); }
+
+auto lerp(const PlanarPose & a, const PlanarPose & b, double t) -> PlanarPose
+{
+  return {
+    a.x + t * (b.x - a.x), a.y + t * (b.y - a.y), wrap_angle(a.yaw + t * wrap_angle(b.yaw - a.yaw))};
+}
+
+}  // namespace
+
+auto to_planar_pose(const geometry_msgs::msg::Pose & pose) -> PlanarPose
+{
+  const auto & q{pose.orientation};
+  const auto yaw{std::atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z))};
+
+  return {pose.position.x, pose.position.y, yaw};
+}
+
+auto HostPoseHistory::insert(units::time::second_t stamp, const PlanarPose & pose) -> void
+{
+  const auto later{std::upper_bound(
+    std::begin(samples_), std::end(samples_), stamp,
+    [](const auto & s, const auto & sample) { return s < sample.stamp; })};
+
+  if (later != std::begin(samples_) && std::prev(later)->stamp == stamp) {
+    std::prev(later)->pose = pose;
+  } else {
+    samples_.insert(later, Sample{stamp, pose});
+  }
+
+  prune();
+}
+
+auto HostPoseHistory::pose_at(units::time::second_t stamp) const -> std::optional<PlanarPose>
+{
+  if (samples_.empty()) {
+    return std::nullopt;
+  }
+
+  const auto & oldest{samples_.front()};
+  const auto & newest{samples_.back()};
+
+  if (stamp < oldest.stamp) {
+    if (oldest.stamp - stamp > max_extrapolation_) {
+      return std::nullopt;
+    }
+
+    return oldest.pose;
+  }
+
+  if (stamp >= newest.stamp) {
+    if (stamp - newest.stamp > max_extrapolation_) {
+      return std::nullopt;
+    }
+
+    if (std::size(samples_) < 2) {
+      return newest.pose;
+    }
+
+    const auto & previous{samples_.at(std::size(samples_) - 2)};
+    const auto t{remove_units((stamp - previous.stamp) / (newest.stamp - previous.stamp))};
+
+    return lerp(previous.pose, newest.pose, t);
+  }
+
+  const auto later{std::upper_bound(
+    std::begin(samples_), std::end(samples_), stamp,
+    [](const auto & s, const auto & sample) { return s < sample.stamp; })};
+  const auto & before{*std::prev(later)};
+
+  const auto t{remove_units((stamp - before.stamp) / (later->stamp - before.stamp))};
+
+  return lerp(before.pose, later->pose, t);
+}
+
+auto HostPoseHistory::prune() -> void
+{
+  if (samples_.empty()) {
+    return;
+  }
+
+  const auto oldest_allowed{samples_.back().stamp - max_age_};
+
+  // Keep at least two samples so extrapolation still has a velocity to work with
+  while (std::size(samples_) > 2 && samples_.front().stamp < oldest_allowed) {
+    samples_.pop_front();
+  }
+}
+
+auto footprint_mahalanobis_distance_squared(
+  const PlanarPose & host_pose, const VehicleFootprint & footprint,
+  const geometry_msgs::msg::PoseWithCovariance & detection_pose) -> double
+{
+  const auto cos_yaw{std::cos(host_pose.yaw)};
+  const auto sin_yaw{std::sin(host_pose.yaw)};
+
+  const auto dx{detection_pose.pose.position.x - host_pose.x};
+  const auto dy{detection_pose.pose.position.y - host_pose.y};
+
+  // Detection position in the footprint's frame (x forward from the footprint center)
+  const auto longitudinal{cos_yaw * dx + sin_yaw * dy - footprint.center_offset};
+  const auto lateral{-sin_yaw * dx + cos_yaw * dy};
+
+  const auto half_length{footprint.length / 2.0};
+  const auto half_width{footprint.width / 2.0};
+
+  const auto residual_longitudinal{
+    longitudinal - std::clamp(longitudinal, -half_length, half_length)};
+  const auto residual_lateral{lateral - std::clamp(lateral, -half_width, half_width)};
+
+  if (residual_longitudinal == 0.0 && residual_lateral == 0.0) {
+    return 0.0;
+  }
+
+  // Offset from the closest footprint point back in the map frame, where the covariance lives
+  const auto rx{cos_yaw * residual_longitudinal - sin_yaw * residual_lateral};
+  const auto ry{sin_yaw * residual_longitudinal + cos_yaw * residual_lateral};
+
+  const auto var_x{detection_pose.covariance.at(0)};
+  const auto cov_xy{detection_pose.covariance.at(1)};
+  const auto var_y{detection_pose.covariance.at(7)};
+
+  const auto determinant{var_x * var_y - cov_xy * cov_xy};
+
+  if (determinant <= std::numeric_limits<double>::epsilon()) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  return (var_y * rx * rx - 2.0 * cov_xy * rx * ry + var_x * ry * ry) / determinant;
+}
+
+}  // namespace carma_cooperative_perception
@@ -15,6 +15,7 @@
 #include "carma_cooperative_perception/msg_conversion.hpp"
 
 #include <tf2_geometry_msgs/tf2_geometry_msgs.h>
+#include <carma_cooperative_perception_interfaces/msg/detection.hpp>
 #include <carma_cooperative_perception_interfaces/msg/track.hpp>
 #include <carma_cooperative_perception_interfaces/msg/track_list.hpp>
 #include <carma_perception_msgs/msg/external_object.hpp>
@@ -43,8 +44,11 @@
 #include "carma_cooperative_perception/geodetic.hpp"
 #include "carma_cooperative_perception/j2735_types.hpp"
 #include "carma_cooperative_perception/j3224_types.hpp"
+#include "carma_cooperative_perception/tracking_types.hpp"
 #include "carma_cooperative_perception/units_extensions.hpp"
 
+#include <multiple_object_tracking/temporal_alignment.hpp>
+
 #include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_extension/projection/local_frame_projector.h>
 #include <boost/date_time/posix_time/conversion.hpp>
@@ -462,28 +466,27 @@ auto to_external_object_msg(const carma_cooperative_perception_interfaces::msg::
   external_object.header = track.header;
   external_object.presence_vector = 0;
 
-  const auto to_numeric_id = [](std::string string_id) -> std::optional<uint32_t> {
-    auto non_digit_start = std::remove_if(
-      std::begin(string_id), std::end(string_id),
-      [](const auto & ch) { return !std::isdigit(ch); });
-
+  // Tracks made by the multiple object tracker carry decimal handles, which are used as is. Any
+  // other ID is hashed (32-bit FNV-1a) so the object still gets an ID that is stable across
+  // messages instead of being published without one.
+  const auto to_numeric_id = [](const std::string & string_id) -> std::uint32_t {
     std::uint32_t numeric_id;
-    const auto digit_substr_size{std::distance(std::begin(string_id), non_digit_start)};
-    if (
-      std::from_chars(string_id.c_str(), string_id.c_str() + digit_substr_size, numeric_id).ec ==
-      std::errc{}) {
+    const auto [end, ec]{std::from_chars(
+      string_id.data(), string_id.data() + std::size(string_id), numeric_id)};
+    if (ec == std::errc{} && end == string_id.data() + std::size(string_id)) {
       return numeric_id;
     }
 
-    return std::nullopt;
+    std::uint32_t hash{2166136261U};
+    for (const auto ch : string_id) {
+      hash = (hash ^ static_cast<std::uint8_t>(ch)) * 16777619U;
+    }
+
+    return hash;
   };
 
-  if (const auto numeric_id{to_numeric_id(track.id)}) {
-    external_object.presence_vector |= external_object.ID_PRESENCE_VECTOR;
-    external_object.id = numeric_id.value();
-  } else {
-    external_object.presence_vector &= ~external_object.ID_PRESENCE_VECTOR;
-  }
+  external_object.presence_vector |= external_object.ID_PRESENCE_VECTOR;
+  external_object.id = to_numeric_id(track.id);
 
   external_object.presence_vector |= external_object.POSE_PRESENCE_VECTOR;
   external_object.pose = track.pose;
@@ -501,6 +504,15 @@ auto to_external_object_msg(const carma_cooperative_perception_interfaces::msg::
 
   external_object.velocity.twist.linear.x = track_longitudinal_velocity * std::cos(yaw);
   external_object.velocity.twist.linear.y = track_longitudinal_velocity * std::sin(yaw);
+  external_object.velocity.twist.angular.z = track.twist.twist.angular.z;
+
+  // Project the longitudinal speed variance the same way as the speed itself
+  const auto speed_variance{track.twist.covariance.at(0)};
+  external_object.velocity.covariance.at(0) = speed_variance * std::pow(std::cos(yaw), 2);
+  external_object.velocity.covariance.at(1) = speed_variance * std::cos(yaw) * std::sin(yaw);
+  external_object.velocity.covariance.at(6) = external_object.velocity.covariance.at(1);
+  external_object.velocity.covariance.at(7) = speed_variance * std::pow(std::sin(yaw), 2);
+  external_object.velocity.covariance.at(35) = track.twist.covariance.at(35);
 
   external_object.object_type = track.semantic_class;
 
@@ -539,6 +551,74 @@ auto to_external_object_list_msg(
   return external_object_list;
 }
 
+static auto to_predicted_state_msg(const Detection & propagated, double process_noise_max)
+  -> carma_perception_msgs::msg::PredictedState
+{
+  const auto to_msg = [process_noise_max](const auto & d) {
+    carma_perception_msgs::msg::PredictedState msg;
+
+    msg.header.stamp.sec = remove_units(units::math::floor(d.timestamp));
+    msg.header.stamp.nanosec = remove_units(
+      units::time::nanosecond_t{units::math::fmod(d.timestamp, units::time::second_t{1.0})});
+    msg.header.frame_id = "map";
+
+    msg.predicted_position.position.x = remove_units(d.state.position_x);
+    msg.predicted_position.position.y = remove_units(d.state.position_y);
+
+    tf2::Quaternion orientation;
+    orientation.setRPY(0, 0, remove_units(d.state.yaw.get_angle()));
+    msg.predicted_position.orientation = tf2::toMsg(orientation);
+
+    msg.predicted_velocity.linear.x = remove_units(d.state.velocity);
+    msg.predicted_velocity.angular.z = remove_units(d.state.yaw_rate);
+
+    const auto position_variance{d.covariance(0, 0) + d.covariance(1, 1)};
+    msg.predicted_position_confidence =
+      std::clamp(1.0 - position_variance / process_noise_max, 0.0, 1.0);
+
+    const auto velocity_variance{d.covariance(2, 2)};
+    msg.predicted_velocity_confidence =
+      std::clamp(1.0 - velocity_variance / process_noise_max, 0.0, 1.0);
+
+    return msg;
+  };
+
+  return std::visit(to_msg, propagated);
+}
+
+auto to_predicted_states(
+  const carma_cooperative_perception_interfaces::msg::Track & track,
+  const TrackPredictionSettings & settings)
+  -> std::vector<carma_perception_msgs::msg::PredictedState>
+{
+  // Tracks and detections share their state representation, so the tracker's detection
+  // conversion also reconstructs the track's motion model state
+  carma_cooperative_perception_interfaces::msg::Detection detection_msg;
+  detection_msg.header = track.header;
+  detection_msg.id = track.id;
+  detection_msg.motion_model = track.motion_model;
+  detection_msg.pose = track.pose;
+  detection_msg.twist = track.twist;
+  detection_msg.accel = track.accel;
+  detection_msg.semantic_class = track.semantic_class;
+
+  auto propagated{make_detection(detection_msg)};
+  const auto start_time{
+    units::time::second_t{static_cast<double>(track.header.stamp.sec)} +
+    units::time::nanosecond_t{static_cast<double>(track.header.stamp.nanosec)}};
+
+  std::vector<carma_perception_msgs::msg::PredictedState> predictions;
+  predictions.reserve(static_cast<std::size_t>(remove_units(settings.period / settings.time_step)));
+
+  for (auto offset{settings.time_step}; offset <= settings.period; offset += settings.time_step) {
+    multiple_object_tracking::propagate_to_time(
+      propagated, start_time + offset, multiple_object_tracking::default_unscented_transform);
+    predictions.push_back(to_predicted_state_msg(propagated, settings.process_noise_max));
+  }
+
+  return predictions;
+}
+
 auto to_sdsm_msg(
   const carma_perception_msgs::msg::ExternalObjectList & external_object_list,
   const geometry_msgs::msg::PoseStamped & current_pose,
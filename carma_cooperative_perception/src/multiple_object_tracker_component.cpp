@@ -28,6 +28,7 @@
 #include <multiple_object_tracking/gating.hpp>
 #include <multiple_object_tracking/scoring.hpp>
 #include <multiple_object_tracking/temporal_alignment.hpp>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -195,6 +196,14 @@ static auto to_ros_msg(const mot::CtraTrack & track)
 
   msg.accel.accel.linear.x = mot::remove_units(track.state.acceleration);
 
+  // Inverse of the covariance mapping used in make_ctra_detection()
+  msg.pose.covariance.at(0) = track.covariance(0, 0);
+  msg.pose.covariance.at(7) = track.covariance(1, 1);
+  msg.twist.covariance.at(0) = track.covariance(2, 2);
+  msg.pose.covariance.at(35) = track.covariance(3, 3);
+  msg.twist.covariance.at(35) = track.covariance(4, 4);
+  msg.accel.covariance.at(0) = track.covariance(5, 5);
+
   msg.semantic_class = semantic_class_to_numeric_value(mot::get_semantic_class(track));
 
   return msg;
@@ -224,6 +233,13 @@ static auto to_ros_msg(const mot::CtrvTrack & track)
   msg.twist.twist.linear.x = mot::remove_units(track.state.velocity);
   msg.twist.twist.angular.z = mot::remove_units(track.state.yaw_rate);
 
+  // Inverse of the covariance mapping used in make_ctrv_detection()
+  msg.pose.covariance.at(0) = track.covariance(0, 0);
+  msg.pose.covariance.at(7) = track.covariance(1, 1);
+  msg.twist.covariance.at(0) = track.covariance(2, 2);
+  msg.pose.covariance.at(35) = track.covariance(3, 3);
+  msg.twist.covariance.at(35) = track.covariance(4, 4);
+
   msg.semantic_class = semantic_class_to_numeric_value(mot::get_semantic_class(track));
 
   return msg;
@@ -325,6 +341,20 @@ auto MultipleObjectTrackerNode::handle_on_configure(
                 mot::RemovalThreshold{static_cast<std::size_t>(value)});
             }
           }
+        } else if (parameter.get_name() == "max_measurement_lateness_ms") {
+          if (const auto value{parameter.as_double()}; value < 0.0) {
+            result.successful = false;
+            result.reason = "parameter must be nonnegative";
+          } else {
+            this->measurement_history_.set_max_lateness(units::time::millisecond_t{value});
+          }
+        } else if (parameter.get_name() == "max_replay_cycles") {
+          if (const auto value{parameter.as_int()}; value < 1) {
+            result.successful = false;
+            result.reason = "parameter must be positive";
+          } else {
+            this->measurement_history_.set_max_cycles(static_cast<std::size_t>(value));
+          }
         } else {
           result.successful = false;
           result.reason = "Unexpected parameter name '" + parameter.get_name() + '\'';
@@ -343,6 +373,13 @@ auto MultipleObjectTrackerNode::handle_on_configure(
   declare_parameter(
     "track_removal_threshold", static_cast<int>(track_manager_.get_promotion_threshold().value));
 
+  declare_parameter(
+    "max_measurement_lateness_ms",
+    mot::remove_units(units::time::millisecond_t{measurement_history_.get_max_lateness()}));
+
+  declare_parameter(
+    "max_replay_cycles", static_cast<int>(measurement_history_.get_max_cycles()));
+
   RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully configured");
 
   return carma_ros2_utils::CallbackReturn::SUCCESS;
@@ -358,6 +395,9 @@ auto MultipleObjectTrackerNode::handle_on_activate(
     pipeline_execution_timer_->reset();
   }
 
+  // Cycles from a previous activation cannot be replayed against detections received now
+  measurement_history_.clear();
+
   const std::chrono::duration<double, std::nano> period_ns{mot::remove_units(execution_period_)};
   pipeline_execution_timer_ =
     rclcpp::create_timer(this, this->get_clock(), period_ns, [this] { execute_pipeline(); });
@@ -420,18 +460,7 @@ auto MultipleObjectTrackerNode::store_new_detections(
 
   for (const auto & detection_msg : msg.detections) {
     try {
-      const auto detection{make_detection(detection_msg)};
-      const auto uuid{mot::get_uuid(detection)};
-
-      if (uuid_index_map_.count(uuid) == 0) {
-        detections_.push_back(std::move(detection));
-        uuid_index_map_[uuid] = std::size(detections_) - 1;
-      } else {
-        RCLCPP_WARN_STREAM(
-          this->get_logger(),
-          "Detection with ID '" << uuid << "' already exists. Overwriting its data");
-        detections_.at(uuid_index_map_[uuid]) = detection;
-      }
+      detections_.push_back(make_detection(detection_msg));
     } catch (const std::runtime_error & error) {
       RCLCPP_ERROR(
         this->get_logger(), "Ignoring detection with ID '%s': %s", detection_msg.id.c_str(),
@@ -440,6 +469,11 @@ auto MultipleObjectTrackerNode::store_new_detections(
   }
 }
 
+static auto get_detection_timestamp(const Detection & detection) -> units::time::second_t
+{
+  return std::visit([](const auto & d) { return units::time::second_t{d.timestamp}; }, detection);
+}
+
 static auto temporally_align_detections(
   std::vector<Detection> & detections, units::time::second_t end_time) -> void
 {
@@ -557,7 +591,7 @@ struct MetricSe2
   }
 };
 
-auto MultipleObjectTrackerNode::execute_pipeline() -> void
+auto MultipleObjectTrackerNode::make_tentative_track(const Detection & detection) -> Track
 {
   static constexpr mot::Visitor make_track_visitor{
     [](const mot::CtrvDetection & d) { return Track{mot::make_track<mot::CtrvTrack>(d)}; },
@@ -568,32 +602,147 @@ auto MultipleObjectTrackerNode::execute_pipeline() -> void
     },
   };
 
+  auto track{std::visit(make_track_visitor, detection)};
+
+  // Tracks inherit the (potentially long) detection UUID by default. Replacing it with a compact
+  // numeric handle keeps track lookups cheap and gives downstream consumers a stable numeric ID.
+  const mot::Uuid handle{std::to_string(next_track_handle_++)};
+  std::visit([&handle](auto & t) { t.uuid = handle; }, track);
+
+  return track;
+}
+
+auto MultipleObjectTrackerNode::execute_pipeline() -> void
+{
+  execute_pipeline(units::time::second_t{this->now().seconds()});
+}
+
+auto MultipleObjectTrackerNode::execute_pipeline(units::time::second_t current_time) -> void
+{
+  const auto last_cycle_time{measurement_history_.latest_time()};
+
+  // Detections stamped after the last cycle belong to this cycle. Older detections are late: they
+  // go back into the cycle covering their timestamp, and that cycle and every later one are
+  // replayed so the detection is fused at (approximately) its own time. All late detections
+  // received since the last execution share a single replay from the earliest affected cycle, and
+  // the history's cycle limit caps how many cycles that replay re-runs.
+  std::vector<Detection> current_detections;
+  std::optional<std::size_t> replay_start;
+  std::size_t dropped_count{0U};
+  units::time::second_t max_dropped_lateness{0.0};
+
+  for (auto & detection : detections_) {
+    const auto stamp{get_detection_timestamp(detection)};
+
+    if (!last_cycle_time.has_value() || stamp > last_cycle_time.value()) {
+      current_detections.push_back(std::move(detection));
+      continue;
+    }
+
+    if (const auto index{measurement_history_.insert(detection, stamp)}; index.has_value()) {
+      ++late_measurement_count_;
+      replay_start = std::min(replay_start.value_or(index.value()), index.value());
+    } else {
+      ++dropped_count;
+      max_dropped_lateness = units::math::fmax(max_dropped_lateness, current_time - stamp);
+    }
+  }
+
+  detections_.clear();
+
+  if (dropped_count > 0U) {
+    dropped_measurement_count_ += dropped_count;
+
+    RCLCPP_WARN_STREAM(
+      get_logger(), "Dropped " << dropped_count << " detection(s) up to "
+                               << units::time::millisecond_t{max_dropped_lateness}
+                               << " late, which exceeds the accepted lateness of "
+                               << units::time::millisecond_t{
+                                    measurement_history_.get_max_lateness()}
+                               << ". Total dropped: " << dropped_measurement_count_);
+  }
+
+  if (replay_start.has_value()) {
+    RCLCPP_DEBUG_STREAM(
+      get_logger(), "Replaying " << measurement_history_.size() - replay_start.value()
+                                 << " cycle(s) to fuse late detections. Total late: "
+                                 << late_measurement_count_);
+
+    const auto & rewind_state{measurement_history_.at(replay_start.value()).state_before};
+    track_manager_ = rewind_state.track_manager;
+
+    for (auto i{replay_start.value()}; i < measurement_history_.size(); ++i) {
+      auto & cycle{measurement_history_.at(i)};
+      cycle.state_before = TrackerState{track_manager_};
+      run_tracking_cycle(cycle.measurements, cycle.end_time);
+    }
+  }
+
+  TrackerState state_before{track_manager_};
+  run_tracking_cycle(current_detections, current_time);
+
+  // The first cycle has no predecessor, so it accepts any detection older than itself
+  const auto start_time{last_cycle_time.value_or(
+    units::time::second_t{std::numeric_limits<double>::lowest()})};
+
+  measurement_history_.add_cycle(
+    {start_time, current_time, std::move(state_before), std::move(current_detections)});
+
+  if (track_list_pub_ == nullptr) {
+    return;
+  }
+
+  carma_cooperative_perception_interfaces::msg::TrackList track_list;
+  for (const auto & track : track_manager_.get_confirmed_tracks()) {
+    track_list.tracks.push_back(to_ros_msg(track));
+  }
+
+  track_list_pub_->publish(track_list);
+}
+
+auto MultipleObjectTrackerNode::run_tracking_cycle(
+  const std::vector<Detection> & cycle_detections, units::time::second_t time) -> void
+{
+  // Maps each detection's UUID to its index in detections. The index is the detection's handle
+  // for the remainder of the cycle.
+  std::vector<Detection> detections;
+  std::unordered_map<mot::Uuid, std::size_t> uuid_index_map;
+
+  for (const auto & detection : cycle_detections) {
+    const auto uuid{mot::get_uuid(detection)};
+
+    if (const auto it{uuid_index_map.find(uuid)}; it == std::end(uuid_index_map)) {
+      detections.push_back(detection);
+      uuid_index_map[uuid] = std::size(detections) - 1;
+    } else if (
+      get_detection_timestamp(detection) >= get_detection_timestamp(detections.at(it->second))) {
+      RCLCPP_DEBUG_STREAM(
+        this->get_logger(),
+        "Detection with ID '" << uuid << "' already exists. Overwriting its data");
+      detections.at(it->second) = detection;
+    }
+  }
+
   if (track_manager_.get_all_tracks().empty()) {
     RCLCPP_DEBUG(
       get_logger(), "List of tracks is empty. Converting detections to tentative tracks");
 
     // This clustering distance is an arbitrarily-chosen heuristic. It is working well for our
     // current purposes, but there's no reason it couldn't be restricted or loosened.
-    const auto clusters{mot::cluster_detections(detections_, 0.75)};
+    const auto clusters{mot::cluster_detections(detections, 0.75)};
     for (const auto & cluster : clusters) {
       const auto detection{std::cbegin(cluster.get_detections())->second};
-      track_manager_.add_tentative_track(std::visit(make_track_visitor, detection));
+      track_manager_.add_tentative_track(make_tentative_track(detection));
     }
 
-    track_list_pub_->publish(carma_cooperative_perception_interfaces::msg::TrackList{});
-
-    detections_.clear();
-    uuid_index_map_.clear();
     return;
   }
 
-  const units::time::second_t current_time{this->now().seconds()};
-
-  temporally_align_detections(detections_, current_time);
+  temporally_align_detections(detections, time);
 
-  const auto predicted_tracks{predict_track_states(track_manager_.get_all_tracks(), current_time)};
+  const auto predicted_tracks{predict_track_states(track_manager_.get_all_tracks(), time)};
   auto scores{
-    mot::score_tracks_and_detections(predicted_tracks, detections_, SemanticDistance2dScore{})};
+    mot::score_tracks_and_detections(predicted_tracks, detections, SemanticDistance2dScore{})};
 
   // This pruning distance is an arbitrarily-chosen heuristic. It is working well for our
   // current purposes, but there's no reason it couldn't be restricted or loosened.
@@ -604,69 +753,59 @@ auto MultipleObjectTrackerNode::execute_pipeline() -> void
 
   track_manager_.update_track_lists(associations);
 
-  std::unordered_map<mot::Uuid, Detection> detection_map;
-  for (const auto & detection : detections_) {
-    detection_map[mot::get_uuid(detection)] = detection;
+  // From here on detections are referred to by their index in detections, which was assigned
+  // when they were deduplicated. Per-detection bookkeeping then lives in flat vectors instead of
+  // UUID-keyed maps holding detection copies.
+  const auto detection_index{
+    [&uuid_index_map](const mot::Uuid & uuid) { return uuid_index_map.at(uuid); }};
+
+  std::vector<bool> is_associated(std::size(detections), false);
+  for (const auto & [track_uuid, detection_uuids] : associations) {
+    for (const auto & detection_uuid : detection_uuids) {
+      is_associated.at(detection_index(detection_uuid)) = true;
+    }
   }
 
   const mot::HasAssociation has_association{associations};
   for (auto & track : track_manager_.get_all_tracks()) {
     if (has_association(track)) {
-      const auto detection_uuids{associations.at(get_uuid(track))};
-      const auto first_detection{detection_map[detection_uuids.at(0)]};
+      const auto track_uuid{mot::get_uuid(track)};
+      const auto & first_detection{
+        detections.at(detection_index(associations.at(track_uuid).at(0)))};
       const auto fused_track{
         std::visit(mot::covariance_intersection_visitor, track, first_detection)};
-      track_manager_.update_track(mot::get_uuid(track), fused_track);
+      track_manager_.update_track(track_uuid, fused_track);
     }
   }
 
+  // We want to remove unassociated detections that are close enough to existing tracks
+  // to avoid creating duplicates. Duplicate tracks will cause association inconsistencies
+  // (flip flopping associations between the two tracks). The closest track to each detection
+  // is found in a single pass over the scores.
+  std::vector<float> min_scores(std::size(detections), std::numeric_limits<float>::infinity());
+  for (const auto & [uuid_pair, score] : scores) {
+    auto & min_score{min_scores.at(detection_index(uuid_pair.second))};
+    min_score = std::min(min_score, score);
+  }
+
   // Unassociated detections don't influence the tracking pipeline, so we can add
   // them to the tracker at the end.
   std::vector<Detection> unassociated_detections;
-  for (const auto & [uuid, detection] : detection_map) {
-    if (!has_association(detection)) {
-      unassociated_detections.push_back(detection);
+  for (std::size_t i{0U}; i < std::size(detections); ++i) {
+    // This distance is an arbitrarily-chosen heuristic. It is working well for our
+    // current purposes, but there's no reason it couldn't be restricted or loosened.
+    if (!is_associated[i] && min_scores[i] >= 1.0) {
+      unassociated_detections.push_back(detections[i]);
     }
   }
 
-  // We want to remove unassociated tracks that are close enough to existing tracks
-  // to avoid creating duplicates. Duplicate tracks will cause association inconsistencies
-  // (flip flopping associations between the two tracks).
-  auto remove_start{std::remove_if(
-    std::begin(unassociated_detections), std::end(unassociated_detections),
-    [&scores](const auto & detection) {
-      const auto uuid{mot::get_uuid(detection)};
-      auto min_score{std::numeric_limits<float>::infinity()};
-      for (const auto & [uuid_pair, score] : scores) {
-        if (uuid_pair.second == uuid) {
-          min_score = std::min(min_score, score);
-        }
-      }
-
-      // This distance is an arbitrarily-chosen heuristic. It is working well for our
-      // current purposes, but there's no reason it couldn't be restricted or loosened.
-      return min_score < 1.0;
-    })};
-
-  unassociated_detections.erase(remove_start, std::end(unassociated_detections));
-
   // This clustering distance is an arbitrarily-chosen heuristic. It is working well for our
   // current purposes, but there's no reason it couldn't be restricted or loosened.
   const auto clusters{mot::cluster_detections(unassociated_detections, 0.75, MetricSe2{})};
   for (const auto & cluster : clusters) {
     const auto detection{std::cbegin(cluster.get_detections())->second};
-    track_manager_.add_tentative_track(std::visit(make_track_visitor, detection));
-  }
-
-  carma_cooperative_perception_interfaces::msg::TrackList track_list;
-  for (const auto & track : track_manager_.get_confirmed_tracks()) {
-    track_list.tracks.push_back(to_ros_msg(track));
+    track_manager_.add_tentative_track(make_tentative_track(detection));
   }
-
-  track_list_pub_->publish(track_list);
-
-  detections_.clear();
-  uuid_index_map_.clear();
 }
 
 }  // namespace carma_cooperative_perception
@@ -16,6 +16,299 @@
 
 #include <rclcpp_components/register_node_macro.hpp>
 
+#include "carma_cooperative_perception/diagnostics.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace carma_cooperative_perception
+{
+SdsmToDetectionListNode::SdsmToDetectionListNode(const rclcpp::NodeOptions & options)
+: CarmaLifecycleNode{options}
+{
+}
+
+auto SdsmToDetectionListNode::handle_on_configure(
+  const rclcpp_lifecycle::State & /* previous_state */) -> carma_ros2_utils::CallbackReturn
+{
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: configuring");
+
+  on_set_parameters_callback_ =
+    add_on_set_parameters_callback([this](const std::vector<rclcpp::Parameter> & parameters) {
+      rcl_interfaces::msg::SetParametersResult result;
+      result.successful = true;
+      result.reason = "success";
+
+      for (const auto & parameter : parameters) {
+        if (parameter.get_name() == "execution_frequency_hz") {
+          if (this->get_current_state().label() == "active") {
+            result.successful = false;
+            result.reason = "parameter is read-only while node is in 'Active' state";
+
+            RCLCPP_ERROR(
+              get_logger(), "Cannot change parameter 'execution_frequency_hz': " + result.reason);
+
+            break;
+          }
+
+          if (const auto value{parameter.as_double()}; value <= 0.0) {
+            result.successful = false;
+            result.reason = "parameter must be positive";
+          } else {
+            this->execution_frequency_hz_ = value;
+          }
+        } else if (parameter.get_name() == "max_sources_per_cycle") {
+          if (const auto value{parameter.as_int()}; value < 1) {
+            result.successful = false;
+            result.reason = "parameter must be positive";
+          } else {
+            this->sdsm_buffer_.set_max_sources(static_cast<std::size_t>(value));
+          }
+        } else if (parameter.get_name() == "input_queue_depth") {
+          if (const auto current_state{this->get_current_state().label()};
+              current_state == "active" || current_state == "inactive") {
+            result.successful = false;
+            result.reason = "parameter is read-only once the node is configured";
+
+            RCLCPP_ERROR(
+              get_logger(), "Cannot change parameter 'input_queue_depth': " + result.reason);
+
+            break;
+          }
+
+          if (const auto value{parameter.as_int()}; value < 1) {
+            result.successful = false;
+            result.reason = "parameter must be positive";
+          } else {
+            this->input_queue_depth_ = static_cast<int>(value);
+          }
+        } else {
+          result.successful = false;
+          result.reason = "Unexpected parameter name '" + parameter.get_name() + '\'';
+        }
+      }
+
+      return result;
+    });
+
+  declare_parameter("execution_frequency_hz", execution_frequency_hz_);
+  declare_parameter("max_sources_per_cycle", static_cast<int>(sdsm_buffer_.get_max_sources()));
+  declare_parameter("input_queue_depth", input_queue_depth_);
+
+  publisher_ = create_publisher<output_msg_type>("output/detections", input_queue_depth_);
+  diagnostics_publisher_ =
+    create_publisher<diagnostic_msgs::msg::DiagnosticArray>("output/diagnostics", 1);
+
+  subscription_ = create_subscription<input_msg_type>(
+    "input/sdsm", input_queue_depth_, [this](input_msg_shared_pointer msg_ptr) {
+      if (const auto current_state{this->get_current_state().label()}; current_state == "active") {
+        sdsm_msg_callback(*msg_ptr);
+      } else {
+        RCLCPP_WARN(
+          this->get_logger(),
+          "Trying to receive message on the topic '%s', but the containing node is not activated. "
+          "Current node state: '%s'",
+          this->subscription_->get_topic_name(), current_state.c_str());
+      }
+    });
+
+  georeference_subscription_ = create_subscription<std_msgs::msg::String>(
+    "input/georeference", 1,
+    [this](std_msgs::msg::String::SharedPtr msg_ptr) { georeference_ = msg_ptr->data; });
+
+  cdasim_clock_sub_ = create_subscription<rosgraph_msgs::msg::Clock>(
+    "input/cdasim_clock", 1,
+    [this](rosgraph_msgs::msg::Clock::ConstSharedPtr msg_ptr) { cdasim_time_ = msg_ptr->clock; });
+
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully configured");
+
+  return carma_ros2_utils::CallbackReturn::SUCCESS;
+}
+
+auto SdsmToDetectionListNode::handle_on_activate(
+  const rclcpp_lifecycle::State & /* previous_state */) -> carma_ros2_utils::CallbackReturn
+{
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: activating");
+
+  // SDSMs buffered before a previous deactivation are stale by now
+  sdsm_buffer_.clear();
+
+  const std::chrono::duration<double> period{1.0 / execution_frequency_hz_};
+  pipeline_execution_timer_ = rclcpp::create_timer(
+    this, this->get_clock(), std::chrono::duration_cast<std::chrono::nanoseconds>(period),
+    [this] { execute_pipeline(); });
+
+  diagnostics_timer_ = rclcpp::create_timer(
+    this, this->get_clock(), std::chrono::nanoseconds{kDiagnosticsPeriod},
+    [this] { publish_diagnostics(); });
+
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully activated");
+
+  return carma_ros2_utils::CallbackReturn::SUCCESS;
+}
+
+auto SdsmToDetectionListNode::handle_on_deactivate(
+  const rclcpp_lifecycle::State & /* previous_state */) -> carma_ros2_utils::CallbackReturn
+{
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: deactivating");
+
+  // There is currently no way to change a timer's period in ROS 2, so we will
+  // have to create a new one in case a user changes the period.
+  pipeline_execution_timer_.reset();
+  diagnostics_timer_.reset();
+
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully deactivated");
+
+  return carma_ros2_utils::CallbackReturn::SUCCESS;
+}
+
+auto SdsmToDetectionListNode::handle_on_cleanup(
+  const rclcpp_lifecycle::State & /* previous_state */) -> carma_ros2_utils::CallbackReturn
+{
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: cleaning up");
+
+  // CarmaLifecycleNode does not handle subscriber pointer reseting for us
+  subscription_.reset();
+  georeference_subscription_.reset();
+  cdasim_clock_sub_.reset();
+
+  remove_on_set_parameters_callback(on_set_parameters_callback_.get());
+  undeclare_parameter("execution_frequency_hz");
+  undeclare_parameter("max_sources_per_cycle");
+  undeclare_parameter("input_queue_depth");
+
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully cleaned up");
+
+  return carma_ros2_utils::CallbackReturn::SUCCESS;
+}
+
+auto SdsmToDetectionListNode::handle_on_shutdown(
+  const rclcpp_lifecycle::State & /* previous_state */) -> carma_ros2_utils::CallbackReturn
+{
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: shutting down");
+
+  // CarmaLifecycleNode does not handle subscriber pointer reseting for us
+  subscription_.reset();
+  georeference_subscription_.reset();
+  cdasim_clock_sub_.reset();
+
+  RCLCPP_INFO(get_logger(), "Lifecycle transition: successfully shut down");
+
+  return carma_ros2_utils::CallbackReturn::SUCCESS;
+}
+
+auto SdsmToDetectionListNode::sdsm_msg_callback(const input_msg_type & msg) -> void
+{
+  ++received_sdsm_count_;
+
+  // Octet strings only need to be unique per sender here, so the raw bytes make a fine key
+  std::string source_id{std::cbegin(msg.source_id.id), std::cend(msg.source_id.id)};
+
+  switch (sdsm_buffer_.insert(std::move(source_id), msg, now())) {
+    case decltype(sdsm_buffer_)::InsertResult::kAdded:
+      break;
+    case decltype(sdsm_buffer_)::InsertResult::kReplaced:
+      ++coalesced_sdsm_count_;
+      break;
+    case decltype(sdsm_buffer_)::InsertResult::kRejected:
+      ++dropped_sdsm_count_;
+      RCLCPP_WARN_STREAM(
+        get_logger(), "Dropping SDSM: already buffering SDSMs from "
+                        << sdsm_buffer_.get_max_sources() << " senders this cycle");
+      break;
+  }
+}
+
+auto SdsmToDetectionListNode::execute_pipeline() -> void
+{
+  if (sdsm_buffer_.empty()) {
+    return;
+  }
+
+  const auto entries{sdsm_buffer_.take()};
+  const auto current_time{now()};
+
+  output_msg_type detection_list_msg;
+  rclcpp::Duration max_latency{0, 0};
+
+  for (const auto & entry : entries) {
+    try {
+      auto sender_detections{to_detection_list_msg(entry.message, georeference_)};
+
+      if (cdasim_time_) {
+        // When in simulation, ROS time is CARLA time, but SDSMs use CDASim time
+        const auto time_delta{current_time - cdasim_time_.value()};
+
+        for (auto & detection : sender_detections.detections) {
+          detection.header.stamp = rclcpp::Time(detection.header.stamp) + time_delta;
+        }
+      }
+
+      std::move(
+        std::begin(sender_detections.detections), std::end(sender_detections.detections),
+        std::back_inserter(detection_list_msg.detections));
+
+      max_latency = std::max(max_latency, current_time - entry.receive_time);
+    } catch (const std::runtime_error & e) {
+      ++failed_conversion_count_;
+      RCLCPP_ERROR_STREAM(get_logger(), "Failed to convert SDSM to detection list: " << e.what());
+    }
+  }
+
+  last_max_latency_ = max_latency;
+
+  RCLCPP_DEBUG_STREAM(
+    get_logger(), "Converted SDSMs from " << std::size(entries) << " senders into "
+                                          << std::size(detection_list_msg.detections)
+                                          << " detections. Max latency: "
+                                          << max_latency.seconds() << " s, received: "
+                                          << received_sdsm_count_ << ", coalesced: "
+                                          << coalesced_sdsm_count_ << ", dropped: "
+                                          << dropped_sdsm_count_ << ", failed: "
+                                          << failed_conversion_count_);
+
+  publisher_->publish(detection_list_msg);
+}
+
+auto SdsmToDetectionListNode::publish_diagnostics() -> void
+{
+  diagnostic_msgs::msg::DiagnosticStatus status;
+  status.name = get_fully_qualified_name();
+
+  const auto new_dropped_count{dropped_sdsm_count_ - reported_dropped_sdsm_count_};
+  const auto new_failed_count{failed_conversion_count_ - reported_failed_conversion_count_};
+
+  if (new_dropped_count > 0U || new_failed_count > 0U) {
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::WARN;
+    status.message = "Dropped " + std::to_string(new_dropped_count) + " and failed to convert " +
+                     std::to_string(new_failed_count) + " SDSMs since last report";
+  } else {
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+    status.message = "OK";
+  }
+
+  reported_dropped_sdsm_count_ = dropped_sdsm_count_;
+  reported_failed_conversion_count_ = failed_conversion_count_;
+
+  add_diagnostic_value(status, "received", received_sdsm_count_);
+  add_diagnostic_value(status, "coalesced", coalesced_sdsm_count_);
+  add_diagnostic_value(status, "dropped", dropped_sdsm_count_);
+  add_diagnostic_value(status, "failed_conversion", failed_conversion_count_);
+  add_diagnostic_value(status, "last_max_latency_ms", last_max_latency_.seconds() * 1e3);
+
+  diagnostic_msgs::msg::DiagnosticArray diagnostics;
+  diagnostics.header.stamp = now();
+  diagnostics.status.push_back(std::move(status));
+
+  diagnostics_publisher_->publish(diagnostics);
+}
+
+}  // namespace carma_cooperative_perception
+
 // This is not our macro, so we should not worry about linting it.
 // clang-tidy added support for ignoring system macros in release 14.0.0 (see the release notes
 // here: https://releases.llvm.org/14.0.0/tools/clang/tools/extra/docs/ReleaseNotes.html), but
@@ -15,6 +15,7 @@
 #include "carma_cooperative_perception/track_list_to_external_object_list_component.hpp"
 
 #include <rclcpp_components/register_node_macro.hpp>
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -54,6 +55,50 @@ auto TrackListToExternalObjectListNode::handle_on_configure(
       }
     });
 
+  on_set_parameters_callback_ =
+    add_on_set_parameters_callback([this](const std::vector<rclcpp::Parameter> & parameters) {
+      rcl_interfaces::msg::SetParametersResult result;
+      result.successful = true;
+      result.reason = "success";
+
+      for (const auto & parameter : parameters) {
+        if (parameter.get_name() == "enable_track_predictions") {
+          this->enable_track_predictions_ = parameter.as_bool();
+        } else if (
+          parameter.get_name() == "prediction_time_step" ||
+          parameter.get_name() == "prediction_period" ||
+          parameter.get_name() == "prediction_process_noise_max") {
+          if (const auto value{parameter.as_double()}; value <= 0.0) {
+            result.successful = false;
+            result.reason = "parameter must be positive";
+
+            RCLCPP_ERROR(
+              get_logger(),
+              "Cannot change parameter '" + parameter.get_name() + "': " + result.reason);
+
+            break;
+          } else if (parameter.get_name() == "prediction_time_step") {
+            this->prediction_settings_.time_step = units::time::second_t{value};
+          } else if (parameter.get_name() == "prediction_period") {
+            this->prediction_settings_.period = units::time::second_t{value};
+          } else {
+            this->prediction_settings_.process_noise_max = value;
+          }
+        } else {
+          result.successful = false;
+          result.reason = "Unexpected parameter name '" + parameter.get_name() + '\'';
+          break;
+        }
+      }
+
+      return result;
+    });
+
+  declare_parameter("enable_track_predictions", enable_track_predictions_);
+  declare_parameter("prediction_time_step", remove_units(prediction_settings_.time_step));
+  declare_parameter("prediction_period", remove_units(prediction_settings_.period));
+  declare_parameter("prediction_process_noise_max", prediction_settings_.process_noise_max);
+
   return carma_ros2_utils::CallbackReturn::SUCCESS;
 }
 
@@ -63,6 +108,12 @@ auto TrackListToExternalObjectListNode::handle_on_cleanup(
   // CarmaLifecycleNode does not handle subscriber pointer reseting for us
   track_list_subscription_.reset();
 
+  undeclare_parameter("enable_track_predictions");
+  undeclare_parameter("prediction_time_step");
+  undeclare_parameter("prediction_period");
+  undeclare_parameter("prediction_process_noise_max");
+  remove_on_set_parameters_callback(on_set_parameters_callback_.get());
+
   return carma_ros2_utils::CallbackReturn::SUCCESS;
 }
 
@@ -79,9 +130,40 @@ auto TrackListToExternalObjectListNode::publish_as_external_object_list(
   const carma_cooperative_perception_interfaces::msg::TrackList & msg) const -> void
 {
   auto external_object_list{to_external_object_list_msg(msg)};
-  external_object_list.header.stamp = now();
+
+  // Each object keeps the time its track state was estimated at. The list is stamped with the
+  // most recent of those times so consumers can compensate for the actual measurement latency.
+  const auto latest_track{std::max_element(
+    std::cbegin(msg.tracks), std::cend(msg.tracks), [](const auto & lhs, const auto & rhs) {
+      return rclcpp::Time{lhs.header.stamp} < rclcpp::Time{rhs.header.stamp};
+    })};
+
+  if (
+    latest_track != std::cend(msg.tracks) &&
+    rclcpp::Time{latest_track->header.stamp}.nanoseconds() > 0) {
+    external_object_list.header.stamp = latest_track->header.stamp;
+  } else {
+    external_object_list.header.stamp = now();
+  }
   external_object_list.header.frame_id = "map";
 
+  if (enable_track_predictions_) {
+    for (std::size_t i{0U}; i < std::size(msg.tracks); ++i) {
+      try {
+        auto & external_object{external_object_list.objects.at(i)};
+        external_object.predictions = to_predicted_states(msg.tracks.at(i), prediction_settings_);
+
+        if (!std::empty(external_object.predictions)) {
+          external_object.presence_vector |= external_object.PREDICTION_PRESENCE_VECTOR;
+        }
+      } catch (const std::runtime_error & error) {
+        RCLCPP_WARN(
+          get_logger(), "Not predicting track with ID '%s': %s", msg.tracks.at(i).id.c_str(),
+          error.what());
+      }
+    }
+  }
+
   publisher_->publish(external_object_list);
 }
 
@@ -0,0 +1,107 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <carma_cooperative_perception/host_vehicle_footprint.hpp>
+#include <cmath>
+#include <limits>
+
+namespace cp = carma_cooperative_perception;
+
+using units::literals::operator""_s;
+
+TEST(HostPoseHistory, InterpolateBetweenPoses)
+{
+  cp::HostPoseHistory history{1.0_s, 0.2_s};
+  EXPECT_FALSE(history.pose_at(0.0_s).has_value());
+
+  history.insert(1.0_s, {0.0, 0.0, 0.0});
+  history.insert(1.2_s, {2.0, 0.0, 0.2});
+
+  const auto pose{history.pose_at(1.05_s)};
+  ASSERT_TRUE(pose.has_value());
+  EXPECT_NEAR(pose->x, 0.5, 1e-9);
+  EXPECT_NEAR(pose->yaw, 0.05, 1e-9);
+
+  // Out-of-order poses are inserted by time
+  history.insert(1.1_s, {0.5, 1.0, 0.0});
+  EXPECT_NEAR(history.pose_at(1.1_s)->y, 1.0, 1e-9);
+}
+
+TEST(HostPoseHistory, InterpolateHeadingAcrossPi)
+{
+  cp::HostPoseHistory history{1.0_s, 0.2_s};
+
+  history.insert(0.0_s, {0.0, 0.0, M_PI - 0.1});
+  history.insert(1.0_s, {0.0, 0.0, -M_PI + 0.1});
+
+  EXPECT_NEAR(std::abs(history.pose_at(0.5_s)->yaw), M_PI, 1e-9);
+}
+
+TEST(HostPoseHistory, ExtrapolateWithinLimit)
+{
+  cp::HostPoseHistory history{1.0_s, 0.2_s};
+
+  history.insert(1.0_s, {0.0, 0.0, 0.0});
+  history.insert(1.1_s, {1.0, 0.0, 0.0});
+
+  // Forward extrapolation uses the velocity between the newest poses
+  EXPECT_NEAR(history.pose_at(1.2_s)->x, 2.0, 1e-9);
+  EXPECT_FALSE(history.pose_at(1.4_s).has_value());
+
+  // Backward extrapolation holds the oldest pose
+  EXPECT_NEAR(history.pose_at(0.9_s)->x, 0.0, 1e-9);
+  EXPECT_FALSE(history.pose_at(0.7_s).has_value());
+}
+
+TEST(HostPoseHistory, PruneOldPoses)
+{
+  cp::HostPoseHistory history{0.45_s, 0.1_s};
+
+  for (auto i{0}; i < 20; ++i) {
+    history.insert(units::time::second_t{0.1 * i}, {static_cast<double>(i), 0.0, 0.0});
+  }
+
+  EXPECT_EQ(history.size(), 5U);
+  EXPECT_FALSE(history.pose_at(1.0_s).has_value());
+}
+
+TEST(FootprintMahalanobisDistance, InsideAndOutside)
+{
+  const cp::VehicleFootprint footprint{5.0, 2.0, 1.5};
+
+  // Host heading north, so the footprint spans y in [-1, 4] and x in [-1, 1]
+  const cp::PlanarPose host{10.0, 20.0, M_PI / 2.0};
+
+  geometry_msgs::msg::PoseWithCovariance detection;
+  detection.covariance.at(0) = 0.25;
+  detection.covariance.at(7) = 0.25;
+
+  detection.pose.position.x = 10.5;
+  detection.pose.position.y = 23.5;
+  EXPECT_DOUBLE_EQ(cp::footprint_mahalanobis_distance_squared(host, footprint, detection), 0.0);
+
+  // One meter ahead of the front bumper is two standard deviations away
+  detection.pose.position.x = 10.0;
+  detection.pose.position.y = 25.0;
+  EXPECT_NEAR(cp::footprint_mahalanobis_distance_squared(host, footprint, detection), 4.0, 1e-9);
+
+  // Outside the footprint with no covariance can never be gated
+  detection.covariance.at(0) = 0.0;
+  detection.covariance.at(7) = 0.0;
+  EXPECT_EQ(
+    cp::footprint_mahalanobis_distance_squared(host, footprint, detection),
+    std::numeric_limits<double>::infinity());
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <units.h>
+
+#include <carma_cooperative_perception/measurement_history.hpp>
+#include <limits>
+#include <string>
+
+using History = carma_cooperative_perception::MeasurementHistory<std::string, int>;
+using units::literals::operator""_s;
+using units::literals::operator""_ms;
+
+TEST(MeasurementHistory, InsertIntoCoveringCycle)
+{
+  History history{300_ms};
+  EXPECT_FALSE(history.latest_time().has_value());
+
+  const units::time::second_t unbounded{std::numeric_limits<double>::lowest()};
+  history.add_cycle({unbounded, 10.0_s, 0, {"a"}});
+  history.add_cycle({10.0_s, 10.1_s, 1, {}});
+  history.add_cycle({10.1_s, 10.2_s, 2, {}});
+
+  ASSERT_TRUE(history.latest_time().has_value());
+  EXPECT_DOUBLE_EQ(units::unit_cast<double>(history.latest_time().value()), 10.2);
+
+  // Cycles cover (start_time, end_time]
+  EXPECT_EQ(history.insert("b", 10.1_s), 1U);
+  EXPECT_EQ(history.insert("c", 10.15_s), 2U);
+  EXPECT_EQ(history.insert("d", 9.0_s), 0U);
+  EXPECT_FALSE(history.insert("e", 10.3_s).has_value());
+
+  EXPECT_EQ(std::size(history.at(0).measurements), 2U);
+  EXPECT_EQ(history.at(1).measurements.front(), "b");
+  EXPECT_EQ(history.at(1).state_before, 1);
+  EXPECT_EQ(history.at(2).measurements.front(), "c");
+}
+
+TEST(MeasurementHistory, PruneByLateness)
+{
+  History history{150_ms};
+
+  history.add_cycle({9.9_s, 10.0_s, 0, {}});
+  history.add_cycle({10.0_s, 10.1_s, 1, {}});
+  history.add_cycle({10.1_s, 10.2_s, 2, {}});
+  history.add_cycle({10.2_s, 10.3_s, 3, {}});
+
+  // Only cycles ending within 150 ms of the latest cycle are kept
+  ASSERT_EQ(history.size(), 2U);
+  EXPECT_EQ(history.at(0).state_before, 2);
+  EXPECT_FALSE(history.insert("too old", 10.05_s).has_value());
+  EXPECT_EQ(history.insert("late", 10.15_s), 0U);
+
+  history.set_max_lateness(0_ms);
+  ASSERT_EQ(history.size(), 1U);
+  EXPECT_EQ(history.at(0).state_before, 3);
+
+  // Time going backwards invalidates the history
+  history.add_cycle({5.0_s, 5.1_s, 4, {}});
+  ASSERT_EQ(history.size(), 1U);
+  EXPECT_EQ(history.at(0).state_before, 4);
+
+  history.clear();
+  EXPECT_TRUE(history.empty());
+}
+
+TEST(MeasurementHistory, PruneByCycleCount)
+{
+  History history{1000_ms, 2U};
+
+  history.add_cycle({9.9_s, 10.0_s, 0, {}});
+  history.add_cycle({10.0_s, 10.1_s, 1, {}});
+  history.add_cycle({10.1_s, 10.2_s, 2, {}});
+
+  // Measurements within the lateness window but older than every kept cycle go into the oldest one
+  ASSERT_EQ(history.size(), 2U);
+  EXPECT_EQ(history.at(0).state_before, 1);
+  EXPECT_EQ(history.insert("clamped", 9.95_s), 0U);
+  EXPECT_EQ(history.at(0).measurements.front(), "clamped");
+  EXPECT_FALSE(history.insert("too old", 9.1_s).has_value());
+
+  // At least one cycle is always kept
+  history.set_max_cycles(0U);
+  EXPECT_EQ(history.get_max_cycles(), 1U);
+  ASSERT_EQ(history.size(), 1U);
+  EXPECT_EQ(history.at(0).state_before, 2);
+}
@@ -397,6 +397,26 @@ TEST(ToExternalObject, FromTrackIdTooLarge)
   EXPECT_EQ(external_object.velocity, track.twist);
 }
 */
+TEST(ToExternalObject, KeepsTrackIds)
+{
+  carma_cooperative_perception_interfaces::msg::Track track;
+
+  track.id = "1234";
+  auto external_object{carma_cooperative_perception::to_external_object_msg(track)};
+  EXPECT_TRUE(external_object.presence_vector & external_object.ID_PRESENCE_VECTOR);
+  EXPECT_EQ(external_object.id, 1234U);
+
+  // IDs that are not plain decimal numbers are hashed rather than dropped or partially parsed
+  for (const std::string id : {"abcd", "-1234", "5294967295", "sender1-5"}) {
+    track.id = id;
+    external_object = carma_cooperative_perception::to_external_object_msg(track);
+    EXPECT_TRUE(external_object.presence_vector & external_object.ID_PRESENCE_VECTOR);
+    EXPECT_EQ(external_object.id, carma_cooperative_perception::to_external_object_msg(track).id);
+  }
+
+  EXPECT_NE(external_object.id, 15U);
+}
+
 TEST(ToExternalObjectList, FromTrackList)
 {
   carma_cooperative_perception_interfaces::msg::TrackList track_list;
@@ -534,3 +554,50 @@ TEST(ToSdsmMsg, getRelativePosition)
     carma_cooperative_perception::calc_relative_position(source_pose, position_offset);
   EXPECT_EQ(adjusted_pose.offset_x.object_distance, 10);
 }
+
+TEST(ToPredictedStates, ConstantVelocityTrack)
+{
+  carma_cooperative_perception_interfaces::msg::Track track;
+  track.header.stamp.sec = 1;
+  track.header.frame_id = "map";
+  track.id = "1";
+  track.motion_model = track.MOTION_MODEL_CTRV;
+  track.pose.pose.orientation.w = 1.0;
+  track.twist.twist.linear.x = 2.0;
+  track.pose.covariance.at(0) = 0.1;
+  track.pose.covariance.at(7) = 0.1;
+
+  carma_cooperative_perception::TrackPredictionSettings settings;
+  settings.time_step = units::time::second_t{0.5};
+  settings.period = units::time::second_t{1.0};
+
+  const auto predictions{carma_cooperative_perception::to_predicted_states(track, settings)};
+
+  ASSERT_EQ(std::size(predictions), 2U);
+
+  EXPECT_EQ(predictions.at(0).header.stamp.sec, 1);
+  EXPECT_EQ(predictions.at(0).header.stamp.nanosec, 500'000'000U);
+  EXPECT_NEAR(predictions.at(0).predicted_position.position.x, 1.0, 1e-3);
+  EXPECT_NEAR(predictions.at(0).predicted_position.position.y, 0.0, 1e-3);
+
+  EXPECT_EQ(predictions.at(1).header.stamp.sec, 2);
+  EXPECT_NEAR(predictions.at(1).predicted_position.position.x, 2.0, 1e-3);
+  EXPECT_NEAR(predictions.at(1).predicted_velocity.linear.x, 2.0, 1e-3);
+
+  // Uncertainty only grows while propagating
+  EXPECT_LE(predictions.at(0).predicted_position_confidence, 1.0);
+  EXPECT_LE(
+    predictions.at(1).predicted_position_confidence,
+    predictions.at(0).predicted_position_confidence);
+}
+
+TEST(ToPredictedStates, UnsupportedMotionModel)
+{
+  carma_cooperative_perception_interfaces::msg::Track track;
+  track.motion_model = track.MOTION_MODEL_CV;
+
+  EXPECT_THROW(
+    carma_cooperative_perception::to_predicted_states(
+      track, carma_cooperative_perception::TrackPredictionSettings{}),
+    std::runtime_error);
+}
@@ -0,0 +1,407 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <rclcpp/rclcpp.hpp>
+
+#include <carma_cooperative_perception/multiple_object_tracker_component.hpp>
+#include <carma_cooperative_perception_interfaces/msg/detection_list.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Association quality bounds. The build passes the values of the matching CMake cache variables.
+#ifndef TRACKER_BENCHMARK_MIN_ACCURACY
+#define TRACKER_BENCHMARK_MIN_ACCURACY 0.8
+#endif
+
+#ifndef TRACKER_BENCHMARK_MAX_DUPLICATE_RATE
+#define TRACKER_BENCHMARK_MAX_DUPLICATE_RATE 0.1
+#endif
+
+#ifndef TRACKER_BENCHMARK_MAX_ID_SWITCH_RATE
+#define TRACKER_BENCHMARK_MAX_ID_SWITCH_RATE 0.02
+#endif
+
+namespace
+{
+/**
+ * @brief Parameters of a deterministic synthetic traffic scene
+ *
+ * Objects move at constant velocity in two perpendicular flows (eastbound and northbound) laid out
+ * on a grid, so the flows cross each other. Every sender reports every object it does not drop,
+ * with its own position noise and its own detection IDs, so each object normally shows up as
+ * several duplicate detections per cycle.
+*/
+struct SceneConfig
+{
+  std::size_t object_count{100U};
+  std::size_t sender_count{3U};
+  std::size_t cycle_count{60U};
+  std::size_t warm_up_cycles{10U};
+  double cycle_period_s{0.1};
+  double speed_mps{10.0};
+  double lane_spacing_m{20.0};
+  double object_spacing_m{40.0};
+  double dropout_probability{0.1};
+  double max_sender_latency_s{0.05};
+  std::uint32_t seed{42U};
+};
+
+struct GroundTruthObject
+{
+  double x{0.0};
+  double y{0.0};
+  double yaw{0.0};
+};
+
+auto object_position_at(const GroundTruthObject & object, double speed_mps, double elapsed_s)
+  -> GroundTruthObject
+{
+  return {
+    object.x + speed_mps * elapsed_s * std::cos(object.yaw),
+    object.y + speed_mps * elapsed_s * std::sin(object.yaw), object.yaw};
+}
+
+auto make_ground_truth(const SceneConfig & config) -> std::vector<GroundTruthObject>
+{
+  constexpr std::size_t lane_count{10U};
+
+  std::vector<GroundTruthObject> objects;
+  objects.reserve(config.object_count);
+
+  for (std::size_t i{0U}; i < config.object_count; ++i) {
+    const auto slot{i / 2U};
+    const auto lane_offset{static_cast<double>(slot % lane_count) * config.lane_spacing_m};
+    const auto along_offset{static_cast<double>(slot / lane_count) * config.object_spacing_m};
+
+    if (i % 2U == 0U) {
+      objects.push_back({along_offset, lane_offset, 0.0});
+    } else {
+      // Offset by half a lane so northbound objects drive between the eastbound ones' start
+      // positions and cross the eastbound lanes while the scene runs
+      objects.push_back(
+        {lane_offset + config.lane_spacing_m / 2.0, along_offset - config.object_spacing_m / 2.0,
+         M_PI / 2.0});
+    }
+  }
+
+  return objects;
+}
+
+auto to_stamp(double time_s) -> builtin_interfaces::msg::Time
+{
+  builtin_interfaces::msg::Time stamp;
+  stamp.sec = static_cast<std::int32_t>(std::floor(time_s));
+  stamp.nanosec = static_cast<std::uint32_t>((time_s - std::floor(time_s)) * 1e9);
+
+  return stamp;
+}
+
+/**
+ * @brief Generates the detection lists every sender publishes during a cycle
+ *
+ * The same seed always produces the same scene, so runs can be compared across builds.
+*/
+class SyntheticSceneGenerator
+{
+public:
+  explicit SyntheticSceneGenerator(const SceneConfig & config)
+  : config_{config}, objects_{make_ground_truth(config)}, random_engine_{config.seed}
+  {
+    for (std::size_t sender{0U}; sender < config_.sender_count; ++sender) {
+      position_noise_std_m_.push_back(0.1 + 0.1 * static_cast<double>(sender));
+    }
+  }
+
+  auto ground_truth_at(double elapsed_s) const -> std::vector<GroundTruthObject>
+  {
+    std::vector<GroundTruthObject> positions;
+    positions.reserve(std::size(objects_));
+
+    for (const auto & object : objects_) {
+      positions.push_back(object_position_at(object, config_.speed_mps, elapsed_s));
+    }
+
+    return positions;
+  }
+
+  /**
+   * @brief Detection lists for the cycle ending at cycle_end_s, one per sender
+   *
+   * Detections are stamped within the cycle so none of them are late.
+  */
+  auto make_detection_lists(double start_time_s, double cycle_end_s)
+    -> std::vector<carma_cooperative_perception_interfaces::msg::DetectionList>
+  {
+    std::uniform_real_distribution<double> latency_s{0.0, config_.max_sender_latency_s};
+    std::bernoulli_distribution dropped{config_.dropout_probability};
+
+    std::vector<carma_cooperative_perception_interfaces::msg::DetectionList> lists;
+    lists.reserve(config_.sender_count);
+
+    for (std::size_t sender{0U}; sender < config_.sender_count; ++sender) {
+      std::normal_distribution<double> noise_m{0.0, position_noise_std_m_.at(sender)};
+      const auto stamp_s{cycle_end_s - latency_s(random_engine_)};
+      const auto variance{std::pow(position_noise_std_m_.at(sender), 2)};
+
+      carma_cooperative_perception_interfaces::msg::DetectionList list;
+      list.detections.reserve(std::size(objects_));
+
+      for (std::size_t i{0U}; i < std::size(objects_); ++i) {
+        if (dropped(random_engine_)) {
+          continue;
+        }
+
+        const auto truth{
+          object_position_at(objects_.at(i), config_.speed_mps, stamp_s - start_time_s)};
+
+        carma_cooperative_perception_interfaces::msg::Detection detection;
+        detection.header.stamp = to_stamp(stamp_s);
+        detection.header.frame_id = "map";
+        detection.id = "sender" + std::to_string(sender) + "-" + std::to_string(i);
+        detection.motion_model = detection.MOTION_MODEL_CTRV;
+        detection.semantic_class = 1;  // small vehicle
+
+        detection.pose.pose.position.x = truth.x + noise_m(random_engine_);
+        detection.pose.pose.position.y = truth.y + noise_m(random_engine_);
+        detection.pose.pose.orientation.z = std::sin(truth.yaw / 2.0);
+        detection.pose.pose.orientation.w = std::cos(truth.yaw / 2.0);
+        detection.twist.twist.linear.x = config_.speed_mps;
+
+        detection.pose.covariance.at(0) = variance;
+        detection.pose.covariance.at(7) = variance;
+        detection.pose.covariance.at(35) = 0.01;
+        detection.twist.covariance.at(0) = 0.25;
+        detection.twist.covariance.at(35) = 0.01;
+
+        list.detections.push_back(std::move(detection));
+      }
+
+      lists.push_back(std::move(list));
+    }
+
+    return lists;
+  }
+
+private:
+  SceneConfig config_;
+  std::vector<GroundTruthObject> objects_;
+  std::vector<double> position_noise_std_m_;
+  std::mt19937 random_engine_;
+};
+
+auto get_track_position(const carma_cooperative_perception::Track & track)
+{
+  return std::visit(
+    [](const auto & t) {
+      return std::pair{
+        multiple_object_tracking::remove_units(t.state.position_x),
+        multiple_object_tracking::remove_units(t.state.position_y)};
+    },
+    track);
+}
+
+/**
+ * @brief Association quality accumulated over the scored (post warm-up) cycles
+*/
+struct AssociationStats
+{
+  std::size_t object_samples{0U};
+  std::size_t uniquely_tracked_samples{0U};
+  std::size_t duplicate_tracks{0U};
+  std::size_t false_tracks{0U};
+  std::size_t id_switches{0U};
+
+  auto accuracy() const -> double { return per_object_sample(uniquely_tracked_samples); }
+
+  auto duplicate_rate() const -> double { return per_object_sample(duplicate_tracks); }
+
+  auto id_switch_rate() const -> double { return per_object_sample(id_switches); }
+
+private:
+  auto per_object_sample(std::size_t count) const -> double
+  {
+    return object_samples == 0U
+             ? 0.0
+             : static_cast<double>(count) / static_cast<double>(object_samples);
+  }
+};
+
+/**
+ * @brief Match confirmed tracks to the nearest ground truth object within the gate
+ *
+ * An object counts as uniquely tracked if exactly one track matches it. Extra tracks on the same
+ * object are duplicates, and tracks matching no object are false tracks. An ID switch is counted
+ * when the track nearest to an object changes handle between cycles.
+*/
+auto score_cycle(
+  const std::vector<carma_cooperative_perception::Track> & tracks,
+  const std::vector<GroundTruthObject> & truth,
+  std::unordered_map<std::size_t, std::string> & last_track_ids, AssociationStats & stats) -> void
+{
+  constexpr double gate_m{2.0};
+
+  std::vector<std::size_t> match_counts(std::size(truth), 0U);
+  std::vector<double> best_distances(std::size(truth), std::numeric_limits<double>::infinity());
+  std::vector<std::string> best_track_ids(std::size(truth));
+
+  for (const auto & track : tracks) {
+    const auto [x, y]{get_track_position(track)};
+
+    auto nearest{std::size(truth)};
+    auto nearest_distance{gate_m};
+    for (std::size_t i{0U}; i < std::size(truth); ++i) {
+      const auto distance{std::hypot(truth.at(i).x - x, truth.at(i).y - y)};
+      if (distance < nearest_distance) {
+        nearest = i;
+        nearest_distance = distance;
+      }
+    }
+
+    if (nearest == std::size(truth)) {
+      ++stats.false_tracks;
+      continue;
+    }
+
+    ++match_counts.at(nearest);
+    if (nearest_distance < best_distances.at(nearest)) {
+      best_distances.at(nearest) = nearest_distance;
+      best_track_ids.at(nearest) = multiple_object_tracking::get_uuid(track).value();
+    }
+  }
+
+  for (std::size_t i{0U}; i < std::size(truth); ++i) {
+    ++stats.object_samples;
+
+    if (match_counts.at(i) == 0U) {
+      continue;
+    }
+
+    if (match_counts.at(i) == 1U) {
+      ++stats.uniquely_tracked_samples;
+    } else {
+      stats.duplicate_tracks += match_counts.at(i) - 1U;
+    }
+
+    if (const auto it{last_track_ids.find(i)};
+        it != std::end(last_track_ids) && it->second != best_track_ids.at(i)) {
+      ++stats.id_switches;
+    }
+
+    last_track_ids[i] = best_track_ids.at(i);
+  }
+}
+
+auto percentile(std::vector<double> samples, double fraction) -> double
+{
+  if (samples.empty()) {
+    return 0.0;
+  }
+
+  const auto index{static_cast<std::size_t>(
+    std::ceil(fraction * static_cast<double>(std::size(samples))) - 1.0)};
+  const auto nth{std::begin(samples) + std::min(index, std::size(samples) - 1U)};
+  std::nth_element(std::begin(samples), nth, std::end(samples));
+
+  return *nth;
+}
+
+}  // namespace
+
+// Reports per-cycle tracker latency and association quality as the number of objects grows.
+// Detection lists are handed to the node directly, so ROS transport is not part of the timing.
+// Timing is only reported, not asserted, as the result depends on the load of the host. The scene
+// is deterministic, so association accuracy, duplicate tracks and ID switches are checked against
+// the configured bounds.
+TEST(MultipleObjectTrackerBenchmark, SyntheticSceneScalability)
+{
+  for (const auto object_count : {100U, 200U, 400U}) {
+    SceneConfig config;
+    config.object_count = object_count;
+
+    SyntheticSceneGenerator scene{config};
+    const auto tracker{std::make_shared<carma_cooperative_perception::MultipleObjectTrackerNode>(
+      rclcpp::NodeOptions{})};
+
+    constexpr double start_time_s{1000.0};
+    std::vector<double> cycle_latencies_ms;
+    std::unordered_map<std::size_t, std::string> last_track_ids;
+    AssociationStats stats;
+
+    for (std::size_t cycle{1U}; cycle <= config.cycle_count; ++cycle) {
+      const auto cycle_end_s{start_time_s + static_cast<double>(cycle) * config.cycle_period_s};
+      const auto detection_lists{scene.make_detection_lists(start_time_s, cycle_end_s)};
+
+      const auto cycle_start{std::chrono::steady_clock::now()};
+      for (const auto & detection_list : detection_lists) {
+        tracker->store_new_detections(detection_list);
+      }
+      tracker->execute_pipeline(units::time::second_t{cycle_end_s});
+      const auto cycle_end{std::chrono::steady_clock::now()};
+
+      cycle_latencies_ms.push_back(
+        std::chrono::duration<double, std::milli>(cycle_end - cycle_start).count());
+
+      if (cycle > config.warm_up_cycles) {
+        score_cycle(
+          tracker->get_confirmed_tracks(), scene.ground_truth_at(cycle_end_s - start_time_s),
+          last_track_ids, stats);
+      }
+    }
+
+    std::cout << "Objects: " << object_count << ", senders: " << config.sender_count
+              << ", cycles: " << config.cycle_count << '\n'
+              << "  cycle latency ms p50: " << percentile(cycle_latencies_ms, 0.50)
+              << ", p90: " << percentile(cycle_latencies_ms, 0.90)
+              << ", p99: " << percentile(cycle_latencies_ms, 0.99)
+              << ", max: " << percentile(cycle_latencies_ms, 1.0) << '\n'
+              << "  association accuracy: " << stats.accuracy()
+              << ", duplicate tracks: " << stats.duplicate_tracks
+              << ", false tracks: " << stats.false_tracks << ", ID switches: " << stats.id_switches
+              << std::endl;
+
+    EXPECT_EQ(tracker->get_late_measurement_count(), 0U);
+    EXPECT_GE(stats.accuracy(), TRACKER_BENCHMARK_MIN_ACCURACY) << "Objects: " << object_count;
+    EXPECT_LE(stats.duplicate_rate(), TRACKER_BENCHMARK_MAX_DUPLICATE_RATE)
+      << "Objects: " << object_count;
+    EXPECT_LE(stats.id_switch_rate(), TRACKER_BENCHMARK_MAX_ID_SWITCH_RATE)
+      << "Objects: " << object_count;
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  rclcpp::init(argc, argv);
+
+  const auto result{RUN_ALL_TESTS()};
+
+  rclcpp::shutdown();
+
+  return result;
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <rclcpp/rclcpp.hpp>
+
+#include <carma_cooperative_perception/multiple_object_tracker_component.hpp>
+#include <carma_cooperative_perception_interfaces/msg/detection_list.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <variant>
+
+namespace
+{
+auto make_detection(const std::string & id, double x, double y, double stamp_s)
+  -> carma_cooperative_perception_interfaces::msg::Detection
+{
+  carma_cooperative_perception_interfaces::msg::Detection detection;
+  detection.header.stamp.sec = static_cast<std::int32_t>(std::floor(stamp_s));
+  detection.header.stamp.nanosec =
+    static_cast<std::uint32_t>(std::round((stamp_s - std::floor(stamp_s)) * 1e9));
+  detection.header.frame_id = "map";
+  detection.id = id;
+  detection.motion_model = detection.MOTION_MODEL_CTRV;
+  detection.semantic_class = 1;  // small vehicle
+
+  detection.pose.pose.position.x = x;
+  detection.pose.pose.position.y = y;
+  detection.pose.pose.orientation.w = 1.0;
+
+  detection.pose.covariance.at(0) = 0.01;
+  detection.pose.covariance.at(7) = 0.01;
+  detection.pose.covariance.at(35) = 0.01;
+  detection.twist.covariance.at(0) = 0.25;
+  detection.twist.covariance.at(35) = 0.01;
+
+  return detection;
+}
+
+auto get_track_x(const carma_cooperative_perception::Track & track) -> double
+{
+  return std::visit(
+    [](const auto & t) { return multiple_object_tracking::remove_units(t.state.position_x); },
+    track);
+}
+
+}  // namespace
+
+// Object A is tracked and published first. Detections of object B then arrive late enough to be
+// fused in cycles before A's track was created, so the replay creates B's track first. The IDs
+// A was published with must not be handed to B.
+TEST(MultipleObjectTracker, ReplayDoesNotReusePublishedIds)
+{
+  const auto tracker{std::make_shared<carma_cooperative_perception::MultipleObjectTrackerNode>(
+    rclcpp::NodeOptions{})};
+
+  constexpr double a_x{0.0};
+  constexpr double b_x{50.0};
+
+  // Object each published track ID has referred to, identified by its x position
+  std::map<std::string, double> published_ids;
+  const auto check_published_ids{[&] {
+    for (const auto & track : tracker->get_confirmed_tracks()) {
+      const auto id{multiple_object_tracking::get_uuid(track).value()};
+      const auto object_x{std::abs(get_track_x(track) - a_x) < std::abs(get_track_x(track) - b_x)
+                            ? a_x
+                            : b_x};
+
+      if (const auto [it, inserted]{published_ids.emplace(id, object_x)}; !inserted) {
+        EXPECT_EQ(it->second, object_x) << "Track ID " << id << " was reused for another object";
+      }
+    }
+  }};
+
+  // Empty first cycle so the late detections of B have a cycle to go into
+  tracker->execute_pipeline(units::time::second_t{1.0});
+
+  for (const auto cycle_end_s : {1.1, 1.2, 1.3, 1.4}) {
+    carma_cooperative_perception_interfaces::msg::DetectionList list;
+    list.detections.push_back(make_detection("a", a_x, 0.0, cycle_end_s - 0.05));
+    tracker->store_new_detections(list);
+    tracker->execute_pipeline(units::time::second_t{cycle_end_s});
+    check_published_ids();
+  }
+
+  ASSERT_FALSE(tracker->get_confirmed_tracks().empty());
+
+  // B's detections for the cycles that already ran arrive together with its first on-time one
+  carma_cooperative_perception_interfaces::msg::DetectionList late_list;
+  for (const auto stamp_s : {0.95, 1.05, 1.15, 1.25}) {
+    late_list.detections.push_back(make_detection("b", b_x, 0.0, stamp_s));
+  }
+  tracker->store_new_detections(late_list);
+
+  for (const auto cycle_end_s : {1.5, 1.6, 1.7, 1.8}) {
+    carma_cooperative_perception_interfaces::msg::DetectionList list;
+    list.detections.push_back(make_detection("a", a_x, 0.0, cycle_end_s - 0.05));
+    list.detections.push_back(make_detection("b", b_x, 0.0, cycle_end_s - 0.05));
+    tracker->store_new_detections(list);
+    tracker->execute_pipeline(units::time::second_t{cycle_end_s});
+    check_published_ids();
+  }
+
+  EXPECT_EQ(tracker->get_late_measurement_count(), 4U);
+  EXPECT_EQ(std::size(tracker->get_confirmed_tracks()), 2U);
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  rclcpp::init(argc, argv);
+
+  const auto result{RUN_ALL_TESTS()};
+
+  rclcpp::shutdown();
+
+  return result;
+}
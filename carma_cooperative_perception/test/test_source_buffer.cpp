@@ -0,0 +1,66 @@
+// Copyright 2026 Leidos
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <carma_cooperative_perception/source_buffer.hpp>
+#include <string>
+
+using Buffer = carma_cooperative_perception::LatestBySourceBuffer<std::string, double>;
+
+TEST(LatestBySourceBuffer, CoalescePerSource)
+{
+  Buffer buffer{4U};
+  EXPECT_TRUE(buffer.empty());
+
+  EXPECT_EQ(buffer.insert("rsu", "a", 1.0), Buffer::InsertResult::kAdded);
+  EXPECT_EQ(buffer.insert("cv", "b", 1.1), Buffer::InsertResult::kAdded);
+  EXPECT_EQ(buffer.insert("rsu", "c", 1.2), Buffer::InsertResult::kReplaced);
+
+  EXPECT_EQ(buffer.size(), 2U);
+
+  // Sources keep the order of their first message while holding their latest one
+  const auto entries{buffer.take()};
+  ASSERT_EQ(std::size(entries), 2U);
+  EXPECT_EQ(entries.at(0).source_id, "rsu");
+  EXPECT_EQ(entries.at(0).message, "c");
+  EXPECT_DOUBLE_EQ(entries.at(0).receive_time, 1.2);
+  EXPECT_EQ(entries.at(1).source_id, "cv");
+  EXPECT_EQ(entries.at(1).message, "b");
+
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_TRUE(buffer.take().empty());
+
+  // Sources from a previous take start over
+  EXPECT_EQ(buffer.insert("rsu", "d", 2.0), Buffer::InsertResult::kAdded);
+}
+
+TEST(LatestBySourceBuffer, RejectNewSourcesWhenFull)
+{
+  Buffer buffer{2U};
+
+  EXPECT_EQ(buffer.insert("a", "1", 1.0), Buffer::InsertResult::kAdded);
+  EXPECT_EQ(buffer.insert("b", "1", 1.0), Buffer::InsertResult::kAdded);
+  EXPECT_EQ(buffer.insert("c", "1", 1.0), Buffer::InsertResult::kRejected);
+
+  // Known sources can still be updated
+  EXPECT_EQ(buffer.insert("a", "2", 1.1), Buffer::InsertResult::kReplaced);
+  EXPECT_EQ(buffer.size(), 2U);
+
+  buffer.set_max_sources(3U);
+  EXPECT_EQ(buffer.insert("c", "1", 1.2), Buffer::InsertResult::kAdded);
+
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <boost/optional.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <carma_planning_msgs/msg/guidance_state.hpp>
+
+namespace carma_guidance_plugins
+{
+
+  /**
+   * \brief Suspends a node's periodic timers while guidance is not in one of a set of running states.
+   *
+   * The guidance node publishes its state on a latched topic only when the state changes (plus a slow heartbeat).
+   * Subscribe to that topic with GuidanceStateGate::qos() and forward every message to on_guidance_state().
+   * Registered timers are cancelled when guidance leaves the running states and reset when it returns to them,
+   * so the first tick after engagement is exactly one period after the transition was received.
+   *
+   * Until the first guidance state is received the gate is open, which preserves the behavior of nodes run without guidance.
+   */
+  class GuidanceStateGate
+  {
+  public:
+
+    /**
+     * \brief Callback invoked on each guidance state transition
+     *
+     * \param previous_state The previous guidance state. Empty if this is the first state received
+     * \param state The new guidance state
+     */
+    using TransitionCallback = std::function<void(const boost::optional<uint8_t>& previous_state, uint8_t state)>;
+
+    /**
+     * \brief Constructor
+     *
+     * \param running_states The guidance states in which registered timers run. Defaults to ENGAGED only
+     */
+    explicit GuidanceStateGate(std::vector<uint8_t> running_states = { carma_planning_msgs::msg::GuidanceState::ENGAGED });
+
+    /**
+     * \brief QoS to use for guidance state subscriptions so the current state is received on subscription
+     */
+    static rclcpp::QoS qos();
+
+    /**
+     * \brief Register a timer to be suspended while guidance is not running. The timer is cancelled immediately if the gate is closed.
+     *
+     * \param timer The timer to manage
+     */
+    void add_timer(const rclcpp::TimerBase::SharedPtr& timer);
+
+    /**
+     * \brief Stop managing all registered timers. Should be called when the timers are destroyed, for example on deactivation.
+     */
+    void clear_timers();
+
+    /**
+     * \brief Set a callback to be invoked after each transition once the registered timers have been updated
+     */
+    void set_transition_callback(TransitionCallback callback);
+
+    /**
+     * \brief Update the gate with a received guidance state. Messages which repeat the current state are ignored.
+     *
+     * \param msg The received guidance state
+     * \param receive_time The time the message was received. Recorded as the time of the transition
+     *
+     * \return True if the message was a transition
+     */
+    bool on_guidance_state(const carma_planning_msgs::msg::GuidanceState& msg, const rclcpp::Time& receive_time);
+
+    /**
+     * \brief Returns true if registered timers are currently running
+     */
+    bool is_open() const;
+
+    /**
+     * \brief Returns the current guidance state. Empty if no state was received yet
+     */
+    boost::optional<uint8_t> get_state() const;
+
+    /**
+     * \brief Returns the time the current guidance state was entered. Empty if no state was received yet
+     */
+    boost::optional<rclcpp::Time> get_last_transition_time() const;
+
+  private:
+
+    //! Returns true if the provided state is one of the running states
+    bool is_running_state(uint8_t state) const;
+
+    std::vector<uint8_t> running_states_;
+
+    std::vector<rclcpp::TimerBase::SharedPtr> timers_;
+
+    TransitionCallback transition_callback_;
+
+    boost::optional<uint8_t> state_;
+
+    boost::optional<rclcpp::Time> last_transition_time_;
+  };
+
+} // carma_guidance_plugins
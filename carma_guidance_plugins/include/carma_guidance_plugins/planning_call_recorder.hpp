@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
+#include <autoware_lanelet2_msgs/msg/map_bin.hpp>
+#include <carma_perception_msgs/msg/roadway_obstacle_list.hpp>
+#include <carma_planning_msgs/msg/route.hpp>
+#include <carma_wm/CARMAWorldModel.hpp>
+#include <carma_wm/WorldModel.hpp>
+
+namespace carma_guidance_plugins
+{
+
+  /**
+   * \brief The parts of the world model state which a planning call depends on and which change during operation.
+   *        The map itself is stored separately as it is large and rarely changes.
+   */
+  struct WorldModelSnapshot
+  {
+    //! Version of the map the snapshot was taken against
+    size_t map_version = 0;
+
+    //! The active route. Only route_name and shortest_path_lanelet_ids are populated. Empty if there was no route.
+    carma_planning_msgs::msg::Route route;
+
+    //! Roadway objects known to the world model
+    carma_perception_msgs::msg::RoadwayObstacleList roadway_objects;
+  };
+
+  /**
+   * \brief Record of a single planning service call
+   */
+  template <class ServiceT>
+  struct PlanningCallRecord
+  {
+    //! Wall time when the call started in nanoseconds
+    int64_t stamp_ns = 0;
+
+    //! Time taken by the plugin to handle the call in seconds
+    double duration = 0.0;
+
+    //! The request the plugin was called with
+    typename ServiceT::Request request;
+
+    //! World model state at the start of the call
+    WorldModelSnapshot world_model;
+  };
+
+  /**
+   * \brief Capture the dynamic world model state used by planning calls
+   *
+   * \param wm The world model to capture. May be nullptr in which case an empty snapshot is returned.
+   *
+   * \return The snapshot
+   */
+  WorldModelSnapshot capture_world_model_snapshot(const carma_wm::WorldModelConstPtr& wm);
+
+  /**
+   * \brief Serialize the map currently held by the world model
+   *
+   * \param wm The world model whose map will be converted
+   *
+   * \return The map message. Empty if the world model has no map.
+   */
+  autoware_lanelet2_msgs::msg::MapBin to_map_bin_msg(const carma_wm::WorldModelConstPtr& wm);
+
+  /**
+   * \brief Serialize the provided map
+   *
+   * \param map The map to convert. May be nullptr in which case an empty message is returned.
+   * \param map_version The version to tag the message with
+   *
+   * \return The map message
+   */
+  autoware_lanelet2_msgs::msg::MapBin to_map_bin_msg(const lanelet::LaneletMapConstPtr& map, size_t map_version);
+
+  /**
+   * \brief Load a map message into the provided world model
+   *
+   * \param map_msg The map to load
+   * \param wm The world model to modify
+   */
+  void restore_map(const autoware_lanelet2_msgs::msg::MapBin& map_msg, const std::shared_ptr<carma_wm::CARMAWorldModel>& wm);
+
+  /**
+   * \brief Apply the route and roadway objects of a snapshot to the provided world model. The map must already be loaded.
+   *
+   * \param snapshot The snapshot to apply
+   * \param wm The world model to modify
+   *
+   * \throw std::invalid_argument if the snapshot route cannot be reconstructed on the loaded map
+   */
+  void restore_world_model_snapshot(const WorldModelSnapshot& snapshot, const std::shared_ptr<carma_wm::CARMAWorldModel>& wm);
+
+  /**
+   * \brief Write a ROS message to a file using the ROS serialization format
+   *
+   * \throw std::runtime_error if the file cannot be written
+   */
+  template <class MsgT>
+  void write_serialized_msg(const std::string& path, const MsgT& msg)
+  {
+    rclcpp::Serialization<MsgT> serializer;
+    rclcpp::SerializedMessage serialized;
+    serializer.serialize_message(&msg, &serialized);
+
+    const auto& rcl_msg = serialized.get_rcl_serialized_message();
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(rcl_msg.buffer), rcl_msg.buffer_length);
+
+    if (!file)
+    {
+      throw std::runtime_error("Failed to write serialized message to " + path);
+    }
+  }
+
+  /**
+   * \brief Read a ROS message written by write_serialized_msg
+   *
+   * \throw std::runtime_error if the file cannot be read
+   */
+  template <class MsgT>
+  MsgT read_serialized_msg(const std::string& path)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+      throw std::runtime_error("Failed to open serialized message " + path);
+    }
+
+    std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    rclcpp::SerializedMessage serialized(bytes.size());
+    auto& rcl_msg = serialized.get_rcl_serialized_message();
+    std::copy(bytes.begin(), bytes.end(), rcl_msg.buffer);
+    rcl_msg.buffer_length = bytes.size();
+
+    MsgT msg;
+    rclcpp::Serialization<MsgT> serializer;
+    serializer.deserialize_message(&serialized, &msg);
+
+    return msg;
+  }
+
+  /**
+   * \brief Bounded history of recent planning service calls which can be dumped to disk and read back for offline replay.
+   *
+   * A dump directory contains:
+   *   map.bin                     - The map at the time of the dump
+   *   calls.txt                   - One line per call: <index> <stamp_ns> <duration> <map_version>
+   *   call_<index>_request.bin    - The service request
+   *   call_<index>_route.bin      - The route of the world model snapshot
+   *   call_<index>_objects.bin    - The roadway objects of the world model snapshot
+   *
+   * Calls are ordered from oldest to newest so stateful plugins can be replayed in the original order.
+   */
+  template <class ServiceT>
+  class PlanningCallRecorder
+  {
+  public:
+    using Record = PlanningCallRecord<ServiceT>;
+
+    /**
+     * \brief Constructor
+     *
+     * \param capacity The maximum number of calls to keep. Older calls are discarded first.
+     */
+    explicit PlanningCallRecorder(size_t capacity = 10) : capacity_(capacity) {}
+
+    /**
+     * \brief Set the maximum number of calls to keep. Discards the oldest calls if over the new capacity.
+     */
+    void set_capacity(size_t capacity)
+    {
+      capacity_ = capacity;
+      trim();
+    }
+
+    /**
+     * \brief Add a call to the history
+     */
+    void record(Record record)
+    {
+      records_.emplace_back(std::move(record));
+      trim();
+    }
+
+    /**
+     * \brief Returns the recorded calls ordered from oldest to newest
+     */
+    const std::deque<Record>& get_records() const
+    {
+      return records_;
+    }
+
+    /**
+     * \brief Write the recorded calls and provided map to the provided directory, which must already exist
+     *
+     * \throw std::runtime_error if any file cannot be written
+     */
+    void write_dump(const std::string& directory, const autoware_lanelet2_msgs::msg::MapBin& map_msg) const
+    {
+      write_serialized_msg(directory + "/map.bin", map_msg);
+
+      std::ofstream index(directory + "/calls.txt");
+      for (size_t i = 0; i < records_.size(); ++i)
+      {
+        const auto& record = records_[i];
+        const std::string prefix = directory + "/call_" + std::to_string(i);
+
+        write_serialized_msg(prefix + "_request.bin", record.request);
+        write_serialized_msg(prefix + "_route.bin", record.world_model.route);
+        write_serialized_msg(prefix + "_objects.bin", record.world_model.roadway_objects);
+
+        index << i << " " << record.stamp_ns << " " << record.duration << " " << record.world_model.map_version << "\n";
+      }
+
+      if (!index)
+      {
+        throw std::runtime_error("Failed to write call index to " + directory);
+      }
+    }
+
+    /**
+     * \brief Read the calls and map written by write_dump
+     *
+     * \param directory The dump directory
+     * \param[out] map_msg The map stored in the dump
+     *
+     * \throw std::runtime_error if the dump is incomplete
+     *
+     * \return The recorded calls ordered from oldest to newest
+     */
+    static std::vector<Record> read_dump(const std::string& directory, autoware_lanelet2_msgs::msg::MapBin& map_msg)
+    {
+      map_msg = read_serialized_msg<autoware_lanelet2_msgs::msg::MapBin>(directory + "/map.bin");
+
+      std::ifstream index(directory + "/calls.txt");
+      if (!index)
+      {
+        throw std::runtime_error("Failed to open call index in " + directory);
+      }
+
+      std::vector<Record> records;
+      std::string line;
+      while (std::getline(index, line))
+      {
+        if (line.empty())
+        {
+          continue;
+        }
+
+        std::istringstream fields(line);
+        size_t i;
+        Record record;
+        if (!(fields >> i >> record.stamp_ns >> record.duration >> record.world_model.map_version))
+        {
+          throw std::runtime_error("Malformed call index line: " + line);
+        }
+
+        const std::string prefix = directory + "/call_" + std::to_string(i);
+        record.request = read_serialized_msg<typename ServiceT::Request>(prefix + "_request.bin");
+        record.world_model.route = read_serialized_msg<carma_planning_msgs::msg::Route>(prefix + "_route.bin");
+        record.world_model.roadway_objects =
+            read_serialized_msg<carma_perception_msgs::msg::RoadwayObstacleList>(prefix + "_objects.bin");
+
+        records.emplace_back(std::move(record));
+      }
+
+      return records;
+    }
+
+  private:
+    void trim()
+    {
+      while (records_.size() > capacity_)
+      {
+        records_.pop_front();
+      }
+    }
+
+    size_t capacity_;
+    std::deque<Record> records_;
+  };
+
+} // carma_guidance_plugins
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <rclcpp/rclcpp.hpp>
+#include <carma_wm/CARMAWorldModel.hpp>
+
+#include "carma_guidance_plugins/planning_call_recorder.hpp"
+#include "carma_guidance_plugins/strategic_plugin.hpp"
+#include "carma_guidance_plugins/tactical_plugin.hpp"
+
+namespace carma_guidance_plugins
+{
+
+  /**
+   * \brief Entry point for an offline replay executable of a strategic or tactical plugin.
+   *        Replays a dump written when a planning call exceeded the slow_planning_call_threshold parameter.
+   *
+   * The plugin is constructed and moved to ACTIVE without spinning, so it receives no data from other nodes.
+   * The recorded map is loaded once, then for each recorded call the route and roadway objects are restored
+   * before the plugin callback is invoked directly with the recorded request. Recorded and replayed durations are
+   * printed for each call so the slow call can be reproduced under a profiler.
+   *
+   * Usage: <executable> <dump_dir> [iterations] [--ros-args --params-file <plugin_params.yaml>]
+   *
+   * NOTE: Plugin state which is populated from the plugin's own subscriptions (ex. pose or twist) is not part of the dump.
+   *
+   * \tparam PluginT The plugin node type. Must extend StrategicPlugin or TacticalPlugin.
+   *
+   * \return Process exit code
+   */
+  template <class PluginT>
+  int replay_main(int argc, char** argv)
+  {
+    static_assert(std::is_base_of_v<TacticalPlugin, PluginT> || std::is_base_of_v<StrategicPlugin, PluginT>,
+                  "replay_main only supports tactical and strategic plugins");
+
+    using ServiceT = std::conditional_t<std::is_base_of_v<TacticalPlugin, PluginT>,
+                                        carma_planning_msgs::srv::PlanTrajectory, carma_planning_msgs::srv::PlanManeuvers>;
+
+    auto args = rclcpp::init_and_remove_ros_arguments(argc, argv);
+
+    if (args.size() < 2)
+    {
+      std::cerr << "Usage: " << args[0] << " <dump_dir> [iterations] [--ros-args ...]" << std::endl;
+      rclcpp::shutdown();
+      return 1;
+    }
+
+    const std::string dump_dir = args[1];
+    const int iterations = args.size() > 2 ? std::stoi(args[2]) : 1;
+
+    auto plugin = std::make_shared<PluginT>(rclcpp::NodeOptions());
+    plugin->configure();
+    plugin->activate();
+
+    auto wm = std::const_pointer_cast<carma_wm::CARMAWorldModel>(
+        std::dynamic_pointer_cast<const carma_wm::CARMAWorldModel>(plugin->get_world_model()));
+
+    autoware_lanelet2_msgs::msg::MapBin map_msg;
+    auto records = PlanningCallRecorder<ServiceT>::read_dump(dump_dir, map_msg);
+    restore_map(map_msg, wm);
+
+    std::cout << "Loaded " << records.size() << " calls from " << dump_dir << std::endl;
+
+    for (int iteration = 0; iteration < iterations; ++iteration)
+    {
+      for (size_t i = 0; i < records.size(); ++i)
+      {
+        const auto& record = records[i];
+        restore_world_model_snapshot(record.world_model, wm);
+
+        auto req = std::make_shared<typename ServiceT::Request>(record.request);
+        auto resp = std::make_shared<typename ServiceT::Response>();
+        auto header = std::make_shared<rmw_request_id_t>();
+
+        auto start = std::chrono::steady_clock::now();
+        if constexpr (std::is_base_of_v<TacticalPlugin, PluginT>)
+        {
+          plugin->plan_trajectory_callback(header, req, resp);
+        }
+        else
+        {
+          plugin->plan_maneuvers_callback(header, req, resp);
+        }
+        double duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "iteration: " << iteration << " call: " << i << " recorded: " << record.duration
+                  << " s replayed: " << duration << " s" << std::endl;
+      }
+    }
+
+    plugin->deactivate();
+    rclcpp::shutdown();
+
+    return 0;
+  }
+
+} // carma_guidance_plugins
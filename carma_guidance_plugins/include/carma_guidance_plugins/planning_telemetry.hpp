@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <carma_planning_msgs/msg/maneuver_plan.hpp>
+#include <carma_planning_msgs/msg/trajectory_plan.hpp>
+
+namespace carma_guidance_plugins
+{
+
+  /**
+   * \brief Kinds of planning telemetry records. The meaning of TelemetryRecord::values depends on the kind.
+   */
+  enum class TelemetryRecordType : uint8_t
+  {
+    //! One maneuver of a plan. label: tactical plugin. values: maneuver type, start_dist, end_dist, start_speed, end_speed, duration
+    MANEUVER_PLAN = 1,
+
+    //! One planned trajectory. label: planner plugin. values: point count, duration, path length, start_speed, end_speed, max_speed
+    TRAJECTORY_SUMMARY = 2,
+
+    //! One term of a cost function. label: term name. values: value, weight, weighted value, candidate index
+    COST_TERM = 3,
+
+    //! Branch taken at a decision point. label: decision name. values: branch index, then up to 5 decision inputs
+    DECISION_BRANCH = 4
+  };
+
+  /**
+   * \brief Fixed size binary telemetry record. The layout is part of the telemetry file format read by
+   *        engineering_tools/decode_planning_telemetry.py, so fields must not be reordered or resized
+   *        without bumping TELEMETRY_FILE_VERSION.
+   */
+  struct TelemetryRecord
+  {
+    //! Position of the record in the order records were written
+    uint64_t sequence = 0;
+
+    //! Wall time of the record in nanoseconds
+    int64_t stamp_ns = 0;
+
+    //! Id of the planning call the record was made during. 0 if made outside of a planning call.
+    uint64_t plan_id = 0;
+
+    //! A TelemetryRecordType value
+    uint8_t type = 0;
+
+    uint8_t reserved[7] = {};
+
+    //! Null terminated label. Longer labels are truncated.
+    char label[32] = {};
+
+    //! Record values. Unused values are 0.
+    double values[6] = {};
+  };
+
+  static_assert(std::is_trivially_copyable_v<TelemetryRecord>, "TelemetryRecord is copied as raw bytes");
+  static_assert(sizeof(TelemetryRecord) == 112, "TelemetryRecord layout is part of the telemetry file format");
+  static_assert(sizeof(TelemetryRecord) % sizeof(uint64_t) == 0, "TelemetryRecord is stored as whole 64 bit words");
+
+  //! Version of the telemetry file format written by write_telemetry_file
+  constexpr uint32_t TELEMETRY_FILE_VERSION = 1;
+
+  /**
+   * \brief Bounded, lock-free ring buffer of planning telemetry records.
+   *
+   * Any number of threads may write and read concurrently. Writers take a sequence number with a single atomic increment
+   * and claim the slot for it with a compare and swap on the slot state, so recording never blocks, allocates, or formats
+   * text. When the buffer is full the oldest records are overwritten. In the rare case a writer finds its slot still
+   * being written by a writer a full lap behind, or already taken by a newer record, its record is dropped. Readers take
+   * a snapshot at any time from any thread; records which are overwritten or still being written while the snapshot is
+   * copied are skipped rather than waited for.
+   *
+   * With a capacity of 0 the buffer is disabled and every record call returns after a single branch, so planning
+   * code can be instrumented unconditionally.
+   */
+  class PlanningTelemetry
+  {
+  public:
+    /**
+     * \brief Constructor
+     *
+     * \param capacity The number of records to keep. 0 disables recording.
+     */
+    explicit PlanningTelemetry(size_t capacity = 0);
+
+    /**
+     * \brief Set the number of records to keep and discard all recorded records. 0 disables recording.
+     *
+     * NOTE: Not thread safe. Must not be called while records are being written or read.
+     */
+    void set_capacity(size_t capacity);
+
+    /**
+     * \brief Returns the number of records kept
+     */
+    size_t get_capacity() const;
+
+    /**
+     * \brief Returns true if records are being kept. Callers may use this to skip preparing expensive record inputs.
+     */
+    bool enabled() const
+    {
+      return capacity_ > 0;
+    }
+
+    /**
+     * \brief Start a new planning call on the calling thread. Records made by this thread until it starts another call
+     *        are tagged with the returned id. Ids are unique across threads so concurrent planning calls are told apart.
+     */
+    uint64_t begin_plan();
+
+    /**
+     * \brief Returns the id of the planning call most recently started on the calling thread. 0 if none was started.
+     */
+    uint64_t get_plan_id() const;
+
+    /**
+     * \brief Add a record of the provided type for the current planning call
+     *
+     * \param type The record kind
+     * \param label The record label. Truncated to 31 characters.
+     * \param values The record values. Values beyond the sixth are ignored.
+     */
+    void record(TelemetryRecordType type, std::string_view label, std::initializer_list<double> values);
+
+    /**
+     * \brief Add a MANEUVER_PLAN record for each maneuver in the provided plan
+     */
+    void record_maneuver_plan(const carma_planning_msgs::msg::ManeuverPlan& plan);
+
+    /**
+     * \brief Add a TRAJECTORY_SUMMARY record for the provided trajectory
+     */
+    void record_trajectory_summary(const carma_planning_msgs::msg::TrajectoryPlan& trajectory);
+
+    /**
+     * \brief Add a COST_TERM record
+     *
+     * \param name Name of the cost term
+     * \param value Unweighted value of the term
+     * \param weight Weight applied to the term
+     * \param candidate Index of the candidate being evaluated when several candidates are compared
+     */
+    void record_cost_term(std::string_view name, double value, double weight = 1.0, size_t candidate = 0);
+
+    /**
+     * \brief Add a DECISION_BRANCH record
+     *
+     * \param decision Name of the decision point
+     * \param branch Index of the branch which was taken
+     * \param inputs Values the decision was based on. Inputs beyond the fifth are ignored.
+     */
+    void record_decision_branch(std::string_view decision, int branch, std::initializer_list<double> inputs = {});
+
+    /**
+     * \brief Returns the total number of records written since the capacity was last set, including overwritten and dropped records
+     */
+    uint64_t get_record_count() const;
+
+    /**
+     * \brief Copy the records currently in the buffer
+     *
+     * \return The records ordered from oldest to newest
+     */
+    std::vector<TelemetryRecord> snapshot() const;
+
+  private:
+    //! Number of words a record is stored in. Words are copied atomically so readers never race with writers.
+    static constexpr size_t RECORD_WORDS = sizeof(TelemetryRecord) / sizeof(uint64_t);
+
+    struct Slot
+    {
+      //! 2 * sequence + 1 while record is being written, 2 * sequence + 2 once written
+      std::atomic<uint64_t> state{0};
+
+      std::atomic<uint64_t> words[RECORD_WORDS] = {};
+    };
+
+    void write(TelemetryRecord& record);
+
+    size_t capacity_ = 0;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<uint64_t> write_count_{0};
+
+    //! Number of planning calls started on any thread. Used to hand out plan ids.
+    std::atomic<uint64_t> plan_count_{0};
+  };
+
+  /**
+   * \brief Write records to a binary telemetry file which can be decoded offline with
+   *        engineering_tools/decode_planning_telemetry.py
+   *
+   * The file contains a 24 byte header (8 byte magic "CARMATLM", uint32 version, uint32 record size, uint64 record count)
+   * followed by the records. All values are little-endian.
+   *
+   * \throw std::runtime_error if the file cannot be written
+   */
+  void write_telemetry_file(const std::string& path, const std::vector<TelemetryRecord>& records);
+
+  /**
+   * \brief Read a file written by write_telemetry_file
+   *
+   * \throw std::runtime_error if the file cannot be read or is not a telemetry file of a supported version
+   *
+   * \return The records in the order they were written
+   */
+  std::vector<TelemetryRecord> read_telemetry_file(const std::string& path);
+
+} // carma_guidance_plugins
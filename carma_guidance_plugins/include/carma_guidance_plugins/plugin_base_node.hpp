@@ -16,6 +16,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <optional>
 #include <gtest/gtest_prod.h>
 #include <rclcpp/rclcpp.hpp>
 #include <carma_planning_msgs/msg/plugin.hpp>
@@ -24,6 +29,9 @@
 
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
 
+#include "carma_guidance_plugins/planning_call_recorder.hpp"
+#include "carma_guidance_plugins/planning_telemetry.hpp"
+
 namespace carma_guidance_plugins
 {
 
@@ -70,6 +78,157 @@ namespace carma_guidance_plugins
      */ 
     void lazy_wm_initialization();
 
+    // Planning call capture parameters
+    //! Number of recent planning calls to keep. 0 disables capture.
+    int planning_call_history_size_ = 0;
+
+    //! Duration in seconds above which a planning call and the recorded history are dumped to disk. 0 disables dumping.
+    double slow_planning_call_threshold_ = 0.0;
+
+    //! Minimum time in seconds between slow planning call dumps. Slow calls within this time of the last dump are only logged.
+    double slow_planning_call_dump_interval_ = 60.0;
+
+    //! Time the last slow planning call dump was started. Empty if no dump has been written.
+    std::optional<std::chrono::steady_clock::time_point> last_slow_planning_call_dump_;
+
+    //! Slow planning call dump being written in the background. Invalid if no dump has been started.
+    std::future<void> slow_planning_call_dump_;
+
+    //! Directory under which slow planning call dumps are written
+    std::string slow_planning_call_dump_dir_ = "/opt/carma/logs/planning_calls";
+
+    //! Number of planning telemetry records to keep. 0 disables telemetry.
+    int planning_telemetry_capacity_ = 0;
+
+    //! Recent planning telemetry records. Written with slow planning call dumps and on shutdown.
+    PlanningTelemetry planning_telemetry_;
+
+    /**
+     * \brief Write the current planning telemetry records to the provided file if telemetry is enabled.
+     *        Failures are logged rather than thrown.
+     */
+    void write_planning_telemetry(const std::string& path);
+
+  protected:
+    /**
+     * \brief Returns the world model only if it has already been initialized by get_world_model() or get_world_model_listener().
+     *        Unlike those methods this will not create the world model subscriptions.
+     * 
+     * \return Pointer to the world model or nullptr if it has not been initialized
+     */ 
+    carma_wm::WorldModelConstPtr get_world_model_if_initialized() const;
+
+    /**
+     * \brief Returns the configured number of planning calls to keep for offline replay. 0 if capture is disabled.
+     */ 
+    size_t get_planning_call_history_size() const;
+
+    /**
+     * \brief Returns the planning telemetry buffer of this plugin. Planning code may add cost terms and decision branches to it
+     *        without checking whether telemetry is enabled, as records are dropped at negligible cost when it is not.
+     */
+    PlanningTelemetry& get_planning_telemetry();
+
+    /**
+     * \brief Invokes the provided planning callback while recording the request, world model state, and call duration.
+     *        If the call exceeds the slow_planning_call_threshold parameter the recorded history is dumped to disk
+     *        for use with replay_main(), at most once per slow_planning_call_dump_interval. The map is serialized and the files are written
+     *        on a separate thread. Capture is skipped entirely if planning_call_history_size is 0.
+     * 
+     * \param recorder The history to add the call to
+     * \param service_name Name of the planning service. Used to name the dump directory.
+     * \param req The request the callback is invoked with
+     * \param callback The plugin callback to invoke
+     */ 
+    template <class ServiceT, class Callback>
+    void invoke_recorded_planning_call(PlanningCallRecorder<ServiceT>& recorder, const std::string& service_name,
+                                       const typename ServiceT::Request::SharedPtr& req, Callback&& callback)
+    {
+      planning_telemetry_.begin_plan();
+
+      if (planning_call_history_size_ <= 0)
+      {
+        callback();
+        return;
+      }
+
+      PlanningCallRecord<ServiceT> record;
+      record.stamp_ns = this->now().nanoseconds();
+      record.request = *req;
+      record.world_model = capture_world_model_snapshot(get_world_model_if_initialized());
+
+      auto start = std::chrono::steady_clock::now();
+      callback();
+      record.duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      const double duration = record.duration;
+      const size_t map_version = record.world_model.map_version;
+      bool is_slow = slow_planning_call_threshold_ > 0.0 && duration > slow_planning_call_threshold_;
+      std::string dump_dir = slow_planning_call_dump_dir_ + "/" + get_plugin_name() + "_" + service_name + "_" + std::to_string(record.stamp_ns);
+
+      recorder.record(std::move(record));
+
+      if (!is_slow)
+      {
+        return;
+      }
+
+      const auto now = std::chrono::steady_clock::now();
+      const bool dump_in_progress = slow_planning_call_dump_.valid() &&
+                                    slow_planning_call_dump_.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+      const bool dumped_recently = last_slow_planning_call_dump_ &&
+                                   std::chrono::duration<double>(now - *last_slow_planning_call_dump_).count() < slow_planning_call_dump_interval_;
+
+      if (dump_in_progress || dumped_recently)
+      {
+        RCLCPP_WARN_STREAM(get_logger(), "Slow " << service_name << " call of " << duration
+                                           << " s. Not dumped as a dump was started less than " << slow_planning_call_dump_interval_ << " s ago");
+        return;
+      }
+
+      last_slow_planning_call_dump_ = now;
+
+      // Only the map pointer is taken here so the planning thread does not pay for serializing the map.
+      // Everything else is copied so the files can be written without delaying the planning thread further.
+      auto wm = get_world_model_if_initialized();
+      lanelet::LaneletMapConstPtr map = wm ? wm->getMap() : nullptr;
+      auto wm_listener = wm_listener_;
+      auto telemetry = planning_telemetry_.snapshot();
+
+      slow_planning_call_dump_ = std::async(std::launch::async,
+        [this, recorder, dump_dir, service_name, duration, map, map_version, wm_listener, telemetry = std::move(telemetry)]()
+        {
+          try
+          {
+            autoware_lanelet2_msgs::msg::MapBin map_msg;
+            {
+              // Map updates modify the map in place so they are held off while it is serialized
+              std::unique_lock<std::mutex> lock;
+              if (wm_listener)
+              {
+                lock = wm_listener->getLock();
+              }
+              map_msg = to_map_bin_msg(map, map_version);
+            }
+
+            std::filesystem::create_directories(dump_dir);
+            recorder.write_dump(dump_dir, map_msg);
+
+            if (!telemetry.empty())
+            {
+              write_telemetry_file(dump_dir + "/telemetry.bin", telemetry);
+            }
+
+            RCLCPP_WARN_STREAM(get_logger(), "Slow " << service_name << " call of " << duration
+                                               << " s. Recorded calls written to " << dump_dir);
+          }
+          catch (const std::exception& e)
+          {
+            RCLCPP_ERROR_STREAM(get_logger(), "Failed to write planning call dump to " << dump_dir << ": " << e.what());
+          }
+        });
+    }
+
   public:
     /**
      * \brief PluginBaseNode constructor 
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <rclcpp/rclcpp.hpp>
+
+namespace carma_guidance_plugins
+{
+
+  /**
+   * \brief Opt-in real-time execution settings for nodes on the control path.
+   *        Loaded from the realtime_profile.* parameters of the node.
+   */
+  struct RealTimeProfileConfig
+  {
+    //! If false the node is spun with the default multi-threaded executor and all other settings are ignored
+    bool enabled = false;
+
+    //! Scheduling policy of the executor thread. One of "fifo", "rr", or "other"
+    std::string scheduling_policy = "fifo";
+
+    //! Scheduling priority of the executor thread. Ignored for the "other" policy
+    int64_t priority = 80;
+
+    //! CPUs the executor thread is pinned to. Empty to allow any CPU
+    std::vector<int64_t> cpu_affinity;
+
+    //! If true all current and future process memory is locked into RAM
+    bool lock_memory = true;
+
+    //! Bytes of heap to fault in and retain after locking so steady state allocations do not page fault
+    int64_t prefault_heap_bytes = 32 * 1024 * 1024;
+  };
+
+  /**
+   * \brief Declare the realtime_profile.* parameters on the provided node
+   *
+   * \param parameters The parameter interface of the node
+   *
+   * \return The declared values
+   */
+  RealTimeProfileConfig declare_realtime_profile_parameters(const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr& parameters);
+
+  /**
+   * \brief Read the realtime_profile.* parameters previously declared with declare_realtime_profile_parameters()
+   *
+   * \param parameters The parameter interface of the node
+   *
+   * \return The current values
+   */
+  RealTimeProfileConfig get_realtime_profile_parameters(const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr& parameters);
+
+  /**
+   * \brief Lock the process memory into RAM and pre-fault the heap and stack of the calling thread.
+   *        Heap trimming and mmap based allocation are disabled so the pre-faulted heap is reused by later allocations.
+   *
+   * \param config The profile to apply. Does nothing if lock_memory is false.
+   *
+   * \throw std::runtime_error if the memory could not be locked. Usually caused by a low RLIMIT_MEMLOCK.
+   */
+  void lock_process_memory(const RealTimeProfileConfig& config);
+
+  /**
+   * \brief Apply the scheduling policy and priority of the profile to the calling thread
+   *
+   * \param config The profile to apply
+   *
+   * \throw std::invalid_argument if the scheduling policy is not recognized
+   * \throw std::runtime_error if the settings could not be applied. Usually caused by missing CAP_SYS_NICE.
+   */
+  void apply_thread_scheduling(const RealTimeProfileConfig& config);
+
+  /**
+   * \brief Pin the calling thread to the CPUs of the profile. Does nothing if cpu_affinity is empty.
+   *
+   * \param config The profile to apply
+   *
+   * \throw std::invalid_argument if a CPU index is negative or too large
+   * \throw std::runtime_error if the affinity could not be applied. Usually caused by an unavailable CPU.
+   */
+  void apply_thread_affinity(const RealTimeProfileConfig& config);
+
+  /**
+   * \brief Apply the scheduling policy, priority, and CPU affinity of the profile to the calling thread
+   *
+   * \param config The profile to apply
+   *
+   * \throw std::invalid_argument if the scheduling policy or a CPU index is not valid
+   * \throw std::runtime_error if the settings could not be applied. Usually caused by missing CAP_SYS_NICE or an unavailable CPU.
+   */
+  void apply_thread_profile(const RealTimeProfileConfig& config);
+
+  /**
+   * \brief Spin the provided node until shutdown.
+   *        If the profile is disabled the node is spun with a multi-threaded executor.
+   *        Otherwise the memory and thread settings are applied to the calling thread, which then spins
+   *        a single-threaded executor. Settings which are invalid or cannot be applied are logged and skipped.
+   *
+   * NOTE: The profile only takes effect when the node is run from its own executable. Nodes loaded into a component container
+   *       share the container's executor.
+   *
+   * \param node The node to spin
+   * \param config The profile to apply
+   * \param logger Logger used to report settings which could not be applied
+   */
+  void spin_with_realtime_profile(const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr& node,
+                                  const RealTimeProfileConfig& config, const rclcpp::Logger& logger);
+
+} // carma_guidance_plugins
@@ -38,6 +38,9 @@ namespace carma_guidance_plugins
     //! The service which will be called when a strategic plugin needs to plan maneuvers
     carma_ros2_utils::ServicePtr<carma_planning_msgs::srv::PlanManeuvers> plan_maneuvers_service_;
 
+    //! Recent plan_maneuvers calls kept for offline replay
+    PlanningCallRecorder<carma_planning_msgs::srv::PlanManeuvers> plan_maneuvers_recorder_;
+
   public:
     /**
      * \brief StrategicPlugin constructor 
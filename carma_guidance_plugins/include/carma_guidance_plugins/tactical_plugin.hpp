@@ -38,6 +38,9 @@ namespace carma_guidance_plugins
     //! The ros service which can be called by the arbitrator or other plugins to have this plugin generate a trajectory plan 
     carma_ros2_utils::ServicePtr<carma_planning_msgs::srv::PlanTrajectory> plan_trajectory_service_;
 
+    //! Recent plan_trajectory calls kept for offline replay
+    PlanningCallRecorder<carma_planning_msgs::srv::PlanTrajectory> plan_trajectory_recorder_;
+
   public:
     /**
      * \brief TacticalPlugin constructor 
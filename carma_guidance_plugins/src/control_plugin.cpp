@@ -16,6 +16,7 @@
 
 #include <functional>
 #include "carma_guidance_plugins/control_plugin.hpp"
+#include "carma_guidance_plugins/realtime_profile.hpp"
 
 
 namespace carma_guidance_plugins
@@ -24,7 +25,10 @@ namespace carma_guidance_plugins
 
   ControlPlugin::ControlPlugin(const rclcpp::NodeOptions &options)
       : PluginBaseNode(options)
-  {}
+  {
+    // Used by spin_with_realtime_profile() when the plugin is run from its own executable
+    declare_realtime_profile_parameters(get_node_parameters_interface());
+  }
 
   std::string ControlPlugin::get_capability()
   {
@@ -51,7 +55,7 @@ namespace carma_guidance_plugins
   void ControlPlugin::current_trajectory_callback(carma_planning_msgs::msg::TrajectoryPlan::UniquePtr msg)
   {
     RCLCPP_DEBUG(rclcpp::get_logger("carma_guidance_plugins"), "Received trajectory message");
-    current_trajectory_ = *msg;
+    current_trajectory_ = std::move(*msg); // Avoid a deep copy of the trajectory points on the control path
   }
 
   carma_ros2_utils::CallbackReturn ControlPlugin::handle_on_configure(const rclcpp_lifecycle::State &prev_state)
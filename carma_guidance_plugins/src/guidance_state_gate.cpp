@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <algorithm>
+#include "carma_guidance_plugins/guidance_state_gate.hpp"
+
+namespace carma_guidance_plugins
+{
+
+  GuidanceStateGate::GuidanceStateGate(std::vector<uint8_t> running_states)
+    : running_states_(std::move(running_states))
+  {}
+
+  rclcpp::QoS GuidanceStateGate::qos()
+  {
+    return rclcpp::QoS(1).reliable().transient_local();
+  }
+
+  void GuidanceStateGate::add_timer(const rclcpp::TimerBase::SharedPtr& timer)
+  {
+    if (!timer)
+      return;
+
+    if (!is_open())
+      timer->cancel();
+
+    timers_.push_back(timer);
+  }
+
+  void GuidanceStateGate::clear_timers()
+  {
+    timers_.clear();
+  }
+
+  void GuidanceStateGate::set_transition_callback(TransitionCallback callback)
+  {
+    transition_callback_ = callback;
+  }
+
+  bool GuidanceStateGate::on_guidance_state(const carma_planning_msgs::msg::GuidanceState& msg, const rclcpp::Time& receive_time)
+  {
+    if (state_ && state_.get() == msg.state)
+      return false;
+
+    bool was_open = is_open();
+    boost::optional<uint8_t> previous_state = state_;
+
+    state_ = msg.state;
+    last_transition_time_ = receive_time;
+
+    bool now_open = is_open();
+
+    if (was_open && !now_open)
+    {
+      RCLCPP_DEBUG_STREAM(rclcpp::get_logger("carma_guidance_plugins"), "Suspending " << timers_.size() << " timers for guidance state " << static_cast<int>(msg.state));
+
+      for (auto& timer : timers_)
+        timer->cancel();
+    }
+    else if (!was_open && now_open)
+    {
+      RCLCPP_DEBUG_STREAM(rclcpp::get_logger("carma_guidance_plugins"), "Resuming " << timers_.size() << " timers for guidance state " << static_cast<int>(msg.state));
+
+      // Reset restarts the period so the first tick is one period after the transition
+      for (auto& timer : timers_)
+        timer->reset();
+    }
+
+    if (transition_callback_)
+      transition_callback_(previous_state, msg.state);
+
+    return true;
+  }
+
+  bool GuidanceStateGate::is_open() const
+  {
+    return !state_ || is_running_state(state_.get());
+  }
+
+  boost::optional<uint8_t> GuidanceStateGate::get_state() const
+  {
+    return state_;
+  }
+
+  boost::optional<rclcpp::Time> GuidanceStateGate::get_last_transition_time() const
+  {
+    return last_transition_time_;
+  }
+
+  bool GuidanceStateGate::is_running_state(uint8_t state) const
+  {
+    return std::find(running_states_.begin(), running_states_.end(), state) != running_states_.end();
+  }
+
+} // carma_guidance_plugins
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <autoware_lanelet2_ros2_interface/utility/message_conversion.hpp>
+#include <lanelet2_core/utility/Utilities.h>
+#include "carma_guidance_plugins/planning_call_recorder.hpp"
+
+namespace carma_guidance_plugins
+{
+
+  WorldModelSnapshot capture_world_model_snapshot(const carma_wm::WorldModelConstPtr& wm)
+  {
+    WorldModelSnapshot snapshot;
+
+    if (!wm)
+    {
+      return snapshot;
+    }
+
+    snapshot.map_version = wm->getMapVersion();
+    snapshot.roadway_objects.roadway_obstacles = wm->getRoadwayObjects();
+
+    auto route = wm->getRoute();
+    if (route)
+    {
+      snapshot.route.route_name = wm->getRouteName();
+      snapshot.route.map_version = snapshot.map_version;
+      for (const auto& llt : route->shortestPath())
+      {
+        snapshot.route.shortest_path_lanelet_ids.push_back(llt.id());
+      }
+    }
+
+    return snapshot;
+  }
+
+  autoware_lanelet2_msgs::msg::MapBin to_map_bin_msg(const carma_wm::WorldModelConstPtr& wm)
+  {
+    if (!wm)
+    {
+      return autoware_lanelet2_msgs::msg::MapBin();
+    }
+
+    return to_map_bin_msg(wm->getMap(), wm->getMapVersion());
+  }
+
+  autoware_lanelet2_msgs::msg::MapBin to_map_bin_msg(const lanelet::LaneletMapConstPtr& map, size_t map_version)
+  {
+    autoware_lanelet2_msgs::msg::MapBin map_msg;
+
+    if (!map)
+    {
+      return map_msg;
+    }
+
+    lanelet::utils::conversion::toBinMsg(lanelet::utils::removeConst(map), &map_msg);
+    map_msg.map_version = map_version;
+
+    return map_msg;
+  }
+
+  void restore_map(const autoware_lanelet2_msgs::msg::MapBin& map_msg, const std::shared_ptr<carma_wm::CARMAWorldModel>& wm)
+  {
+    auto map = std::make_shared<lanelet::LaneletMap>();
+    lanelet::utils::conversion::fromBinMsg(map_msg, map);
+
+    wm->setMap(map, map_msg.map_version);
+  }
+
+  void restore_world_model_snapshot(const WorldModelSnapshot& snapshot, const std::shared_ptr<carma_wm::CARMAWorldModel>& wm)
+  {
+    wm->setRoadwayObjects(snapshot.roadway_objects.roadway_obstacles);
+
+    const auto& ids = snapshot.route.shortest_path_lanelet_ids;
+    if (ids.empty())
+    {
+      return;
+    }
+
+    // Rebuild the route the same way carma_wm does when receiving a route message
+    lanelet::ConstLanelets path;
+    for (auto id : ids)
+    {
+      if (!wm->getMap()->laneletLayer.exists(id))
+      {
+        throw std::invalid_argument("Snapshot route lanelet " + std::to_string(id) + " is not in the loaded map");
+      }
+      path.push_back(wm->getMap()->laneletLayer.get(id));
+    }
+
+    auto route_opt = path.size() == 1 ? wm->getMapRoutingGraph()->getRoute(path.front(), path.back())
+                                      : wm->getMapRoutingGraph()->getRouteVia(path.front(), lanelet::ConstLanelets(path.begin() + 1, path.end() - 1), path.back());
+
+    if (!route_opt)
+    {
+      throw std::invalid_argument("Snapshot route could not be rebuilt on the loaded map");
+    }
+
+    wm->setRoute(std::make_shared<lanelet::routing::Route>(std::move(route_opt.get())));
+    wm->setRouteName(snapshot.route.route_name);
+  }
+
+} // carma_guidance_plugins
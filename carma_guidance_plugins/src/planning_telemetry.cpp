@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <rclcpp/time.hpp>
+#include "carma_guidance_plugins/planning_telemetry.hpp"
+
+namespace carma_guidance_plugins
+{
+  namespace
+  {
+    constexpr char TELEMETRY_FILE_MAGIC[8] = { 'C', 'A', 'R', 'M', 'A', 'T', 'L', 'M' };
+
+    constexpr size_t MAX_RECORD_VALUES = sizeof(TelemetryRecord::values) / sizeof(double);
+
+    /**
+     * \brief Planning call in progress on a thread. Records are only tagged with the plan id by the telemetry
+     *        buffer which started the call.
+     */
+    struct ThreadPlan
+    {
+      const PlanningTelemetry* telemetry = nullptr;
+      uint64_t plan_id = 0;
+    };
+
+    thread_local ThreadPlan current_plan;
+
+    /**
+     * \brief Invoke the provided function on the type specific maneuver held by the maneuver message
+     *
+     * \return False if the maneuver type is not recognized, in which case the function is not invoked
+     */
+    template <class Function>
+    bool visit_maneuver(const carma_planning_msgs::msg::Maneuver& maneuver, Function&& function)
+    {
+      using carma_planning_msgs::msg::Maneuver;
+
+      switch (maneuver.type)
+      {
+        case Maneuver::LANE_FOLLOWING:
+          function(maneuver.lane_following_maneuver);
+          return true;
+        case Maneuver::LANE_CHANGE:
+          function(maneuver.lane_change_maneuver);
+          return true;
+        case Maneuver::INTERSECTION_TRANSIT_STRAIGHT:
+          function(maneuver.intersection_transit_straight_maneuver);
+          return true;
+        case Maneuver::INTERSECTION_TRANSIT_LEFT_TURN:
+          function(maneuver.intersection_transit_left_turn_maneuver);
+          return true;
+        case Maneuver::INTERSECTION_TRANSIT_RIGHT_TURN:
+          function(maneuver.intersection_transit_right_turn_maneuver);
+          return true;
+        case Maneuver::STOP_AND_WAIT:
+          function(maneuver.stop_and_wait_maneuver);
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    template <class Stream, class T>
+    void write_value(Stream& stream, const T& value)
+    {
+      stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <class Stream, class T>
+    void read_value(Stream& stream, T& value)
+    {
+      stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+  }
+
+  PlanningTelemetry::PlanningTelemetry(size_t capacity)
+  {
+    set_capacity(capacity);
+  }
+
+  void PlanningTelemetry::set_capacity(size_t capacity)
+  {
+    capacity_ = capacity;
+    slots_ = capacity > 0 ? std::make_unique<Slot[]>(capacity) : nullptr;
+    write_count_.store(0, std::memory_order_relaxed);
+  }
+
+  size_t PlanningTelemetry::get_capacity() const
+  {
+    return capacity_;
+  }
+
+  uint64_t PlanningTelemetry::begin_plan()
+  {
+    current_plan.telemetry = this;
+    current_plan.plan_id = plan_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+    return current_plan.plan_id;
+  }
+
+  uint64_t PlanningTelemetry::get_plan_id() const
+  {
+    return current_plan.telemetry == this ? current_plan.plan_id : 0;
+  }
+
+  void PlanningTelemetry::record(TelemetryRecordType type, std::string_view label, std::initializer_list<double> values)
+  {
+    if (!enabled())
+    {
+      return;
+    }
+
+    TelemetryRecord record;
+    record.type = static_cast<uint8_t>(type);
+
+    const size_t label_length = std::min(label.size(), sizeof(record.label) - 1);
+    std::memcpy(record.label, label.data(), label_length);
+
+    std::copy_n(values.begin(), std::min(values.size(), MAX_RECORD_VALUES), record.values);
+
+    write(record);
+  }
+
+  void PlanningTelemetry::record_maneuver_plan(const carma_planning_msgs::msg::ManeuverPlan& plan)
+  {
+    if (!enabled())
+    {
+      return;
+    }
+
+    for (const auto& maneuver : plan.maneuvers)
+    {
+      visit_maneuver(maneuver, [&](const auto& m) {
+        const double duration = rclcpp::Time(m.end_time).seconds() - rclcpp::Time(m.start_time).seconds();
+
+        record(TelemetryRecordType::MANEUVER_PLAN, m.parameters.planning_tactical_plugin,
+               { static_cast<double>(maneuver.type), m.start_dist, m.end_dist, m.start_speed, m.end_speed, duration });
+      });
+    }
+  }
+
+  void PlanningTelemetry::record_trajectory_summary(const carma_planning_msgs::msg::TrajectoryPlan& trajectory)
+  {
+    if (!enabled())
+    {
+      return;
+    }
+
+    const auto& points = trajectory.trajectory_points;
+
+    double length = 0.0;
+    double start_speed = 0.0;
+    double end_speed = 0.0;
+    double max_speed = 0.0;
+
+    for (size_t i = 1; i < points.size(); ++i)
+    {
+      const double distance = std::hypot(points[i].x - points[i - 1].x, points[i].y - points[i - 1].y);
+      const double dt = rclcpp::Time(points[i].target_time).seconds() - rclcpp::Time(points[i - 1].target_time).seconds();
+      const double speed = dt > 0.0 ? distance / dt : 0.0;
+
+      length += distance;
+      start_speed = i == 1 ? speed : start_speed;
+      end_speed = speed;
+      max_speed = std::max(max_speed, speed);
+    }
+
+    const double duration = points.empty() ? 0.0
+                                           : rclcpp::Time(points.back().target_time).seconds() -
+                                                 rclcpp::Time(points.front().target_time).seconds();
+
+    const std::string& planner = points.empty() ? trajectory.trajectory_id : points.front().planner_plugin_name;
+
+    record(TelemetryRecordType::TRAJECTORY_SUMMARY, planner,
+           { static_cast<double>(points.size()), duration, length, start_speed, end_speed, max_speed });
+  }
+
+  void PlanningTelemetry::record_cost_term(std::string_view name, double value, double weight, size_t candidate)
+  {
+    record(TelemetryRecordType::COST_TERM, name, { value, weight, value * weight, static_cast<double>(candidate) });
+  }
+
+  void PlanningTelemetry::record_decision_branch(std::string_view decision, int branch, std::initializer_list<double> inputs)
+  {
+    if (!enabled())
+    {
+      return;
+    }
+
+    TelemetryRecord record;
+    record.type = static_cast<uint8_t>(TelemetryRecordType::DECISION_BRANCH);
+
+    const size_t label_length = std::min(decision.size(), sizeof(record.label) - 1);
+    std::memcpy(record.label, decision.data(), label_length);
+
+    record.values[0] = branch;
+    std::copy_n(inputs.begin(), std::min(inputs.size(), MAX_RECORD_VALUES - 1), record.values + 1);
+
+    write(record);
+  }
+
+  uint64_t PlanningTelemetry::get_record_count() const
+  {
+    return write_count_.load(std::memory_order_relaxed);
+  }
+
+  void PlanningTelemetry::write(TelemetryRecord& record)
+  {
+    record.stamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::system_clock::now().time_since_epoch()).count();
+    record.plan_id = get_plan_id();
+
+    const uint64_t sequence = write_count_.fetch_add(1, std::memory_order_relaxed);
+    record.sequence = sequence;
+
+    // Claim the slot. Only one writer may hold a slot at a time, so a writer a full lap ahead or behind drops its record
+    // rather than interleave with the other. Older records never replace newer ones.
+    Slot& slot = slots_[sequence % capacity_];
+    uint64_t state = slot.state.load(std::memory_order_relaxed);
+    do
+    {
+      if (state % 2 == 1 || state > 2 * sequence)
+      {
+        return;
+      }
+    } while (!slot.state.compare_exchange_weak(state, 2 * sequence + 1, std::memory_order_relaxed));
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint64_t words[RECORD_WORDS];
+    std::memcpy(words, &record, sizeof(TelemetryRecord));
+    for (size_t i = 0; i < RECORD_WORDS; ++i)
+    {
+      slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    slot.state.store(2 * sequence + 2, std::memory_order_release);
+  }
+
+  std::vector<TelemetryRecord> PlanningTelemetry::snapshot() const
+  {
+    std::vector<TelemetryRecord> records;
+
+    if (!enabled())
+    {
+      return records;
+    }
+
+    const uint64_t count = write_count_.load(std::memory_order_acquire);
+    const uint64_t first = count > capacity_ ? count - capacity_ : 0;
+
+    records.reserve(count - first);
+
+    for (uint64_t sequence = first; sequence < count; ++sequence)
+    {
+      const Slot& slot = slots_[sequence % capacity_];
+      const uint64_t written = 2 * sequence + 2;
+
+      if (slot.state.load(std::memory_order_acquire) != written)
+      {
+        continue; // Still being written or already overwritten
+      }
+
+      uint64_t words[RECORD_WORDS];
+      for (size_t i = 0; i < RECORD_WORDS; ++i)
+      {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if (slot.state.load(std::memory_order_relaxed) != written)
+      {
+        continue; // Overwritten while being copied
+      }
+
+      TelemetryRecord record;
+      std::memcpy(&record, words, sizeof(TelemetryRecord));
+
+      records.push_back(record);
+    }
+
+    return records;
+  }
+
+  void write_telemetry_file(const std::string& path, const std::vector<TelemetryRecord>& records)
+  {
+    std::ofstream file(path, std::ios::binary);
+
+    file.write(TELEMETRY_FILE_MAGIC, sizeof(TELEMETRY_FILE_MAGIC));
+    write_value(file, TELEMETRY_FILE_VERSION);
+    write_value(file, static_cast<uint32_t>(sizeof(TelemetryRecord)));
+    write_value(file, static_cast<uint64_t>(records.size()));
+    file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(TelemetryRecord));
+
+    if (!file)
+    {
+      throw std::runtime_error("Failed to write planning telemetry to " + path);
+    }
+  }
+
+  std::vector<TelemetryRecord> read_telemetry_file(const std::string& path)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+      throw std::runtime_error("Failed to open planning telemetry file " + path);
+    }
+
+    char magic[sizeof(TELEMETRY_FILE_MAGIC)] = {};
+    uint32_t version = 0;
+    uint32_t record_size = 0;
+    uint64_t count = 0;
+
+    file.read(magic, sizeof(magic));
+    read_value(file, version);
+    read_value(file, record_size);
+    read_value(file, count);
+
+    if (!file || std::memcmp(magic, TELEMETRY_FILE_MAGIC, sizeof(magic)) != 0)
+    {
+      throw std::runtime_error("Not a planning telemetry file: " + path);
+    }
+
+    if (version != TELEMETRY_FILE_VERSION || record_size != sizeof(TelemetryRecord))
+    {
+      throw std::runtime_error("Unsupported planning telemetry file version " + std::to_string(version) + " in " + path);
+    }
+
+    std::vector<TelemetryRecord> records(count);
+    file.read(reinterpret_cast<char*>(records.data()), count * sizeof(TelemetryRecord));
+
+    if (!file)
+    {
+      throw std::runtime_error("Truncated planning telemetry file " + path);
+    }
+
+    return records;
+  }
+
+} // carma_guidance_plugins
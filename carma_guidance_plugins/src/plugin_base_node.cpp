@@ -31,6 +31,13 @@ namespace carma_guidance_plugins
         get_clock(),
         std::chrono::milliseconds(500), // 2 Hz frequency to account for 1Hz maneuver planning frequency
         std::bind(&PluginBaseNode::discovery_timer_callback, this));
+
+    // Planning call capture parameters are shared by all plugins
+    planning_call_history_size_ = declare_parameter<int>("planning_call_history_size", planning_call_history_size_);
+    slow_planning_call_threshold_ = declare_parameter<double>("slow_planning_call_threshold", slow_planning_call_threshold_);
+    slow_planning_call_dump_interval_ = declare_parameter<double>("slow_planning_call_dump_interval", slow_planning_call_dump_interval_);
+    slow_planning_call_dump_dir_ = declare_parameter<std::string>("slow_planning_call_dump_dir", slow_planning_call_dump_dir_);
+    planning_telemetry_capacity_ = declare_parameter<int>("planning_telemetry_capacity", planning_telemetry_capacity_);
   }
 
   void PluginBaseNode::lazy_wm_initialization()
@@ -69,6 +76,39 @@ namespace carma_guidance_plugins
     return wm_;
   }
 
+  carma_wm::WorldModelConstPtr PluginBaseNode::get_world_model_if_initialized() const
+  {
+    return wm_;
+  }
+
+  size_t PluginBaseNode::get_planning_call_history_size() const
+  {
+    return planning_call_history_size_ > 0 ? static_cast<size_t>(planning_call_history_size_) : 0;
+  }
+
+  PlanningTelemetry& PluginBaseNode::get_planning_telemetry()
+  {
+    return planning_telemetry_;
+  }
+
+  void PluginBaseNode::write_planning_telemetry(const std::string& path)
+  {
+    if (!planning_telemetry_.enabled())
+    {
+      return;
+    }
+
+    try
+    {
+      std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+      write_telemetry_file(path, planning_telemetry_.snapshot());
+    }
+    catch (const std::exception& e)
+    {
+      RCLCPP_ERROR_STREAM(get_logger(), "Failed to write planning telemetry to " << path << ": " << e.what());
+    }
+  }
+
   bool PluginBaseNode::get_activation_status() {
     // Determine the plugin activation state by checking which lifecycle state we are in. 
     // If we are active then the plugin is active otherwise the plugin is inactive
@@ -103,6 +143,14 @@ namespace carma_guidance_plugins
 
   carma_ros2_utils::CallbackReturn PluginBaseNode::handle_on_configure(const rclcpp_lifecycle::State &)
   {
+    get_parameter<int>("planning_call_history_size", planning_call_history_size_);
+    get_parameter<double>("slow_planning_call_threshold", slow_planning_call_threshold_);
+    get_parameter<double>("slow_planning_call_dump_interval", slow_planning_call_dump_interval_);
+    get_parameter<std::string>("slow_planning_call_dump_dir", slow_planning_call_dump_dir_);
+    get_parameter<int>("planning_telemetry_capacity", planning_telemetry_capacity_);
+
+    planning_telemetry_.set_capacity(planning_telemetry_capacity_ > 0 ? static_cast<size_t>(planning_telemetry_capacity_) : 0);
+
     return on_configure_plugin();
   }
   
@@ -123,6 +171,9 @@ namespace carma_guidance_plugins
   
   carma_ros2_utils::CallbackReturn PluginBaseNode::handle_on_shutdown(const rclcpp_lifecycle::State &)
   {
+    write_planning_telemetry(slow_planning_call_dump_dir_ + "/" + get_plugin_name() + "_telemetry_" +
+                             std::to_string(this->now().nanoseconds()) + ".bin");
+
     return on_shutdown_plugin();
   }
   
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "carma_guidance_plugins/realtime_profile.hpp"
+
+namespace carma_guidance_plugins
+{
+  namespace
+  {
+    //! Bytes of the calling thread's stack touched when locking memory. Well below the default 8 MB thread stack.
+    constexpr size_t STACK_PREFAULT_BYTES = 256 * 1024;
+
+    const std::string PREFIX = "realtime_profile.";
+
+    std::string errno_string(int error)
+    {
+      return std::string(std::strerror(error));
+    }
+
+    void prefault_stack()
+    {
+      volatile unsigned char stack[STACK_PREFAULT_BYTES];
+      for (size_t i = 0; i < STACK_PREFAULT_BYTES; i += 4096)
+      {
+        stack[i] = 0;
+      }
+    }
+
+    int to_sched_policy(const std::string& policy)
+    {
+      if (policy == "fifo")
+        return SCHED_FIFO;
+      if (policy == "rr")
+        return SCHED_RR;
+      if (policy == "other")
+        return SCHED_OTHER;
+
+      throw std::invalid_argument("Unknown realtime_profile.scheduling_policy: " + policy + ". Expected fifo, rr, or other");
+    }
+  }
+
+  RealTimeProfileConfig declare_realtime_profile_parameters(const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr& parameters)
+  {
+    RealTimeProfileConfig config;
+
+    config.enabled = parameters->declare_parameter(PREFIX + "enabled", rclcpp::ParameterValue(config.enabled)).get<bool>();
+    config.scheduling_policy = parameters->declare_parameter(PREFIX + "scheduling_policy", rclcpp::ParameterValue(config.scheduling_policy)).get<std::string>();
+    config.priority = parameters->declare_parameter(PREFIX + "priority", rclcpp::ParameterValue(config.priority)).get<int64_t>();
+    config.cpu_affinity = parameters->declare_parameter(PREFIX + "cpu_affinity", rclcpp::ParameterValue(config.cpu_affinity)).get<std::vector<int64_t>>();
+    config.lock_memory = parameters->declare_parameter(PREFIX + "lock_memory", rclcpp::ParameterValue(config.lock_memory)).get<bool>();
+    config.prefault_heap_bytes = parameters->declare_parameter(PREFIX + "prefault_heap_bytes", rclcpp::ParameterValue(config.prefault_heap_bytes)).get<int64_t>();
+
+    return config;
+  }
+
+  RealTimeProfileConfig get_realtime_profile_parameters(const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr& parameters)
+  {
+    RealTimeProfileConfig config;
+
+    config.enabled = parameters->get_parameter(PREFIX + "enabled").as_bool();
+    config.scheduling_policy = parameters->get_parameter(PREFIX + "scheduling_policy").as_string();
+    config.priority = parameters->get_parameter(PREFIX + "priority").as_int();
+    config.cpu_affinity = parameters->get_parameter(PREFIX + "cpu_affinity").as_integer_array();
+    config.lock_memory = parameters->get_parameter(PREFIX + "lock_memory").as_bool();
+    config.prefault_heap_bytes = parameters->get_parameter(PREFIX + "prefault_heap_bytes").as_int();
+
+    return config;
+  }
+
+  void lock_process_memory(const RealTimeProfileConfig& config)
+  {
+    if (!config.lock_memory)
+      return;
+
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+      throw std::runtime_error("Failed to lock process memory: " + errno_string(errno));
+    }
+
+    // Keep freed memory in the heap and never satisfy allocations with mmap so the pre-faulted pages are reused
+    mallopt(M_TRIM_THRESHOLD, -1);
+    mallopt(M_MMAP_MAX, 0);
+
+    if (config.prefault_heap_bytes > 0)
+    {
+      const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      const size_t heap_bytes = static_cast<size_t>(config.prefault_heap_bytes);
+
+      auto buffer = static_cast<volatile unsigned char*>(malloc(heap_bytes));
+      if (buffer)
+      {
+        for (size_t i = 0; i < heap_bytes; i += page_size)
+        {
+          buffer[i] = 0;
+        }
+        free(const_cast<unsigned char*>(buffer));
+      }
+    }
+
+    prefault_stack();
+  }
+
+  void apply_thread_scheduling(const RealTimeProfileConfig& config)
+  {
+    int policy = to_sched_policy(config.scheduling_policy);
+
+    sched_param param{};
+    param.sched_priority = policy == SCHED_OTHER ? 0 : static_cast<int>(config.priority);
+
+    int error = pthread_setschedparam(pthread_self(), policy, &param);
+    if (error != 0)
+    {
+      throw std::runtime_error("Failed to set " + config.scheduling_policy + " scheduling with priority " +
+                               std::to_string(param.sched_priority) + ": " + errno_string(error));
+    }
+  }
+
+  void apply_thread_affinity(const RealTimeProfileConfig& config)
+  {
+    if (config.cpu_affinity.empty())
+      return;
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (auto cpu : config.cpu_affinity)
+    {
+      if (cpu < 0 || cpu >= CPU_SETSIZE)
+      {
+        throw std::invalid_argument("Invalid CPU in realtime_profile.cpu_affinity: " + std::to_string(cpu));
+      }
+      CPU_SET(static_cast<int>(cpu), &cpus);
+    }
+
+    int error = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (error != 0)
+    {
+      throw std::runtime_error("Failed to set CPU affinity: " + errno_string(error));
+    }
+  }
+
+  void apply_thread_profile(const RealTimeProfileConfig& config)
+  {
+    apply_thread_scheduling(config);
+    apply_thread_affinity(config);
+  }
+
+  void spin_with_realtime_profile(const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr& node,
+                                  const RealTimeProfileConfig& config, const rclcpp::Logger& logger)
+  {
+    if (!config.enabled)
+    {
+      rclcpp::executors::MultiThreadedExecutor executor;
+      executor.add_node(node);
+      executor.spin();
+      return;
+    }
+
+    // Invalid settings are reported like settings which cannot be applied so a configuration error does not stop the node
+    try
+    {
+      lock_process_memory(config);
+    }
+    catch (const std::exception& e)
+    {
+      RCLCPP_WARN_STREAM(logger, "Real-time profile: " << e.what() << ". Continuing without locked memory.");
+    }
+
+    std::string applied_scheduling = config.scheduling_policy + " priority " + std::to_string(config.priority);
+    try
+    {
+      apply_thread_scheduling(config);
+    }
+    catch (const std::exception& e)
+    {
+      RCLCPP_WARN_STREAM(logger, "Real-time profile: " << e.what() << ". Continuing with default scheduling.");
+      applied_scheduling = "default";
+    }
+
+    size_t pinned_cpus = config.cpu_affinity.size();
+    try
+    {
+      apply_thread_affinity(config);
+    }
+    catch (const std::exception& e)
+    {
+      RCLCPP_WARN_STREAM(logger, "Real-time profile: " << e.what() << ". Continuing without CPU pinning.");
+      pinned_cpus = 0;
+    }
+
+    RCLCPP_INFO_STREAM(logger, "Spinning with real-time profile. scheduling: " << applied_scheduling
+                                   << " pinned cpus: " << pinned_cpus);
+
+    // A single thread keeps the callback order deterministic and is the only thread which receives the profile
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node);
+    executor.spin();
+  }
+
+} // carma_guidance_plugins
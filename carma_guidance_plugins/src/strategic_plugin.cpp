@@ -42,11 +42,18 @@ namespace carma_guidance_plugins
       [this] (auto header, auto req, auto resp) {
         if (this->get_activation_status()) // Only trigger when activated
         {
-          this->plan_maneuvers_callback(header, req, resp);
+          this->invoke_recorded_planning_call(plan_maneuvers_recorder_, "plan_maneuvers", req, [&]() {
+            this->plan_maneuvers_callback(header, req, resp);
+            this->get_planning_telemetry().record_maneuver_plan(resp->new_plan);
+          });
         }
       });
     
-    return PluginBaseNode::handle_on_configure(prev_state);
+    auto result = PluginBaseNode::handle_on_configure(prev_state);
+
+    plan_maneuvers_recorder_.set_capacity(get_planning_call_history_size());
+
+    return result;
   }
 
   carma_ros2_utils::CallbackReturn StrategicPlugin::handle_on_activate(const rclcpp_lifecycle::State &prev_state)
@@ -61,6 +68,8 @@ namespace carma_guidance_plugins
 
   carma_ros2_utils::CallbackReturn StrategicPlugin::handle_on_cleanup(const rclcpp_lifecycle::State &prev_state)
   {
+    plan_maneuvers_recorder_ = PlanningCallRecorder<carma_planning_msgs::srv::PlanManeuvers>(get_planning_call_history_size());
+
     return PluginBaseNode::handle_on_cleanup(prev_state);
   }
 
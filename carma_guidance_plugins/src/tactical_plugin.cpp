@@ -42,11 +42,18 @@ namespace carma_guidance_plugins
       [this] (auto header, auto req, auto resp) {
         if (this->get_activation_status()) // Only trigger when activated
         {
-          this->plan_trajectory_callback(header, req, resp);
+          this->invoke_recorded_planning_call(plan_trajectory_recorder_, "plan_trajectory", req, [&]() {
+            this->plan_trajectory_callback(header, req, resp);
+            this->get_planning_telemetry().record_trajectory_summary(resp->trajectory_plan);
+          });
         }
       });
           
-    return PluginBaseNode::handle_on_configure(prev_state);
+    auto result = PluginBaseNode::handle_on_configure(prev_state);
+
+    plan_trajectory_recorder_.set_capacity(get_planning_call_history_size());
+
+    return result;
   }
 
   carma_ros2_utils::CallbackReturn TacticalPlugin::handle_on_activate(const rclcpp_lifecycle::State &prev_state)
@@ -61,6 +68,8 @@ namespace carma_guidance_plugins
 
   carma_ros2_utils::CallbackReturn TacticalPlugin::handle_on_cleanup(const rclcpp_lifecycle::State &prev_state)
   {
+    plan_trajectory_recorder_ = PlanningCallRecorder<carma_planning_msgs::srv::PlanTrajectory>(get_planning_call_history_size());
+
     return PluginBaseNode::handle_on_cleanup(prev_state);
   }
 
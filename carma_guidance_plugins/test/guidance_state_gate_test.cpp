@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+
+#include "carma_guidance_plugins/guidance_state_gate.hpp"
+
+namespace carma_guidance_plugins
+{
+
+  carma_planning_msgs::msg::GuidanceState make_state(uint8_t state)
+  {
+    carma_planning_msgs::msg::GuidanceState msg;
+    msg.state = state;
+    return msg;
+  }
+
+  TEST(GuidanceStateGate, suspend_and_resume_timers)
+  {
+    auto node = std::make_shared<rclcpp::Node>("guidance_state_gate_test");
+    auto timer = node->create_wall_timer(std::chrono::milliseconds(100), [](){});
+
+    GuidanceStateGate gate({ carma_planning_msgs::msg::GuidanceState::ACTIVE, carma_planning_msgs::msg::GuidanceState::ENGAGED });
+
+    // Open until a state is received
+    ASSERT_TRUE(gate.is_open());
+    ASSERT_FALSE(!!gate.get_state());
+    gate.add_timer(timer);
+    ASSERT_FALSE(timer->is_canceled());
+
+    int transitions = 0;
+    boost::optional<uint8_t> last_previous;
+    gate.set_transition_callback([&](const boost::optional<uint8_t>& previous, uint8_t) { transitions++; last_previous = previous; });
+
+    ASSERT_TRUE(gate.on_guidance_state(make_state(carma_planning_msgs::msg::GuidanceState::DRIVERS_READY), rclcpp::Time(1, 0)));
+    ASSERT_FALSE(gate.is_open());
+    ASSERT_TRUE(timer->is_canceled());
+    ASSERT_EQ(transitions, 1);
+    ASSERT_FALSE(!!last_previous);
+
+    // Heartbeats of the same state are not transitions
+    ASSERT_FALSE(gate.on_guidance_state(make_state(carma_planning_msgs::msg::GuidanceState::DRIVERS_READY), rclcpp::Time(2, 0)));
+    ASSERT_EQ(gate.get_last_transition_time().get(), rclcpp::Time(1, 0));
+    ASSERT_EQ(transitions, 1);
+
+    ASSERT_TRUE(gate.on_guidance_state(make_state(carma_planning_msgs::msg::GuidanceState::ACTIVE), rclcpp::Time(3, 0)));
+    ASSERT_TRUE(gate.is_open());
+    ASSERT_FALSE(timer->is_canceled());
+    ASSERT_EQ(last_previous.get(), carma_planning_msgs::msg::GuidanceState::DRIVERS_READY);
+
+    ASSERT_TRUE(gate.on_guidance_state(make_state(carma_planning_msgs::msg::GuidanceState::ENGAGED), rclcpp::Time(4, 0)));
+    ASSERT_FALSE(timer->is_canceled());
+
+    ASSERT_TRUE(gate.on_guidance_state(make_state(carma_planning_msgs::msg::GuidanceState::ENTER_PARK), rclcpp::Time(5, 0)));
+    ASSERT_TRUE(timer->is_canceled());
+    ASSERT_EQ(gate.get_state().get(), carma_planning_msgs::msg::GuidanceState::ENTER_PARK);
+    ASSERT_EQ(transitions, 4);
+
+    // Timers added while closed start cancelled
+    auto late_timer = node->create_wall_timer(std::chrono::milliseconds(100), [](){});
+    gate.add_timer(late_timer);
+    ASSERT_TRUE(late_timer->is_canceled());
+
+    gate.clear_timers();
+    gate.on_guidance_state(make_state(carma_planning_msgs::msg::GuidanceState::ENGAGED), rclcpp::Time(6, 0));
+    ASSERT_TRUE(timer->is_canceled());
+    ASSERT_TRUE(late_timer->is_canceled());
+  }
+
+} // carma_guidance_plugins
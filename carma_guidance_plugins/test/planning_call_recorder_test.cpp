@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <carma_wm/WMTestLibForGuidance.hpp>
+
+#include "carma_guidance_plugins/planning_call_recorder.hpp"
+
+namespace carma_guidance_plugins
+{
+
+TEST(planning_call_recorder_test, capacity)
+{
+  PlanningCallRecorder<carma_planning_msgs::srv::PlanTrajectory> recorder(2);
+
+  for (int i = 0; i < 3; ++i)
+  {
+    PlanningCallRecord<carma_planning_msgs::srv::PlanTrajectory> record;
+    record.stamp_ns = i;
+    recorder.record(record);
+  }
+
+  // Oldest calls are discarded first
+  ASSERT_EQ(2u, recorder.get_records().size());
+  ASSERT_EQ(1, recorder.get_records().front().stamp_ns);
+  ASSERT_EQ(2, recorder.get_records().back().stamp_ns);
+
+  recorder.set_capacity(1);
+  ASSERT_EQ(1u, recorder.get_records().size());
+  ASSERT_EQ(2, recorder.get_records().front().stamp_ns);
+}
+
+TEST(planning_call_recorder_test, dump_round_trip)
+{
+  auto cmw = carma_wm::test::getGuidanceTestMap();
+  carma_wm::test::setRouteByIds({ 1200, 1201, 1202, 1203 }, cmw);
+  cmw->setRouteName("test_route");
+  carma_wm::test::addObstacle(1.85, 5.0, cmw);
+
+  PlanningCallRecorder<carma_planning_msgs::srv::PlanTrajectory> recorder;
+
+  PlanningCallRecord<carma_planning_msgs::srv::PlanTrajectory> record;
+  record.stamp_ns = 100;
+  record.duration = 0.25;
+  record.request.vehicle_state.longitudinal_vel = 5.0;
+  record.world_model = capture_world_model_snapshot(cmw);
+  recorder.record(record);
+
+  ASSERT_EQ(4u, record.world_model.route.shortest_path_lanelet_ids.size());
+  ASSERT_EQ(1u, record.world_model.roadway_objects.roadway_obstacles.size());
+
+  auto dump_dir = std::filesystem::temp_directory_path() / "planning_call_recorder_test";
+  std::filesystem::remove_all(dump_dir);
+  std::filesystem::create_directories(dump_dir);
+
+  recorder.write_dump(dump_dir.string(), to_map_bin_msg(cmw));
+
+  autoware_lanelet2_msgs::msg::MapBin map_msg;
+  auto records = PlanningCallRecorder<carma_planning_msgs::srv::PlanTrajectory>::read_dump(dump_dir.string(), map_msg);
+
+  ASSERT_EQ(1u, records.size());
+  ASSERT_EQ(100, records[0].stamp_ns);
+  ASSERT_NEAR(0.25, records[0].duration, 0.00001);
+  ASSERT_NEAR(5.0, records[0].request.vehicle_state.longitudinal_vel, 0.00001);
+
+  // Restore into a fresh world model and confirm the planning relevant state matches
+  auto replay_wm = std::make_shared<carma_wm::CARMAWorldModel>();
+  restore_map(map_msg, replay_wm);
+  restore_world_model_snapshot(records[0].world_model, replay_wm);
+
+  ASSERT_EQ(cmw->getMap()->laneletLayer.size(), replay_wm->getMap()->laneletLayer.size());
+  ASSERT_TRUE(!!replay_wm->getRoute());
+  ASSERT_EQ("test_route", replay_wm->getRouteName());
+  ASSERT_EQ(4u, replay_wm->getRoute()->shortestPath().size());
+  ASSERT_EQ(1203, replay_wm->getRoute()->shortestPath().back().id());
+  ASSERT_EQ(1u, replay_wm->getRoadwayObjects().size());
+
+  // A route which is not in the map cannot be restored
+  records[0].world_model.route.shortest_path_lanelet_ids.push_back(999999);
+  ASSERT_THROW(restore_world_model_snapshot(records[0].world_model, replay_wm), std::invalid_argument);
+
+  std::filesystem::remove_all(dump_dir);
+}
+
+} // carma_guidance_plugins
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <rclcpp/time.hpp>
+
+#include "carma_guidance_plugins/planning_telemetry.hpp"
+
+namespace carma_guidance_plugins
+{
+
+TEST(planning_telemetry_test, disabled)
+{
+  PlanningTelemetry telemetry;
+
+  ASSERT_FALSE(telemetry.enabled());
+
+  telemetry.record_cost_term("jerk", 1.0);
+  telemetry.record_decision_branch("yield", 1);
+
+  ASSERT_EQ(0u, telemetry.get_record_count());
+  ASSERT_TRUE(telemetry.snapshot().empty());
+}
+
+TEST(planning_telemetry_test, records_and_overwrite)
+{
+  PlanningTelemetry telemetry(3);
+
+  ASSERT_EQ(1u, telemetry.begin_plan());
+  telemetry.record_cost_term("a_cost_term_with_a_label_longer_than_the_record", 2.0, 0.5, 3);
+  telemetry.record_decision_branch("yield", 1, { 4.0, 5.0 });
+
+  auto records = telemetry.snapshot();
+  ASSERT_EQ(2u, records.size());
+
+  ASSERT_EQ(0u, records[0].sequence);
+  ASSERT_EQ(1u, records[0].plan_id);
+  ASSERT_EQ(static_cast<uint8_t>(TelemetryRecordType::COST_TERM), records[0].type);
+  ASSERT_EQ(31u, std::strlen(records[0].label)); // Truncated and null terminated
+  ASSERT_NEAR(2.0, records[0].values[0], 0.00001);
+  ASSERT_NEAR(0.5, records[0].values[1], 0.00001);
+  ASSERT_NEAR(1.0, records[0].values[2], 0.00001);
+  ASSERT_NEAR(3.0, records[0].values[3], 0.00001);
+
+  ASSERT_EQ(static_cast<uint8_t>(TelemetryRecordType::DECISION_BRANCH), records[1].type);
+  ASSERT_STREQ("yield", records[1].label);
+  ASSERT_NEAR(1.0, records[1].values[0], 0.00001);
+  ASSERT_NEAR(4.0, records[1].values[1], 0.00001);
+  ASSERT_NEAR(5.0, records[1].values[2], 0.00001);
+  ASSERT_NEAR(0.0, records[1].values[3], 0.00001);
+
+  // Oldest records are overwritten first
+  telemetry.begin_plan();
+  for (int i = 0; i < 3; ++i)
+  {
+    telemetry.record_cost_term("speed", i);
+  }
+
+  records = telemetry.snapshot();
+  ASSERT_EQ(5u, telemetry.get_record_count());
+  ASSERT_EQ(3u, records.size());
+  ASSERT_EQ(2u, records.front().sequence);
+  ASSERT_EQ(4u, records.back().sequence);
+  ASSERT_EQ(2u, records.back().plan_id);
+  ASSERT_NEAR(2.0, records.back().values[0], 0.00001);
+}
+
+TEST(planning_telemetry_test, trajectory_and_maneuver_records)
+{
+  PlanningTelemetry telemetry(10);
+
+  carma_planning_msgs::msg::TrajectoryPlan trajectory;
+  for (int i = 0; i < 3; ++i)
+  {
+    carma_planning_msgs::msg::TrajectoryPlanPoint point;
+    point.x = 10.0 * i;
+    point.target_time = rclcpp::Time(i * 1000000000L);
+    point.planner_plugin_name = "inlanecruising_plugin";
+    trajectory.trajectory_points.push_back(point);
+  }
+  trajectory.trajectory_points.back().x = 15.0; // Slows to 5 m/s over the last segment
+
+  telemetry.record_trajectory_summary(trajectory);
+
+  carma_planning_msgs::msg::ManeuverPlan plan;
+  carma_planning_msgs::msg::Maneuver maneuver;
+  maneuver.type = carma_planning_msgs::msg::Maneuver::LANE_FOLLOWING;
+  maneuver.lane_following_maneuver.parameters.planning_tactical_plugin = "inlanecruising_plugin";
+  maneuver.lane_following_maneuver.start_dist = 5.0;
+  maneuver.lane_following_maneuver.end_dist = 55.0;
+  maneuver.lane_following_maneuver.start_speed = 10.0;
+  maneuver.lane_following_maneuver.end_speed = 10.0;
+  maneuver.lane_following_maneuver.start_time = rclcpp::Time(0);
+  maneuver.lane_following_maneuver.end_time = rclcpp::Time(5000000000L);
+  plan.maneuvers.push_back(maneuver);
+
+  telemetry.record_maneuver_plan(plan);
+
+  auto records = telemetry.snapshot();
+  ASSERT_EQ(2u, records.size());
+
+  ASSERT_EQ(static_cast<uint8_t>(TelemetryRecordType::TRAJECTORY_SUMMARY), records[0].type);
+  ASSERT_STREQ("inlanecruising_plugin", records[0].label);
+  ASSERT_NEAR(3.0, records[0].values[0], 0.00001);  // Points
+  ASSERT_NEAR(2.0, records[0].values[1], 0.00001);  // Duration
+  ASSERT_NEAR(15.0, records[0].values[2], 0.00001); // Length
+  ASSERT_NEAR(10.0, records[0].values[3], 0.00001); // Start speed
+  ASSERT_NEAR(5.0, records[0].values[4], 0.00001);  // End speed
+  ASSERT_NEAR(10.0, records[0].values[5], 0.00001); // Max speed
+
+  ASSERT_EQ(static_cast<uint8_t>(TelemetryRecordType::MANEUVER_PLAN), records[1].type);
+  ASSERT_STREQ("inlanecruising_plugin", records[1].label);
+  ASSERT_NEAR(carma_planning_msgs::msg::Maneuver::LANE_FOLLOWING, records[1].values[0], 0.00001);
+  ASSERT_NEAR(5.0, records[1].values[1], 0.00001);
+  ASSERT_NEAR(55.0, records[1].values[2], 0.00001);
+  ASSERT_NEAR(5.0, records[1].values[5], 0.00001);
+}
+
+TEST(planning_telemetry_test, file_round_trip)
+{
+  PlanningTelemetry telemetry(10);
+  telemetry.begin_plan();
+  telemetry.record_cost_term("jerk", 0.25, 2.0);
+  telemetry.record_decision_branch("yield", 0, { 1.0 });
+
+  auto path = std::filesystem::temp_directory_path() / "planning_telemetry_test.bin";
+  write_telemetry_file(path.string(), telemetry.snapshot());
+
+  auto records = read_telemetry_file(path.string());
+
+  ASSERT_EQ(2u, records.size());
+  ASSERT_EQ(0, std::memcmp(telemetry.snapshot().data(), records.data(), 2 * sizeof(TelemetryRecord)));
+
+  // Files of another format are rejected
+  std::filesystem::resize_file(path, 10);
+  ASSERT_THROW(read_telemetry_file(path.string()), std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+// Records are tagged with the plan of the thread which made them and are never torn, even when several writers
+// share a small buffer and lap each other.
+TEST(planning_telemetry_test, concurrent_writers)
+{
+  PlanningTelemetry telemetry(8);
+  std::atomic<int> running(4);
+
+  std::vector<std::thread> writers;
+  for (int w = 0; w < 4; ++w)
+  {
+    writers.emplace_back([&]() {
+      for (int i = 0; i < 20000; ++i)
+      {
+        const double plan_id = static_cast<double>(telemetry.begin_plan());
+        telemetry.record_decision_branch("branch", i, { plan_id, plan_id, plan_id, plan_id, plan_id });
+      }
+      --running;
+    });
+  }
+
+  auto check = [](const std::vector<TelemetryRecord>& records) {
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+      for (size_t j = 2; j < 6; ++j)
+      {
+        EXPECT_EQ(records[i].values[1], records[i].values[j]);
+      }
+      EXPECT_EQ(static_cast<double>(records[i].plan_id), records[i].values[1]);
+      if (i > 0)
+      {
+        EXPECT_LT(records[i - 1].sequence, records[i].sequence);
+      }
+    }
+  };
+
+  do
+  {
+    check(telemetry.snapshot());
+  } while (running > 0);
+
+  for (auto& writer : writers)
+  {
+    writer.join();
+  }
+
+  check(telemetry.snapshot());
+  ASSERT_EQ(80000u, telemetry.get_record_count());
+  ASSERT_EQ(0u, telemetry.get_plan_id()); // No plan was started on this thread
+}
+
+// Snapshots taken while another thread writes only ever contain complete records in order.
+// The per record cost is only reported, not asserted, as it depends on the load of the host.
+TEST(planning_telemetry_test, concurrent_snapshot)
+{
+  PlanningTelemetry telemetry(64);
+  std::atomic<bool> done(false);
+
+  std::thread writer([&]() {
+    for (int i = 0; i < 200000; ++i)
+    {
+      telemetry.record_decision_branch("branch", i, { static_cast<double>(i) });
+    }
+    done = true;
+  });
+
+  size_t snapshots = 0;
+  do
+  {
+    auto records = telemetry.snapshot();
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+      EXPECT_EQ(records[i].values[0], records[i].values[1]);
+      if (i > 0)
+      {
+        EXPECT_LT(records[i - 1].sequence, records[i].sequence);
+      }
+    }
+    ++snapshots;
+  } while (!done);
+
+  writer.join();
+
+  ASSERT_GT(snapshots, 0u);
+  ASSERT_EQ(64u, telemetry.snapshot().size());
+
+  const int runs = 1000000;
+  PlanningTelemetry disabled;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; ++i)
+  {
+    disabled.record_cost_term("jerk", i);
+  }
+  auto disabled_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / runs;
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; ++i)
+  {
+    telemetry.record_cost_term("jerk", i);
+  }
+  auto enabled_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / runs;
+
+  std::cout << "Planning telemetry record cost disabled: " << disabled_ns << " ns enabled: " << enabled_ns << " ns" << std::endl;
+}
+
+} // carma_guidance_plugins
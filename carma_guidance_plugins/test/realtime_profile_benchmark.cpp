@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "carma_guidance_plugins/realtime_profile.hpp"
+
+namespace carma_guidance_plugins
+{
+
+namespace
+{
+  /**
+   * \brief Runs a 30 Hz timer, matching the ControlPlugin command period, on a single-threaded executor while every CPU is
+   *        kept busy by background threads. Returns the absolute deviation of each observed period from the nominal period in ms.
+   */
+  std::vector<double> measure_command_period_jitter(const RealTimeProfileConfig& config, std::chrono::milliseconds run_time)
+  {
+    const auto period = std::chrono::milliseconds(33);
+
+    // Load the machine
+    std::atomic<bool> stop_load{false};
+    std::vector<std::thread> load_threads;
+    unsigned int load_count = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int i = 0; i < load_count; ++i)
+    {
+      load_threads.emplace_back([&stop_load]() {
+        volatile double sink = 0.0;
+        while (!stop_load)
+        {
+          for (int j = 0; j < 10000; ++j)
+            sink = sink + std::sqrt(static_cast<double>(j));
+        }
+      });
+    }
+
+    auto node = std::make_shared<rclcpp::Node>("realtime_profile_jitter_test");
+
+    std::vector<std::chrono::steady_clock::time_point> stamps;
+    stamps.reserve(static_cast<size_t>(run_time / period) + 10);
+
+    auto timer = node->create_wall_timer(period, [&stamps]() { stamps.push_back(std::chrono::steady_clock::now()); });
+
+    std::thread executor_thread([&]() {
+      if (config.enabled)
+      {
+        try
+        {
+          lock_process_memory(config);
+        }
+        catch (const std::runtime_error& e)
+        {
+          std::cerr << "Skipping memory lock: " << e.what() << std::endl;
+        }
+
+        try
+        {
+          apply_thread_profile(config);
+        }
+        catch (const std::runtime_error& e)
+        {
+          std::cerr << "Skipping thread profile: " << e.what() << std::endl;
+        }
+      }
+
+      rclcpp::executors::SingleThreadedExecutor executor;
+      executor.add_node(node);
+      auto end_time = std::chrono::steady_clock::now() + run_time;
+      while (std::chrono::steady_clock::now() < end_time)
+      {
+        executor.spin_once(std::chrono::milliseconds(10));
+      }
+    });
+
+    executor_thread.join();
+    stop_load = true;
+    for (auto& t : load_threads)
+      t.join();
+
+    std::vector<double> deviations;
+    for (size_t i = 1; i < stamps.size(); ++i)
+    {
+      double actual_ms = std::chrono::duration<double, std::milli>(stamps[i] - stamps[i - 1]).count();
+      deviations.push_back(std::abs(actual_ms - static_cast<double>(period.count())));
+    }
+
+    return deviations;
+  }
+
+  void report(const std::string& label, std::vector<double> deviations)
+  {
+    std::sort(deviations.begin(), deviations.end());
+    auto percentile = [&](double p) { return deviations[static_cast<size_t>(p * (deviations.size() - 1))]; };
+
+    std::cout << label << " command period deviation (ms) over " << deviations.size() << " periods."
+              << " p50: " << percentile(0.5) << " p95: " << percentile(0.95) << " p99: " << percentile(0.99)
+              << " max: " << deviations.back() << std::endl;
+  }
+}
+
+// Reports the distribution of command period deviations under full CPU load with and without the profile.
+// Timing is only reported, not asserted, as the result depends on the privileges and load of the host.
+TEST(realtime_profile_benchmark, command_period_jitter)
+{
+  const auto run_time = std::chrono::milliseconds(3000);
+
+  RealTimeProfileConfig default_profile;
+  auto default_deviations = measure_command_period_jitter(default_profile, run_time);
+
+  RealTimeProfileConfig realtime_profile;
+  realtime_profile.enabled = true;
+  realtime_profile.cpu_affinity = { 0 };
+  realtime_profile.lock_memory = false; // MCL_FUTURE would persist for the remaining tests in this process
+  auto realtime_deviations = measure_command_period_jitter(realtime_profile, run_time);
+
+  ASSERT_GT(default_deviations.size(), 10u);
+  ASSERT_GT(realtime_deviations.size(), 10u);
+
+  report("Default", default_deviations);
+  report("Real-time", realtime_deviations);
+}
+
+} // carma_guidance_plugins
+
+int main(int argc, char ** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    //Initialize ROS
+    rclcpp::init(argc, argv);
+
+    bool success = RUN_ALL_TESTS();
+
+    //shutdown ROS
+    rclcpp::shutdown();
+
+    return success;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "carma_guidance_plugins/realtime_profile.hpp"
+
+namespace carma_guidance_plugins
+{
+
+TEST(realtime_profile_test, parameters)
+{
+  auto node = std::make_shared<rclcpp::Node>("realtime_profile_param_test");
+
+  auto declared = declare_realtime_profile_parameters(node->get_node_parameters_interface());
+  ASSERT_FALSE(declared.enabled);
+  ASSERT_EQ("fifo", declared.scheduling_policy);
+
+  node->set_parameter(rclcpp::Parameter("realtime_profile.enabled", true));
+  node->set_parameter(rclcpp::Parameter("realtime_profile.scheduling_policy", "rr"));
+  node->set_parameter(rclcpp::Parameter("realtime_profile.cpu_affinity", std::vector<int64_t>{ 0 }));
+
+  auto loaded = get_realtime_profile_parameters(node->get_node_parameters_interface());
+  ASSERT_TRUE(loaded.enabled);
+  ASSERT_EQ("rr", loaded.scheduling_policy);
+  ASSERT_EQ(1u, loaded.cpu_affinity.size());
+  ASSERT_EQ(declared.priority, loaded.priority);
+}
+
+TEST(realtime_profile_test, invalid_settings)
+{
+  RealTimeProfileConfig config;
+  config.scheduling_policy = "deadline";
+  ASSERT_THROW(apply_thread_profile(config), std::invalid_argument);
+
+  ASSERT_THROW(apply_thread_scheduling(config), std::invalid_argument);
+  ASSERT_NO_THROW(apply_thread_affinity(config)); // No CPUs to pin to
+
+  config.scheduling_policy = "other";
+  config.cpu_affinity = { -1 };
+  ASSERT_THROW(apply_thread_profile(config), std::invalid_argument);
+  ASSERT_THROW(apply_thread_affinity(config), std::invalid_argument);
+  ASSERT_NO_THROW(apply_thread_scheduling(config)); // Default scheduling needs no privileges
+}
+
+} // carma_guidance_plugins
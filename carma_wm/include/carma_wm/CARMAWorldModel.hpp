@@ -21,6 +21,9 @@
 #include <lanelet2_core/primitives/BasicRegulatoryElements.h>
 #include <lanelet2_core/primitives/LineString.h>
 #include "carma_wm/IndexedDistanceMap.hpp"
+#include "carma_wm/LaneChainIndex.hpp"
+#include "carma_wm/ConflictZoneIndex.hpp"
+#include "carma_wm/LaneletReachabilityIndex.hpp"
 #include <carma_perception_msgs/msg/roadway_obstacle.hpp>
 #include <carma_perception_msgs/msg/roadway_obstacle_list.hpp>
 #include <carma_perception_msgs/msg/external_object.hpp>
@@ -32,6 +35,8 @@
 #include "boost/date_time/posix_time/posix_time.hpp"
 #include "carma_wm/SignalizedIntersectionManager.hpp"
 #include <rosgraph_msgs/msg/clock.hpp>
+#include <mutex>
+#include <unordered_map>
 
 namespace carma_wm
 {
@@ -223,6 +228,20 @@ public:
 
   std::string getRouteName() const override;
 
+  bool isOnRoute(lanelet::Id lanelet_id) const override;
+
+  lanelet::Optional<size_t> routeIndexOf(lanelet::Id lanelet_id) const override;
+
+  lanelet::Optional<lanelet::ConstLanelet> nextOnRoute(lanelet::Id lanelet_id) const override;
+
+  lanelet::Optional<lanelet::ConstLanelet> previousOnRoute(lanelet::Id lanelet_id) const override;
+
+  lanelet::Optional<double> getReachableDistance(lanelet::Id from, lanelet::Id to, double max_distance) const override;
+
+  lanelet::Optional<double> getLongitudinalGap(const lanelet::ConstLanelet& from, double from_downtrack,
+                                               const lanelet::ConstLanelet& to, double to_downtrack,
+                                               double max_distance) const override;
+
   TrackPos getRouteEndTrackPos() const override;
 
   LaneletRoutingGraphConstPtr getMapRoutingGraph() const override;
@@ -233,6 +252,12 @@ public:
   lanelet::Optional<TrafficRulesConstPtr>
   getTrafficRules() const override;
 
+  double getSpeedLimit(const lanelet::ConstLanelet& lanelet) const override;
+
+  std::vector<RouteSpeedLimitSegment> getRouteSpeedLimitProfile() const override;
+
+  lanelet::Optional<double> getRouteSpeedLimit(double downtrack) const override;
+
   std::vector<carma_perception_msgs::msg::RoadwayObstacle> getRoadwayObjects() const override;
 
   std::vector<carma_perception_msgs::msg::RoadwayObstacle> getInLaneObjects(const lanelet::ConstLanelet& lanelet, const LaneSection& section = LANE_AHEAD) const override;
@@ -257,6 +282,13 @@ public:
 
   std::vector<lanelet::CarmaTrafficSignalPtr> getSignalsAlongRoute(const lanelet::BasicPoint2d& loc) const override;
 
+  std::vector<ConflictZone> getConflictZones(const lanelet::ConstLanelet& lanelet) const override;
+
+  std::vector<ConflictZone> getConflictZonesAlongRoute(const lanelet::BasicPoint2d& loc) const override;
+
+  std::vector<carma_perception_msgs::msg::RoadwayObstacle> getConflictZoneObjects(const ConflictZone& zone,
+                                                                                   double time_horizon) const override;
+
   std::vector<lanelet::BusStopRulePtr> getBusStopsAlongRoute(const lanelet::BasicPoint2d& loc) const override;
 
   boost::optional<std::pair<lanelet::ConstLanelet, lanelet::ConstLanelet>> getEntryExitOfSignalAlongRoute(const lanelet::CarmaTrafficSignalPtr& traffic_signal) const override;
@@ -293,6 +325,69 @@ private:
    */
   lanelet::LineString3d copyConstructLineString(const lanelet::ConstLineString3d& line) const;
 
+  /*! \brief Cached traffic rules and speed limits. The whole cache is replaced at once whenever
+   *         the map, route, configured speed limit or participant type changes so readers never observe a mix of old and new values.
+   */
+  struct SpeedLimitCache
+  {
+    std::unordered_map<std::string, TrafficRulesConstPtr> traffic_rules;  // Traffic rules by participant
+    std::unordered_map<lanelet::Id, double> speed_limits;                 // Speed limit by lanelet id. Filled on first request
+    std::vector<RouteSpeedLimitSegment> route_profile;                    // Speed limits along the route shortest path
+  };
+
+  /*! \brief Helper function to drop all cached traffic rules and speed limits and rebuild the route speed limit profile.
+   *         Called whenever an input to the speed limit computation changes.
+   */
+  void resetSpeedLimitCache();
+
+  /*! \brief Helper function to compute the speed limit of each lanelet along the route shortest path.
+   *         Assumes the caller holds speed_limit_cache_mutex_
+   */
+  std::vector<RouteSpeedLimitSegment> computeRouteSpeedLimitProfile(SpeedLimitCache& cache) const;
+
+  /*! \brief Helper function to get the cached speed limit of a lanelet or compute and cache it.
+   *         Assumes the caller holds speed_limit_cache_mutex_
+   */
+  double cachedSpeedLimit(SpeedLimitCache& cache, const lanelet::ConstLanelet& lanelet) const;
+
+  /*! \brief Helper function to get the cached traffic rules for a participant or build and cache them.
+   *         Assumes the caller holds speed_limit_cache_mutex_
+   */
+  lanelet::Optional<TrafficRulesConstPtr> cachedTrafficRules(SpeedLimitCache& cache, const std::string& participant) const;
+
+  /*! \brief Helper function to get the lane chain index for the current routing graph. The index is built on first use
+   *         after the routing graph changes.
+   *
+   *  \throw std::invalid_argument if the routing graph is not set
+   */
+  std::shared_ptr<const LaneChainIndex> getLaneChainIndex() const;
+
+  mutable std::mutex lane_chain_index_mutex_;
+  mutable std::shared_ptr<const LaneChainIndex> lane_chain_index_; // Lanes of the current routing graph. Reset when the graph changes
+
+  /*! \brief Helper function to get the conflict zone index for the current routing graph. The index is built on first
+   *         use after the routing graph changes.
+   *
+   *  \throw std::invalid_argument if the routing graph is not set
+   */
+  std::shared_ptr<const ConflictZoneIndex> getConflictZoneIndex() const;
+
+  mutable std::mutex conflict_zone_index_mutex_;
+  mutable std::shared_ptr<const ConflictZoneIndex> conflict_zone_index_; // Conflict zones of the current routing graph. Reset when the graph changes
+
+  /*! \brief Helper function to get the reachability index for the current routing graph. The index is built on first
+   *         use after the routing graph changes.
+   *
+   *  \throw std::invalid_argument if the routing graph is not set
+   */
+  std::shared_ptr<const LaneletReachabilityIndex> getReachabilityIndex() const;
+
+  mutable std::mutex reachability_index_mutex_;
+  mutable std::shared_ptr<const LaneletReachabilityIndex> reachability_index_; // Lanelet lengths and cached distances of the current routing graph. Reset when the graph changes
+
+  mutable std::mutex speed_limit_cache_mutex_;
+  std::shared_ptr<SpeedLimitCache> speed_limit_cache_ = std::make_shared<SpeedLimitCache>();
+
   std::optional<rclcpp::Time> ros1_clock_ = std::nullopt;
   std::optional<rclcpp::Time> simulation_clock_ = std::nullopt;
 
@@ -305,6 +400,8 @@ private:
   std::vector<lanelet::LineString3d> shortest_path_centerlines_;  // List of disjoint centerlines seperated by lane
                                                                   // changes along the shortest path
   IndexedDistanceMap shortest_path_distance_map_;
+  lanelet::ConstLanelets route_lanelets_;  // Copy of the route shortest path so ordinal lookups do not touch the route
+  std::unordered_map<lanelet::Id, size_t> route_ordinal_map_;  // Lanelet id to index in route_lanelets_
   lanelet::LaneletMapUPtr shortest_path_filtered_centerline_view_;  // Lanelet map view of shortest path center lines
                                                                     // only
   std::vector<carma_perception_msgs::msg::RoadwayObstacle> roadway_objects_; //
@@ -0,0 +1,85 @@
+#pragma once
+
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <vector>
+#include <unordered_map>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include "carma_wm/WorldModel.hpp"
+
+namespace carma_wm
+{
+/*!
+ * \brief Precomputed conflict zones of a routing graph.
+ *        NOTE: This structure is used internally in the world model and is not intended for use by WorldModel users.
+ *
+ * When built, every pair of passable lanelets which the routing graph reports as conflicting is intersected once. The
+ * convex hull of the overlap becomes the zone area and the extent of the area projected onto each lanelet centerline
+ * gives the entry and exit downtracks along that lanelet. Pairs which only touch are skipped.
+ *
+ * Building is O(n * k) in the number of passable lanelets n and conflicts per lanelet k. The structure must be rebuilt
+ * whenever the routing graph changes.
+ */
+class ConflictZoneIndex
+{
+private:
+  // Lanelet id to the zones of that lanelet sorted by entry downtrack
+  std::unordered_map<lanelet::Id, std::vector<ConflictZone>> zones_;
+
+  // Number of conflicting lanelet pairs with a zone
+  size_t pair_count_ = 0;
+
+public:
+  // Overlaps smaller than this many square meters are treated as touching lanelets
+  static constexpr double MIN_ZONE_AREA = 0.01;
+
+  /*!
+   * \brief Build the structure from the provided routing graph. Any previous content is discarded.
+   *
+   * \param graph The routing graph whose conflicting lanelets will be indexed
+   */
+  void build(const lanelet::routing::RoutingGraph& graph);
+
+  /*!
+   * \brief Computes the conflict zone of two lanelets
+   *
+   * \param lanelet The lanelet the entry and exit downtracks are measured along
+   * \param conflicting_lanelet The other lanelet
+   *
+   * \return The zone or boost::none if the lanelets overlap by less than MIN_ZONE_AREA
+   */
+  static lanelet::Optional<ConflictZone> computeZone(const lanelet::ConstLanelet& lanelet,
+                                                     const lanelet::ConstLanelet& conflicting_lanelet);
+
+  /*!
+   * \brief Returns the conflict zones of the provided lanelet sorted by entry downtrack
+   *
+   * \param lanelet The lanelet to get the zones of
+   *
+   * \return The zones. Empty if the lanelet has none or is not indexed
+   */
+  const std::vector<ConflictZone>& getConflictZones(const lanelet::ConstLanelet& lanelet) const;
+
+  /*!
+   * \brief Returns number of conflicting lanelet pairs in this structure. Each pair is stored once per lanelet.
+   *
+   * \return The pair count
+   */
+  size_t size() const;
+};
+}  // namespace carma_wm
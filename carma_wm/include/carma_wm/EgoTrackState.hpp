@@ -0,0 +1,39 @@
+#pragma once
+
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <lanelet2_core/Forward.h>
+#include "carma_wm/TrackPos.hpp"
+
+namespace carma_wm
+{
+/*! \brief Position of the host vehicle relative to the active route at a point in time.
+ *
+ * When sourced from the route node's RouteState message the position is that of the vehicle front bumper.
+ * When computed locally the position is that of the point provided by the caller.
+ */
+struct EgoTrackState
+{
+  double stamp = 0;                          // Time in seconds at which the state was valid
+  TrackPos route_track_pos = TrackPos(0, 0); // Downtrack and crosstrack relative to the route
+  lanelet::Id lanelet_id = lanelet::InvalId; // Route lanelet the vehicle is currently in
+  double lanelet_downtrack = 0;              // Downtrack along the current lanelet in meters
+  double speed_limit = 0;                    // Speed limit of the current lanelet in m/s
+  bool from_route_state = false;             // True if the state was provided by the route node instead of computed locally
+};
+
+}  // namespace carma_wm
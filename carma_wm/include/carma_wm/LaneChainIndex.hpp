@@ -0,0 +1,111 @@
+#pragma once
+
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include "carma_wm/WorldModel.hpp"
+
+namespace carma_wm
+{
+/*!
+ * \brief Precomputed longitudinal lane lookup structure for quickly accessing the lanelets which make up a lane.
+ *        NOTE: This structure is used internally in the world model and is not intended for use by WorldModel users.
+ *
+ * A lane is defined the same way as CARMAWorldModel::getLane always has: starting from a lanelet, repeatedly take the
+ * first following (or previous) lanelet reported by the routing graph without lane changes.
+ *
+ * When built, every passable lanelet is assigned to exactly one chain. Two consecutive lanelets a, b share a chain
+ * when b is the first successor of a and a is the first predecessor of b. Where this does not hold (merges and splits)
+ * the chain ends and stores a link to the chain and offset where the lane continues. A lane query is then answered by
+ * copying one slice per chain crossed instead of issuing a routing graph query per lanelet.
+ *
+ * Building is O(n) in the number of passable lanelets. The structure must be rebuilt whenever the routing graph changes.
+ */
+class LaneChainIndex
+{
+private:
+  // Position of a lanelet inside the chain list
+  struct ChainPosition
+  {
+    size_t chain = 0;
+    size_t offset = 0;
+  };
+
+  // Ordered lanelet chains
+  std::vector<std::vector<lanelet::ConstLanelet>> chains_;
+
+  // Lanelet id to chain/offset mapping
+  std::unordered_map<lanelet::Id, ChainPosition> id_index_map_;
+
+  // For each chain the position where the lane continues after the last element or precedes the first element
+  // Unset if the lane ends
+  std::vector<lanelet::Optional<ChainPosition>> chain_next_;
+  std::vector<lanelet::Optional<ChainPosition>> chain_prev_;
+
+  /*!
+   * \brief Helper function to append the lanelets ahead of the provided position, including the position itself
+   */
+  void appendAhead(ChainPosition pos, std::vector<lanelet::ConstLanelet>& output) const;
+
+  /*!
+   * \brief Helper function to collect the lanelets behind the provided position, excluding the position itself,
+   *        ordered from the start of the lane
+   */
+  std::vector<lanelet::ConstLanelet> collectBehind(ChainPosition pos) const;
+
+public:
+  /*!
+   * \brief Build the structure from the provided routing graph. Any previous content is discarded.
+   *
+   * \param graph The routing graph whose passable lanelets will be indexed
+   */
+  void build(const lanelet::routing::RoutingGraph& graph);
+
+  /*!
+   * \brief Returns the specified lane section which includes the provided lanelet sorted from the start of the lane.
+   *        Lanelets which are not part of the indexed graph are returned as a single element lane.
+   *
+   * \param lanelet The lanelet to get the lane of
+   * \param section either of LANE_AHEAD, LANE_BEHIND, LANE_FULL each including the provided lanelet
+   *
+   * \throw std::invalid_argument if the lane section is not one of the three
+   *
+   * \return The lanelets of the requested lane section
+   */
+  std::vector<lanelet::ConstLanelet> getLane(const lanelet::ConstLanelet& lanelet, const LaneSection& section) const;
+
+  /*!
+   * \brief Returns number of chains in this structure
+   *
+   * \return The chain count
+   */
+  size_t size() const;
+
+  /*!
+   * \brief Returns the chain index and offset of the provided lanelet
+   *
+   * \throws std::out_of_range if the lanelet is not indexed
+   *
+   * \return A pair where the first element is the chain index and the second is the offset of the lanelet in that chain
+   */
+  std::pair<size_t, size_t> getIndexFromId(const lanelet::Id& id) const;
+};
+}  // namespace carma_wm
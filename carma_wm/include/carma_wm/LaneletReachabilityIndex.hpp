@@ -0,0 +1,110 @@
+#pragma once
+
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_core/utility/Optional.h>
+#include <lanelet2_routing/RoutingGraph.h>
+
+namespace carma_wm
+{
+/*!
+ * \brief Precomputed lanelet lengths and connectivity used to answer bounded reachability queries.
+ *        NOTE: This structure is used internally in the world model and is not intended for use by WorldModel users.
+ *
+ * The distance from lanelet A to lanelet B is the along-lane distance from the start of A to the start of B. Moving to
+ * a following lanelet adds the length of the lanelet being left. Changing lanes to a left or right neighbor which the
+ * routing graph allows adds no distance. Queries run a Dijkstra search which stops once the provided bound is exceeded,
+ * so their cost depends on the bound rather than the map size.
+ *
+ * Recent results are cached. A found distance answers every later query with a bound at least as large and an
+ * unreachable result answers every later query with a bound at most as large. The cache is cleared when full.
+ * The structure must be rebuilt whenever the routing graph changes.
+ */
+class LaneletReachabilityIndex
+{
+private:
+  struct CacheEntry
+  {
+    lanelet::Optional<double> distance;  // Shortest distance if found
+    double searched_distance = 0;        // Bound of the search which produced this entry
+  };
+
+  struct IdPairHash
+  {
+    size_t operator()(const std::pair<lanelet::Id, lanelet::Id>& ids) const
+    {
+      return std::hash<lanelet::Id>()(ids.first) ^ (std::hash<lanelet::Id>()(ids.second) << 1);
+    }
+  };
+
+  // Lanelet id to node index
+  std::unordered_map<lanelet::Id, size_t> id_index_map_;
+
+  // Per node centerline length, following lanelets and lane change neighbors
+  std::vector<double> lengths_;
+  std::vector<std::vector<size_t>> following_;
+  std::vector<std::vector<size_t>> neighbors_;
+
+  mutable std::mutex cache_mutex_;
+  mutable std::unordered_map<std::pair<lanelet::Id, lanelet::Id>, CacheEntry, IdPairHash> cache_;
+
+  /*!
+   * \brief Bounded Dijkstra search between two node indexes
+   */
+  lanelet::Optional<double> search(size_t from, size_t to, double max_distance) const;
+
+public:
+  // Number of cached (from, to) pairs after which the cache is cleared
+  static constexpr size_t MAX_CACHE_SIZE = 4096;
+
+  /*!
+   * \brief Build the structure from the provided routing graph. Any previous content including the cache is discarded.
+   *
+   * \param graph The routing graph whose passable lanelets will be indexed
+   */
+  void build(const lanelet::routing::RoutingGraph& graph);
+
+  /*!
+   * \brief Returns the along-lane distance from the start of one lanelet to the start of another
+   *
+   * \param from Id of the starting lanelet
+   * \param to Id of the lanelet to reach
+   * \param max_distance Largest distance to search in meters
+   *
+   * \return The distance or boost::none if either lanelet is not indexed or to cannot be reached within max_distance
+   */
+  lanelet::Optional<double> distance(lanelet::Id from, lanelet::Id to, double max_distance) const;
+
+  /*!
+   * \brief Returns number of lanelets in this structure
+   *
+   * \return The lanelet count
+   */
+  size_t size() const;
+
+  /*!
+   * \brief Returns number of cached query results
+   *
+   * \return The cache size
+   */
+  size_t cacheSize() const;
+};
+}  // namespace carma_wm
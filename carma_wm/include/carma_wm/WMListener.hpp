@@ -20,11 +20,13 @@
 #include <mutex>
 #include <rclcpp/rclcpp.hpp>
 #include <carma_wm/WorldModel.hpp>
+#include <carma_wm/EgoTrackState.hpp>
 #include <carma_ros2_utils/carma_ros2_utils.hpp>
 #include <autoware_lanelet2_msgs/msg/map_bin.hpp>
 #include <queue>
 #include <carma_perception_msgs/msg/roadway_obstacle_list.hpp>
 #include <carma_planning_msgs/msg/route.hpp>
+#include <carma_planning_msgs/msg/route_state.hpp>
 #include <carma_v2x_msgs/msg/spat.hpp>
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
 #include <rosgraph_msgs/msg/clock.hpp>
@@ -42,6 +44,12 @@ class WMListenerWorker;  // Forward declaration of worker class
  * in the constructor. When used in a multi-threading case users can ensure threadsafe operation though usage of the
  * getLock function
  *
+ * If the use_corridor_map parameter is true (the default) the listener also subscribes to semantic_map_corridor.
+ * Once a corridor map around the active route is received it replaces the full map until the next map version.
+ * The full map is only subscribed to until the first corridor map arrives and again when a map update
+ * reports a new map version, so full maps are not received and deserialized while a corridor is in use.
+ * The route node always keeps the full map.
+ *
  */
 class WMListener
 {
@@ -125,10 +133,46 @@ public:
    */
   bool checkIfReRoutingNeededWL();
 
+  /*!
+   * \brief Subscribe to the route node's route_state topic so the ego track state it computes can be reused
+   *        instead of each node recomputing it from its own pose. Calling this method more than once has no additional effect.
+   *
+   * \param max_age The maximum age in seconds of a received route state before it is considered stale. Default is 0.2
+   */
+  void enableRouteStateUpdates(double max_age = 0.2);
+
+  /*!
+   * \brief Returns the ego track state from the route node if route state updates are enabled and the most recent state is valid.
+   *        The returned position is that of the vehicle front bumper.
+   *
+   * \param now The current time
+   *
+   * \return The cached ego track state or boost::none if it is unavailable or stale
+   */
+  lanelet::Optional<EgoTrackState> getCachedEgoTrackState(const rclcpp::Time& now);
+
+  /*!
+   * \brief Returns the ego track state from the route node if valid, otherwise computes it locally from the provided position
+   *
+   * \param ego_position The position used to compute the state locally when the cached state cannot be used
+   * \param now The current time
+   *
+   * \throw std::invalid_argument if the state must be computed locally and the route is not yet loaded
+   *
+   * \return The ego track state
+   */
+  EgoTrackState getEgoTrackState(const lanelet::BasicPoint2d& ego_position, const rclcpp::Time& now);
+
 
 private:
   // Callback function that uses lock to edit the map
   void mapUpdateCallback(autoware_lanelet2_msgs::msg::MapBin::SharedPtr geofence_msg);
+
+  // Callback for corridor maps. Drops the full map subscription once a corridor is in use
+  void corridorMapCallback(autoware_lanelet2_msgs::msg::MapBin::SharedPtr map_msg);
+
+  // Subscribe to the full semantic map. Does nothing if already subscribed
+  void subscribeToFullMap();
   carma_ros2_utils::SubPtr<carma_perception_msgs::msg::RoadwayObstacleList> roadway_objects_sub_;
   carma_ros2_utils::SubPtr<autoware_lanelet2_msgs::msg::MapBin> map_update_sub_;
 
@@ -140,10 +184,13 @@ private:
   std::unique_ptr<WMListenerWorker> worker_;
 
   carma_ros2_utils::SubPtr<autoware_lanelet2_msgs::msg::MapBin> map_sub_;
+  carma_ros2_utils::SubPtr<autoware_lanelet2_msgs::msg::MapBin> corridor_map_sub_;
+  rclcpp::SubscriptionOptions map_options_;
   carma_ros2_utils::SubPtr<carma_planning_msgs::msg::Route> route_sub_;
   carma_ros2_utils::SubPtr<carma_v2x_msgs::msg::SPAT> traffic_spat_sub_;
   carma_ros2_utils::SubPtr<rosgraph_msgs::msg::Clock> sim_clock_sub_;
   carma_ros2_utils::SubPtr<rosgraph_msgs::msg::Clock> ros1_clock_sub_;
+  carma_ros2_utils::SubPtr<carma_planning_msgs::msg::RouteState> route_state_sub_;
   const bool multi_threaded_;
   std::mutex mw_mutex_;
 
@@ -419,6 +419,8 @@ inline void setSpeedLimit (lanelet::Velocity speed_limit, std::shared_ptr<carma_
                                                      { lanelet::Participants::Vehicle }));
     cmw->getMutableMap()->update(llt, sl);
   }
+  // Re-set the map so the world model drops any speed limits it has already cached
+  cmw->setMap(cmw->getMutableMap(), cmw->getMapVersion(), false);
   RCLCPP_INFO_STREAM(rclcpp::get_logger("WMTestLibForGuidance"),"Set the new speed limit! Value: " << speed_limit.value());
 }
 
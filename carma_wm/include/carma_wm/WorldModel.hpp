@@ -55,6 +55,33 @@ using LaneletRoutingGraphConstUPtr = std::unique_ptr<const lanelet::routing::Rou
 using TrafficRulesConstPtr = std::shared_ptr<const lanelet::traffic_rules::TrafficRules>;
 using TrafficRulesUConstPtr = std::unique_ptr<const lanelet::traffic_rules::TrafficRules>;
 
+/*! \brief Speed limit of a single lanelet along the route shortest path, ordered by route downtrack.
+ */
+struct RouteSpeedLimitSegment
+{
+  lanelet::Id lanelet_id = lanelet::InvalId;
+  double start_downtrack = 0;  // Route downtrack of the start of the lanelet in meters
+  double end_downtrack = 0;    // Route downtrack of the end of the lanelet in meters
+  double speed_limit = 0;      // Speed limit in m/s
+};
+
+/*! \brief Area shared by two lanelets which the routing graph reports as conflicting, such as crossing or merging
+ *         paths through an intersection. Each conflicting pair is described twice, once from the point of view of
+ *         each lanelet.
+ */
+struct ConflictZone
+{
+  lanelet::ConstLanelet lanelet;              // Lanelet the entry and exit downtracks are measured along
+  lanelet::ConstLanelet conflicting_lanelet;  // Lanelet sharing the zone
+  lanelet::BasicPolygon2d area;               // Convex hull of the overlap of the two lanelets
+  double entry_downtrack = 0;                 // Downtrack where the lanelet centerline enters the zone in meters
+  double exit_downtrack = 0;                  // Downtrack where the lanelet centerline leaves the zone in meters
+  double conflicting_entry_downtrack = 0;     // Same as entry_downtrack but along the conflicting lanelet
+  double conflicting_exit_downtrack = 0;      // Same as exit_downtrack but along the conflicting lanelet
+  double route_entry_downtrack = 0;           // Route downtrack of the zone entry. Only set by getConflictZonesAlongRoute
+  double route_exit_downtrack = 0;            // Route downtrack of the zone exit. Only set by getConflictZonesAlongRoute
+};
+
 // Helpful enums for dividing lane into sections of interest.
 enum LaneSection
 {
@@ -198,6 +225,74 @@ class WorldModel
     */
     virtual std::string getRouteName() const = 0;    
 
+    /*! \brief Check if a lanelet is on the shortest path of the current route. Runs in constant time using a table
+    *          built when the route is set.
+    *
+    * \param lanelet_id The id of the lanelet to check
+    *
+    * \return True if the lanelet is on the route shortest path. False if it is not or no route is loaded
+    */
+    virtual bool isOnRoute(lanelet::Id lanelet_id) const = 0;
+
+    /*! \brief Get the position of a lanelet along the shortest path of the current route where the first lanelet is 0.
+    *          Runs in constant time.
+    *
+    * \param lanelet_id The id of the lanelet to look up
+    *
+    * \return The index of the lanelet in the route shortest path. Empty if the lanelet is not on the route
+    */
+    virtual lanelet::Optional<size_t> routeIndexOf(lanelet::Id lanelet_id) const = 0;
+
+    /*! \brief Get the lanelet following the provided lanelet on the shortest path of the current route. Runs in
+    *          constant time.
+    *
+    * \param lanelet_id The id of a lanelet on the route
+    *
+    * \return The next lanelet. Empty if the lanelet is not on the route or is the last route lanelet
+    */
+    virtual lanelet::Optional<lanelet::ConstLanelet> nextOnRoute(lanelet::Id lanelet_id) const = 0;
+
+    /*! \brief Get the lanelet preceding the provided lanelet on the shortest path of the current route. Runs in
+    *          constant time.
+    *
+    * \param lanelet_id The id of a lanelet on the route
+    *
+    * \return The previous lanelet. Empty if the lanelet is not on the route or is the first route lanelet
+    */
+    virtual lanelet::Optional<lanelet::ConstLanelet> previousOnRoute(lanelet::Id lanelet_id) const = 0;
+
+    /*! \brief Get the along-lane distance from the start of one lanelet to the start of another if it is reachable within
+    *          the provided distance. Following a lanelet adds its length while lane changes allowed by the routing
+    *          graph add nothing. The search is bounded by max_distance and results are cached per routing graph, so
+    *          this is much cheaper than building a route.
+    *
+    * \param from Id of the starting lanelet
+    * \param to Id of the lanelet to reach
+    * \param max_distance Largest distance to search in meters
+    *
+    * \throw std::invalid_argument if the routing graph is not set
+    *
+    * \return The distance in meters. Empty if to cannot be reached from from within max_distance
+    */
+    virtual lanelet::Optional<double> getReachableDistance(lanelet::Id from, lanelet::Id to, double max_distance) const = 0;
+
+    /*! \brief Get the along-lane gap from a position on one lanelet to a position on another lanelet ahead of it. This
+    *          is the reachable distance between the lanelets adjusted by the positions along each lanelet.
+    *
+    * \param from Lanelet of the rear position
+    * \param from_downtrack Downtrack of the rear position along the centerline of from
+    * \param to Lanelet of the front position
+    * \param to_downtrack Downtrack of the front position along the centerline of to
+    * \param max_distance Largest lanelet distance to search in meters measured from the rear position
+    *
+    * \throw std::invalid_argument if the routing graph is not set
+    *
+    * \return The gap in meters. Empty if to cannot be reached from from within max_distance
+    */
+    virtual lanelet::Optional<double> getLongitudinalGap(const lanelet::ConstLanelet& from, double from_downtrack,
+                                                         const lanelet::ConstLanelet& to, double to_downtrack,
+                                                         double max_distance) const = 0;
+
     /*! \brief Get trackpos of the end of route point relative to the route
     *
     * \return Trackpos
@@ -237,6 +332,36 @@ class WorldModel
     virtual lanelet::Optional<TrafficRulesConstPtr>
     getTrafficRules() const = 0;
 
+    /**
+     * \brief Get the speed limit of the provided lanelet as interpreted by the world model's traffic rules.
+     *        Results are cached per lanelet and invalidated whenever the map, configured speed limit or participant changes,
+     *        so repeated calls for the same lanelet do not re-evaluate its regulatory elements.
+     *
+     * \param lanelet The lanelet to get the speed limit of
+     *
+     * \throw std::invalid_argument if a valid traffic rules object could not be built
+     *
+     * \return The speed limit in m/s
+     */
+    virtual double getSpeedLimit(const lanelet::ConstLanelet& lanelet) const = 0;
+
+    /**
+     * \brief Get the speed limits of the lanelets along the route shortest path sorted by route downtrack.
+     *        The profile is computed once per route and recomputed when the map is updated.
+     *
+     * \return The route speed limit profile. Empty if no route is set
+     */
+    virtual std::vector<RouteSpeedLimitSegment> getRouteSpeedLimitProfile() const = 0;
+
+    /**
+     * \brief Get the speed limit which applies at the provided route downtrack using the route speed limit profile.
+     *
+     * \param downtrack The route downtrack in meters
+     *
+     * \return The speed limit in m/s. boost::none if no route is set or the downtrack lies outside the route
+     */
+    virtual lanelet::Optional<double> getRouteSpeedLimit(double downtrack) const = 0;
+
     /**
      * \brief Converts an ExternalObject in a RoadwayObstacle by mapping its position onto the semantic map. Can also be
      * used to determine if the object is on the roadway
@@ -436,6 +561,43 @@ class WorldModel
      * \return vector of underlying lanelet, empty vector if it is not part of any lanelet
      */
     virtual std::vector<lanelet::ConstLanelet> nonConnectedAdjacentLeft(const lanelet::BasicPoint2d& input_point, const unsigned int n = 10) const = 0;
+
+    /**
+     * \brief Returns the conflict zones of the provided lanelet sorted by entry downtrack. The zones are computed once
+     *        per routing graph from its conflicting relations.
+     *
+     * \param lanelet The lanelet whose conflict zones are requested. Downtracks are measured along its centerline
+     *
+     * \throw std::invalid_argument if the routing graph is not set
+     *
+     * \return The conflict zones of the lanelet. Empty if the lanelet has no conflicts or is not part of the graph
+     */
+    virtual std::vector<ConflictZone> getConflictZones(const lanelet::ConstLanelet& lanelet) const = 0;
+
+    /**
+     * \brief Returns the conflict zones of the route shortest path which end after the provided location, sorted by
+     *        route entry downtrack. In the result route_entry_downtrack and route_exit_downtrack are set, while the
+     *        other downtracks remain measured along the zone lanelets so the zones can be passed to getConflictZoneObjects.
+     *
+     * \param loc Location on the route, typically the vehicle position
+     *
+     * \return The conflict zones ahead of the location. Empty if the map or route is not set
+     */
+    virtual std::vector<ConflictZone> getConflictZonesAlongRoute(const lanelet::BasicPoint2d& loc) const = 0;
+
+    /**
+     * \brief Returns the roadway objects which occupy the provided conflict zone or can reach it within the provided
+     *        time horizon. An object reaches the zone if one of its predictions in the horizon overlaps the zone, or,
+     *        when it is on either zone lanelet or a lanelet directly preceding one, if its current speed carries it to
+     *        the zone entry before the horizon ends.
+     *
+     * \param zone The conflict zone as returned by getConflictZones or getConflictZonesAlongRoute
+     * \param time_horizon Look ahead time in seconds
+     *
+     * \return The roadway objects occupying or approaching the zone
+     */
+    virtual std::vector<carma_perception_msgs::msg::RoadwayObstacle> getConflictZoneObjects(const ConflictZone& zone,
+                                                                                           double time_horizon) const = 0;
                                                                                              
 };
 // Helpful using declarations for carma_wm classes
@@ -22,6 +22,7 @@
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 #include <lanelet2_core/Attribute.h>
 #include <lanelet2_core/geometry/LineString.h>
+#include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_core/primitives/Traits.h>
 #include <Eigen/Core>
 #include <Eigen/LU>
@@ -574,6 +575,9 @@ namespace carma_wm
     semantic_map_ = map;
     map_version_ = map_version;
 
+    // Speed limits may have been changed by the map update so they must be recomputed
+    resetSpeedLimitCache();
+
     // If the routing graph should be updated then recompute it
     if (recompute_routing_graph)
     {
@@ -592,6 +596,19 @@ namespace carma_wm
       lanelet::routing::RoutingGraphUPtr map_graph = lanelet::routing::RoutingGraph::build(*semantic_map_, *traffic_rules);
       map_routing_graph_ = std::move(map_graph);
 
+      {
+        std::lock_guard<std::mutex> lock(lane_chain_index_mutex_);
+        lane_chain_index_.reset(); // Lanes will be recomputed for the new graph on next use
+      }
+      {
+        std::lock_guard<std::mutex> lock(conflict_zone_index_mutex_);
+        conflict_zone_index_.reset(); // Conflict zones will be recomputed for the new graph on next use
+      }
+      {
+        std::lock_guard<std::mutex> lock(reachability_index_mutex_);
+        reachability_index_.reset(); // Lengths and cached distances belong to the previous graph
+      }
+
       RCLCPP_INFO_STREAM(rclcpp::get_logger("carma_wm"), "Done building routing graph");
     }
   }
@@ -601,6 +618,19 @@ namespace carma_wm
     RCLCPP_INFO_STREAM(rclcpp::get_logger("carma_wm"), "Setting the routing graph with user or listener provided graph");
 
     map_routing_graph_ = graph;
+
+    {
+      std::lock_guard<std::mutex> lock(lane_chain_index_mutex_);
+      lane_chain_index_.reset(); // Lanes will be recomputed for the new graph on next use
+    }
+    {
+      std::lock_guard<std::mutex> lock(conflict_zone_index_mutex_);
+      conflict_zone_index_.reset(); // Conflict zones will be recomputed for the new graph on next use
+    }
+    {
+      std::lock_guard<std::mutex> lock(reachability_index_mutex_);
+      reachability_index_.reset(); // Lengths and cached distances belong to the previous graph
+    }
   }
 
   size_t CARMAWorldModel::getMapVersion() const
@@ -628,10 +658,20 @@ namespace carma_wm
     route_ = route;
     lanelet::ConstLanelets path_lanelets(route_->shortestPath().begin(), route_->shortestPath().end());
     shortest_path_view_ = lanelet::utils::createConstSubmap(path_lanelets, {});
+
+    route_ordinal_map_.clear();
+    route_ordinal_map_.reserve(path_lanelets.size());
+    for (size_t i = 0; i < path_lanelets.size(); i++)
+    {
+      route_ordinal_map_.emplace(path_lanelets[i].id(), i); // Keep the first occurrence if the path revisits a lanelet
+    }
+    route_lanelets_ = std::move(path_lanelets);
+
     computeDowntrackReferenceLine();
     // NOTE: Setting the route_length_ field here will likely result in the final lanelets final point being used. Call setRouteEndPoint to use the destination point value
     route_length_ = routeTrackPos(route_->getEndPoint().basicPoint2d()).downtrack;  // Cache the route length with
                                                                                    // consideration for endpoint
+    resetSpeedLimitCache();
   }
 
   void CARMAWorldModel::setRouteEndPoint(const lanelet::BasicPoint3d& end_point)
@@ -654,6 +694,44 @@ namespace carma_wm
     route_name_ = route_name;
   }
 
+  bool CARMAWorldModel::isOnRoute(lanelet::Id lanelet_id) const
+  {
+    return route_ordinal_map_.find(lanelet_id) != route_ordinal_map_.end();
+  }
+
+  lanelet::Optional<size_t> CARMAWorldModel::routeIndexOf(lanelet::Id lanelet_id) const
+  {
+    auto it = route_ordinal_map_.find(lanelet_id);
+    if (it == route_ordinal_map_.end())
+    {
+      return boost::none;
+    }
+
+    return it->second;
+  }
+
+  lanelet::Optional<lanelet::ConstLanelet> CARMAWorldModel::nextOnRoute(lanelet::Id lanelet_id) const
+  {
+    auto index = routeIndexOf(lanelet_id);
+    if (!index || index.get() + 1 >= route_lanelets_.size())
+    {
+      return boost::none;
+    }
+
+    return route_lanelets_[index.get() + 1];
+  }
+
+  lanelet::Optional<lanelet::ConstLanelet> CARMAWorldModel::previousOnRoute(lanelet::Id lanelet_id) const
+  {
+    auto index = routeIndexOf(lanelet_id);
+    if (!index || index.get() == 0)
+    {
+      return boost::none;
+    }
+
+    return route_lanelets_[index.get() - 1];
+  }
+
   std::string CARMAWorldModel::getRouteName() const
   {
     return route_name_;
@@ -761,6 +839,24 @@ namespace carma_wm
 
   lanelet::Optional<TrafficRulesConstPtr> CARMAWorldModel::getTrafficRules(const std::string& participant) const
   {
+    std::lock_guard<std::mutex> lock(speed_limit_cache_mutex_);
+    return cachedTrafficRules(*speed_limit_cache_, participant);
+  }
+
+  lanelet::Optional<TrafficRulesConstPtr> CARMAWorldModel::getTrafficRules() const
+  {
+
+    return getTrafficRules(participant_type_);
+  }
+
+  lanelet::Optional<TrafficRulesConstPtr> CARMAWorldModel::cachedTrafficRules(SpeedLimitCache& cache, const std::string& participant) const
+  {
+    auto cached_rules = cache.traffic_rules.find(participant);
+    if (cached_rules != cache.traffic_rules.end())
+    {
+      return cached_rules->second;
+    }
+
     lanelet::Optional<TrafficRulesConstPtr> optional_ptr;
     // Create carma traffic rules object
     try
@@ -778,16 +874,101 @@ namespace carma_wm
     }
     catch (const lanelet::InvalidInputError& e)
     {
-      return optional_ptr;
+      return optional_ptr; // Unsupported participants are not cached so the error is reported on every request
     }
 
+    cache.traffic_rules[participant] = optional_ptr.get();
+
     return optional_ptr;
   }
 
-  lanelet::Optional<TrafficRulesConstPtr> CARMAWorldModel::getTrafficRules() const
+  double CARMAWorldModel::cachedSpeedLimit(SpeedLimitCache& cache, const lanelet::ConstLanelet& lanelet) const
   {
+    auto cached_limit = cache.speed_limits.find(lanelet.id());
+    if (cached_limit != cache.speed_limits.end())
+    {
+      return cached_limit->second;
+    }
 
-    return getTrafficRules(participant_type_);
+    auto traffic_rules = cachedTrafficRules(cache, participant_type_);
+    if (!traffic_rules)
+    {
+      throw std::invalid_argument("Valid traffic rules object could not be built");
+    }
+
+    double speed_limit = (*traffic_rules)->speedLimit(lanelet).speedLimit.value();
+    cache.speed_limits[lanelet.id()] = speed_limit;
+
+    return speed_limit;
+  }
+
+  double CARMAWorldModel::getSpeedLimit(const lanelet::ConstLanelet& lanelet) const
+  {
+    std::lock_guard<std::mutex> lock(speed_limit_cache_mutex_);
+    return cachedSpeedLimit(*speed_limit_cache_, lanelet);
+  }
+
+  std::vector<RouteSpeedLimitSegment> CARMAWorldModel::getRouteSpeedLimitProfile() const
+  {
+    std::lock_guard<std::mutex> lock(speed_limit_cache_mutex_);
+    return speed_limit_cache_->route_profile;
+  }
+
+  lanelet::Optional<double> CARMAWorldModel::getRouteSpeedLimit(double downtrack) const
+  {
+    std::lock_guard<std::mutex> lock(speed_limit_cache_mutex_);
+    const auto& profile = speed_limit_cache_->route_profile;
+
+    if (profile.empty() || downtrack < profile.front().start_downtrack || downtrack > profile.back().end_downtrack)
+    {
+      return boost::none;
+    }
+
+    // Find the last segment which starts at or before the requested downtrack
+    auto segment = std::upper_bound(profile.begin(), profile.end(), downtrack,
+                                    [](double dt, const RouteSpeedLimitSegment& seg) { return dt < seg.start_downtrack; });
+
+    return std::prev(segment)->speed_limit;
+  }
+
+  std::vector<RouteSpeedLimitSegment> CARMAWorldModel::computeRouteSpeedLimitProfile(SpeedLimitCache& cache) const
+  {
+    std::vector<RouteSpeedLimitSegment> profile;
+
+    if (!route_ || !semantic_map_)
+    {
+      return profile;
+    }
+
+    const auto& shortest_path = route_->shortestPath();
+    profile.reserve(shortest_path.size());
+
+    for (const auto& llt : shortest_path)
+    {
+      RouteSpeedLimitSegment segment;
+      segment.lanelet_id = llt.id();
+      segment.start_downtrack = routeTrackPos(llt.centerline2d().front().basicPoint2d()).downtrack;
+      segment.end_downtrack = routeTrackPos(llt.centerline2d().back().basicPoint2d()).downtrack;
+      segment.speed_limit = cachedSpeedLimit(cache, llt);
+      profile.push_back(segment);
+    }
+
+    // Lane changes introduce discontinuities in the route downtrack so keep the profile sorted for lookups
+    std::stable_sort(profile.begin(), profile.end(), [](const RouteSpeedLimitSegment& a, const RouteSpeedLimitSegment& b) {
+      return a.start_downtrack < b.start_downtrack;
+    });
+
+    return profile;
+  }
+
+  void CARMAWorldModel::resetSpeedLimitCache()
+  {
+    // Build the replacement cache before swapping it in so readers see either the old or the new values
+    auto new_cache = std::make_shared<SpeedLimitCache>();
+
+    std::lock_guard<std::mutex> lock(speed_limit_cache_mutex_);
+    new_cache->route_profile = computeRouteSpeedLimitProfile(*new_cache);
+    speed_limit_cache_ = new_cache;
   }
 
   lanelet::Optional<carma_perception_msgs::msg::RoadwayObstacle>
@@ -1134,45 +1315,206 @@ namespace carma_wm
       throw std::invalid_argument("Undefined lane section is requested");
     }
 
-    std::vector<lanelet::ConstLanelet> following_lane = {lanelet};
-    std::stack<lanelet::ConstLanelet> prev_lane_helper;
-    std::vector<lanelet::ConstLanelet> prev_lane;
-    std::vector<lanelet::ConstLanelet> connecting_lanelet = map_routing_graph_->following(lanelet, false);
+    return getLaneChainIndex()->getLane(lanelet, section);
+  }
 
-    // if only interested in following lanelets, as it is the most case
-    while (connecting_lanelet.size() != 0)
+  std::shared_ptr<const LaneChainIndex> CARMAWorldModel::getLaneChainIndex() const
+  {
+    std::lock_guard<std::mutex> lock(lane_chain_index_mutex_);
+
+    if (!lane_chain_index_)
+    {
+      if (!map_routing_graph_)
+      {
+        throw std::invalid_argument("Routing graph is not set");
+      }
+
+      auto index = std::make_shared<LaneChainIndex>();
+      index->build(*map_routing_graph_);
+      lane_chain_index_ = index;
+    }
+
+    return lane_chain_index_;
+  }
+
+  std::shared_ptr<const ConflictZoneIndex> CARMAWorldModel::getConflictZoneIndex() const
+  {
+    std::lock_guard<std::mutex> lock(conflict_zone_index_mutex_);
+
+    if (!conflict_zone_index_)
     {
-      following_lane.push_back(connecting_lanelet[0]);
-      connecting_lanelet = map_routing_graph_->following(connecting_lanelet[0], false);
+      if (!map_routing_graph_)
+      {
+        throw std::invalid_argument("Routing graph is not set");
+      }
+
+      auto index = std::make_shared<ConflictZoneIndex>();
+      index->build(*map_routing_graph_);
+      conflict_zone_index_ = index;
+
+      RCLCPP_DEBUG_STREAM(rclcpp::get_logger("carma_wm"), "Built conflict zone index with " << index->size() << " conflicting pairs");
     }
-    if (section == LANE_AHEAD)
-      return following_lane;
 
-    // if interested in lanelets behind
-    connecting_lanelet = map_routing_graph_->previous(lanelet, false);
-    while (connecting_lanelet.size() != 0)
+    return conflict_zone_index_;
+  }
+
+  std::shared_ptr<const LaneletReachabilityIndex> CARMAWorldModel::getReachabilityIndex() const
+  {
+    std::lock_guard<std::mutex> lock(reachability_index_mutex_);
+
+    if (!reachability_index_)
     {
-      prev_lane_helper.push(connecting_lanelet[0]);
-      connecting_lanelet = map_routing_graph_->previous(connecting_lanelet[0], false);
+      if (!map_routing_graph_)
+      {
+        throw std::invalid_argument("Routing graph is not set");
+      }
+
+      auto index = std::make_shared<LaneletReachabilityIndex>();
+      index->build(*map_routing_graph_);
+      reachability_index_ = index;
     }
 
-    // gather all lanelets with correct start order
-    while (prev_lane_helper.size() != 0)
+    return reachability_index_;
+  }
+
+  lanelet::Optional<double> CARMAWorldModel::getReachableDistance(lanelet::Id from, lanelet::Id to, double max_distance) const
+  {
+    return getReachabilityIndex()->distance(from, to, max_distance);
+  }
+
+  lanelet::Optional<double> CARMAWorldModel::getLongitudinalGap(const lanelet::ConstLanelet& from, double from_downtrack,
+                                                                const lanelet::ConstLanelet& to, double to_downtrack,
+                                                                double max_distance) const
+  {
+    // The lanelet distance is measured from the start of from, so extend the bound by the rear position
+    auto distance = getReachableDistance(from.id(), to.id(), max_distance + std::max(0.0, from_downtrack));
+    if (!distance)
     {
-      prev_lane.push_back(prev_lane_helper.top());
-      prev_lane_helper.pop();
+      return boost::none;
     }
 
-    // if only interested in lane behind
-    if (section == LANE_BEHIND)
+    return distance.get() + to_downtrack - from_downtrack;
+  }
+
+  std::vector<ConflictZone> CARMAWorldModel::getConflictZones(const lanelet::ConstLanelet& lanelet) const
+  {
+    return getConflictZoneIndex()->getConflictZones(lanelet);
+  }
+
+  std::vector<ConflictZone> CARMAWorldModel::getConflictZonesAlongRoute(const lanelet::BasicPoint2d& loc) const
+  {
+    // Check if the map is loaded yet
+    if (!semantic_map_ || semantic_map_->laneletLayer.empty() || !map_routing_graph_)
+    {
+      RCLCPP_ERROR_STREAM(rclcpp::get_logger("carma_wm"), "Map is not set or does not contain lanelets");
+      return {};
+    }
+    // Check if the route was loaded yet
+    if (!route_)
     {
-      prev_lane.push_back(lanelet);
-      return prev_lane;
+      RCLCPP_ERROR_STREAM(rclcpp::get_logger("carma_wm"), "Route has not yet been loaded");
+      return {};
+    }
+
+    auto index = getConflictZoneIndex();
+    double curr_downtrack = routeTrackPos(loc).downtrack;
+
+    std::vector<ConflictZone> route_zones;
+
+    // shortest path is already sorted by distance
+    for (const auto& llt : route_->shortestPath())
+    {
+      const auto& zones = index->getConflictZones(llt);
+      if (zones.empty())
+      {
+        continue;
+      }
+
+      double llt_start_downtrack = routeTrackPos(llt).downtrack;
+
+      for (auto zone : zones)
+      {
+        zone.route_entry_downtrack = llt_start_downtrack + zone.entry_downtrack;
+        zone.route_exit_downtrack = llt_start_downtrack + zone.exit_downtrack;
+
+        if (zone.route_exit_downtrack < curr_downtrack)
+        {
+          continue;
+        }
+
+        route_zones.push_back(zone);
+      }
+    }
+
+    std::sort(route_zones.begin(), route_zones.end(),
+              [](const ConflictZone& a, const ConflictZone& b) { return a.route_entry_downtrack < b.route_entry_downtrack; });
+
+    return route_zones;
+  }
+
+  std::vector<carma_perception_msgs::msg::RoadwayObstacle> CARMAWorldModel::getConflictZoneObjects(const ConflictZone& zone,
+                                                                                                  double time_horizon) const
+  {
+    std::vector<carma_perception_msgs::msg::RoadwayObstacle> zone_objects;
+
+    // Distance from the start of each approach lanelet to the zone entry along that lanelet's lane
+    std::unordered_map<lanelet::Id, double> approach_entry_distance;
+    approach_entry_distance[zone.lanelet.id()] = zone.entry_downtrack;
+    approach_entry_distance[zone.conflicting_lanelet.id()] = zone.conflicting_entry_downtrack;
+
+    if (map_routing_graph_)
+    {
+      for (const auto& pair : { std::make_pair(zone.lanelet, zone.entry_downtrack),
+                                std::make_pair(zone.conflicting_lanelet, zone.conflicting_entry_downtrack) })
+      {
+        for (const auto& prev : map_routing_graph_->previous(pair.first, false))
+        {
+          approach_entry_distance.emplace(prev.id(), lanelet::geometry::length2d(prev) + pair.second);
+        }
+      }
+    }
+
+    for (const auto& obstacle : roadway_objects_)
+    {
+      const auto& object = obstacle.object;
+
+      // Occupying
+      if (boost::geometry::intersects(geometry::objectToMapPolygon(object.pose.pose, object.size), zone.area))
+      {
+        zone_objects.push_back(obstacle);
+        continue;
+      }
+
+      // Predicted to overlap within the horizon
+      rclcpp::Time object_time(object.header.stamp);
+      bool predicted_in_zone = std::any_of(object.predictions.begin(), object.predictions.end(), [&](const auto& prediction) {
+        return (rclcpp::Time(prediction.header.stamp) - object_time).seconds() <= time_horizon &&
+               boost::geometry::intersects(geometry::objectToMapPolygon(prediction.predicted_position, object.size), zone.area);
+      });
+
+      if (predicted_in_zone)
+      {
+        zone_objects.push_back(obstacle);
+        continue;
+      }
+
+      // Approaching along one of the zone lanelets at its current speed
+      auto approach = approach_entry_distance.find(obstacle.lanelet_id);
+      if (approach == approach_entry_distance.end())
+      {
+        continue;
+      }
+
+      double distance_to_entry = approach->second - obstacle.down_track;
+      double speed = std::hypot(object.velocity.twist.linear.x, object.velocity.twist.linear.y);
+
+      if (distance_to_entry >= 0 && distance_to_entry <= speed * time_horizon)
+      {
+        zone_objects.push_back(obstacle);
+      }
     }
 
-    // if interested in full lane
-    prev_lane.insert(prev_lane.end(), following_lane.begin(), following_lane.end());
-    return prev_lane;
+    return zone_objects;
   }
 
   void CARMAWorldModel::setTrafficLightIds(uint32_t id, lanelet::Id lanelet_id)
@@ -1183,11 +1525,13 @@ namespace carma_wm
   void CARMAWorldModel::setConfigSpeedLimit(double config_lim)
   {
     config_speed_limit_ = config_lim;
+    resetSpeedLimitCache();
   }
 
   void CARMAWorldModel::setVehicleParticipationType(const std::string& participant)
   {
     participant_type_ = participant;
+    resetSpeedLimitCache();
   }
 
   std::string CARMAWorldModel::getVehicleParticipationType()
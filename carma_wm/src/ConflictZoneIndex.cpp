@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <carma_wm/ConflictZoneIndex.hpp>
+#include <carma_wm/Geometry.hpp>
+
+namespace carma_wm
+{
+namespace
+{
+using BoostPolygon = boost::geometry::model::polygon<lanelet::BasicPoint2d>;
+
+BoostPolygon toBoostPolygon(const lanelet::ConstLanelet& lanelet)
+{
+  BoostPolygon polygon;
+  auto basic_polygon = lanelet.polygon2d().basicPolygon();
+  polygon.outer().assign(basic_polygon.begin(), basic_polygon.end());
+  boost::geometry::correct(polygon);  // Fix orientation and closure
+  return polygon;
+}
+
+// Range of downtracks covered by the area along the lanelet centerline, clamped to the lanelet
+std::pair<double, double> downtrackExtent(const lanelet::ConstLanelet& lanelet, const lanelet::BasicPolygon2d& area)
+{
+  double entry = std::numeric_limits<double>::max();
+  double exit = std::numeric_limits<double>::lowest();
+
+  for (const auto& p : area)
+  {
+    double downtrack = geometry::trackPos(lanelet, p).downtrack;
+    entry = std::min(entry, downtrack);
+    exit = std::max(exit, downtrack);
+  }
+
+  double length = lanelet::geometry::length2d(lanelet);
+  return std::make_pair(std::max(0.0, entry), std::min(length, exit));
+}
+
+}  // namespace
+
+lanelet::Optional<ConflictZone> ConflictZoneIndex::computeZone(const lanelet::ConstLanelet& lanelet,
+                                                               const lanelet::ConstLanelet& conflicting_lanelet)
+{
+  std::vector<BoostPolygon> overlap;
+  boost::geometry::intersection(toBoostPolygon(lanelet), toBoostPolygon(conflicting_lanelet), overlap);
+
+  double overlap_area = 0;
+  BoostPolygon all_points;
+  for (const auto& piece : overlap)
+  {
+    overlap_area += boost::geometry::area(piece);
+    all_points.outer().insert(all_points.outer().end(), piece.outer().begin(), piece.outer().end());
+  }
+
+  if (overlap_area < MIN_ZONE_AREA)
+  {
+    return boost::none;
+  }
+
+  // Overlaps can split into several pieces along curved lanelets. The hull keeps one zone per pair
+  BoostPolygon hull;
+  boost::geometry::convex_hull(all_points, hull);
+
+  ConflictZone zone;
+  zone.lanelet = lanelet;
+  zone.conflicting_lanelet = conflicting_lanelet;
+  zone.area.assign(hull.outer().begin(), hull.outer().end() - 1);  // Boost rings repeat the first point at the end
+
+  std::tie(zone.entry_downtrack, zone.exit_downtrack) = downtrackExtent(lanelet, zone.area);
+  std::tie(zone.conflicting_entry_downtrack, zone.conflicting_exit_downtrack) =
+      downtrackExtent(conflicting_lanelet, zone.area);
+
+  return zone;
+}
+
+void ConflictZoneIndex::build(const lanelet::routing::RoutingGraph& graph)
+{
+  zones_.clear();
+  pair_count_ = 0;
+
+  auto passable_map = graph.passableSubmap();
+
+  for (const auto& llt : passable_map->laneletLayer)
+  {
+    for (const auto& conflicting : graph.conflicting(llt))
+    {
+      auto other = conflicting.lanelet();
+
+      // Each pair is reported from both sides. Compute it once from the lanelet with the smaller id
+      if (!other || other->id() <= llt.id())
+      {
+        continue;
+      }
+
+      auto zone = computeZone(llt, *other);
+      if (!zone)
+      {
+        continue;
+      }
+
+      ConflictZone mirrored;
+      mirrored.lanelet = zone->conflicting_lanelet;
+      mirrored.conflicting_lanelet = zone->lanelet;
+      mirrored.area = zone->area;
+      mirrored.entry_downtrack = zone->conflicting_entry_downtrack;
+      mirrored.exit_downtrack = zone->conflicting_exit_downtrack;
+      mirrored.conflicting_entry_downtrack = zone->entry_downtrack;
+      mirrored.conflicting_exit_downtrack = zone->exit_downtrack;
+
+      zones_[llt.id()].push_back(zone.get());
+      zones_[other->id()].push_back(mirrored);
+      pair_count_++;
+    }
+  }
+
+  for (auto& id_zones : zones_)
+  {
+    std::sort(id_zones.second.begin(), id_zones.second.end(),
+              [](const ConflictZone& a, const ConflictZone& b) { return a.entry_downtrack < b.entry_downtrack; });
+  }
+}
+
+const std::vector<ConflictZone>& ConflictZoneIndex::getConflictZones(const lanelet::ConstLanelet& lanelet) const
+{
+  static const std::vector<ConflictZone> no_zones;
+
+  auto it = zones_.find(lanelet.id());
+  if (it == zones_.end())
+  {
+    return no_zones;
+  }
+
+  return it->second;
+}
+
+size_t ConflictZoneIndex::size() const
+{
+  return pair_count_;
+}
+
+}  // namespace carma_wm
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <algorithm>
+#include <carma_wm/LaneChainIndex.hpp>
+
+namespace carma_wm
+{
+void LaneChainIndex::build(const lanelet::routing::RoutingGraph& graph)
+{
+  chains_.clear();
+  id_index_map_.clear();
+  chain_next_.clear();
+  chain_prev_.clear();
+
+  auto passable_map = graph.passableSubmap();
+
+  // Cache the first following and previous lanelet of each lanelet as these define the lane
+  std::unordered_map<lanelet::Id, lanelet::ConstLanelet> first_following;
+  std::unordered_map<lanelet::Id, lanelet::ConstLanelet> first_previous;
+
+  for (const auto& llt : passable_map->laneletLayer)
+  {
+    auto following = graph.following(llt, false);
+    if (!following.empty())
+    {
+      first_following.emplace(llt.id(), following.front());
+    }
+    auto previous = graph.previous(llt, false);
+    if (!previous.empty())
+    {
+      first_previous.emplace(llt.id(), previous.front());
+    }
+  }
+
+  // Two lanelets are in the same chain if each is the other's first neighbor in the respective direction
+  auto continues_into = [&](lanelet::Id from, lanelet::Id to) {
+    auto prev_it = first_previous.find(to);
+    auto next_it = first_following.find(from);
+    return prev_it != first_previous.end() && next_it != first_following.end() && prev_it->second.id() == from &&
+           next_it->second.id() == to;
+  };
+
+  auto build_chain = [&](const lanelet::ConstLanelet& head) {
+    size_t chain_i = chains_.size();
+    chains_.emplace_back();
+    auto& chain = chains_.back();
+
+    lanelet::ConstLanelet current = head;
+    while (true)
+    {
+      id_index_map_[current.id()] = ChainPosition{ chain_i, chain.size() };
+      chain.push_back(current);
+
+      auto next_it = first_following.find(current.id());
+      if (next_it == first_following.end() || !continues_into(current.id(), next_it->second.id()) ||
+          id_index_map_.find(next_it->second.id()) != id_index_map_.end())  // Closed loop
+      {
+        break;
+      }
+      current = next_it->second;
+    }
+  };
+
+  // Start chains at every lanelet which does not continue an earlier lanelet
+  for (const auto& llt : passable_map->laneletLayer)
+  {
+    auto prev_it = first_previous.find(llt.id());
+    if (prev_it == first_previous.end() || !continues_into(prev_it->second.id(), llt.id()))
+    {
+      build_chain(llt);
+    }
+  }
+
+  // Any lanelet not yet assigned belongs to a closed loop which has no natural start
+  for (const auto& llt : passable_map->laneletLayer)
+  {
+    if (id_index_map_.find(llt.id()) == id_index_map_.end())
+    {
+      build_chain(llt);
+    }
+  }
+
+  // Link the ends of each chain to where the lane continues
+  chain_next_.resize(chains_.size());
+  chain_prev_.resize(chains_.size());
+
+  for (size_t i = 0; i < chains_.size(); i++)
+  {
+    auto next_it = first_following.find(chains_[i].back().id());
+    if (next_it != first_following.end())
+    {
+      auto pos = id_index_map_.find(next_it->second.id());
+      if (pos != id_index_map_.end())
+      {
+        chain_next_[i] = pos->second;
+      }
+    }
+
+    auto prev_it = first_previous.find(chains_[i].front().id());
+    if (prev_it != first_previous.end())
+    {
+      auto pos = id_index_map_.find(prev_it->second.id());
+      if (pos != id_index_map_.end())
+      {
+        chain_prev_[i] = pos->second;
+      }
+    }
+  }
+}
+
+void LaneChainIndex::appendAhead(ChainPosition pos, std::vector<lanelet::ConstLanelet>& output) const
+{
+  std::vector<size_t> visited_chains;  // Guards against lanes which loop back on themselves
+
+  lanelet::Optional<ChainPosition> current = pos;
+  while (current)
+  {
+    if (std::find(visited_chains.begin(), visited_chains.end(), current->chain) != visited_chains.end())
+    {
+      break;
+    }
+    visited_chains.push_back(current->chain);
+
+    const auto& chain = chains_[current->chain];
+    output.insert(output.end(), chain.begin() + current->offset, chain.end());
+
+    current = chain_next_[current->chain];
+  }
+}
+
+std::vector<lanelet::ConstLanelet> LaneChainIndex::collectBehind(ChainPosition pos) const
+{
+  // Slices are collected from the provided position backwards as pairs of chain index and exclusive end offset
+  std::vector<std::pair<size_t, size_t>> slices;
+  slices.emplace_back(pos.chain, pos.offset);
+
+  lanelet::Optional<ChainPosition> current = chain_prev_[pos.chain];
+  while (current)
+  {
+    bool visited = std::any_of(slices.begin(), slices.end(),
+                               [&](const std::pair<size_t, size_t>& slice) { return slice.first == current->chain; });
+    if (visited)
+    {
+      break;
+    }
+    slices.emplace_back(current->chain, current->offset + 1);
+
+    current = chain_prev_[current->chain];
+  }
+
+  std::vector<lanelet::ConstLanelet> output;
+  for (auto slice = slices.rbegin(); slice != slices.rend(); slice++)
+  {
+    const auto& chain = chains_[slice->first];
+    output.insert(output.end(), chain.begin(), chain.begin() + slice->second);
+  }
+
+  return output;
+}
+
+std::vector<lanelet::ConstLanelet> LaneChainIndex::getLane(const lanelet::ConstLanelet& lanelet,
+                                                           const LaneSection& section) const
+{
+  // Check if the lane section input is correct
+  if (section != LANE_FULL && section != LANE_BEHIND && section != LANE_AHEAD)
+  {
+    throw std::invalid_argument("Undefined lane section is requested");
+  }
+
+  auto pos_it = id_index_map_.find(lanelet.id());
+  if (pos_it == id_index_map_.end())
+  {
+    // Lanelet is not part of the routing graph so it has no connections
+    return { lanelet };
+  }
+
+  const ChainPosition& pos = pos_it->second;
+
+  if (section == LANE_AHEAD)
+  {
+    std::vector<lanelet::ConstLanelet> output;
+    appendAhead(pos, output);
+    return output;
+  }
+
+  std::vector<lanelet::ConstLanelet> output = collectBehind(pos);
+
+  if (section == LANE_BEHIND)
+  {
+    output.push_back(chains_[pos.chain][pos.offset]);
+    return output;
+  }
+
+  appendAhead(pos, output);
+  return output;
+}
+
+size_t LaneChainIndex::size() const
+{
+  return chains_.size();
+}
+
+std::pair<size_t, size_t> LaneChainIndex::getIndexFromId(const lanelet::Id& id) const
+{
+  const auto& pos = id_index_map_.at(id);
+  return std::make_pair(pos.chain, pos.offset);
+}
+
+}  // namespace carma_wm
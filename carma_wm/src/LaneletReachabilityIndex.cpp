@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <functional>
+#include <limits>
+#include <queue>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <carma_wm/LaneletReachabilityIndex.hpp>
+
+namespace carma_wm
+{
+void LaneletReachabilityIndex::build(const lanelet::routing::RoutingGraph& graph)
+{
+  id_index_map_.clear();
+  lengths_.clear();
+  following_.clear();
+  neighbors_.clear();
+
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    cache_.clear();
+  }
+
+  auto passable_map = graph.passableSubmap();
+
+  for (const auto& llt : passable_map->laneletLayer)
+  {
+    id_index_map_.emplace(llt.id(), lengths_.size());
+    lengths_.push_back(lanelet::geometry::length2d(llt));
+  }
+
+  following_.resize(lengths_.size());
+  neighbors_.resize(lengths_.size());
+
+  auto add_edge = [this](std::vector<size_t>& edges, const lanelet::ConstLanelet& target) {
+    auto it = id_index_map_.find(target.id());
+    if (it != id_index_map_.end())
+    {
+      edges.push_back(it->second);
+    }
+  };
+
+  for (const auto& llt : passable_map->laneletLayer)
+  {
+    size_t i = id_index_map_.at(llt.id());
+
+    for (const auto& following : graph.following(llt, false))
+    {
+      add_edge(following_[i], following);
+    }
+
+    if (auto left = graph.left(llt))
+    {
+      add_edge(neighbors_[i], *left);
+    }
+
+    if (auto right = graph.right(llt))
+    {
+      add_edge(neighbors_[i], *right);
+    }
+  }
+}
+
+lanelet::Optional<double> LaneletReachabilityIndex::search(size_t from, size_t to, double max_distance) const
+{
+  using QueueEntry = std::pair<double, size_t>;  // Distance to node start, node
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> open;
+  std::unordered_map<size_t, double> best;
+
+  open.emplace(0.0, from);
+  best[from] = 0.0;
+
+  auto relax = [&](size_t node, double dist) {
+    if (dist > max_distance)
+    {
+      return;
+    }
+
+    auto it = best.find(node);
+    if (it == best.end() || dist < it->second)
+    {
+      best[node] = dist;
+      open.emplace(dist, node);
+    }
+  };
+
+  while (!open.empty())
+  {
+    auto [dist, node] = open.top();
+    open.pop();
+
+    if (node == to)
+    {
+      return dist;
+    }
+
+    if (dist > best[node])  // Stale entry
+    {
+      continue;
+    }
+
+    for (size_t next : following_[node])
+    {
+      relax(next, dist + lengths_[node]);
+    }
+
+    for (size_t neighbor : neighbors_[node])
+    {
+      relax(neighbor, dist);
+    }
+  }
+
+  return boost::none;
+}
+
+lanelet::Optional<double> LaneletReachabilityIndex::distance(lanelet::Id from, lanelet::Id to, double max_distance) const
+{
+  auto from_it = id_index_map_.find(from);
+  auto to_it = id_index_map_.find(to);
+
+  if (from_it == id_index_map_.end() || to_it == id_index_map_.end() || max_distance < 0)
+  {
+    return boost::none;
+  }
+
+  auto key = std::make_pair(from, to);
+
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+
+    auto cached = cache_.find(key);
+    if (cached != cache_.end())
+    {
+      const auto& entry = cached->second;
+
+      if (entry.distance)
+      {
+        return entry.distance.get() <= max_distance ? entry.distance : boost::none;
+      }
+
+      if (max_distance <= entry.searched_distance)
+      {
+        return boost::none;
+      }
+    }
+  }
+
+  auto result = search(from_it->second, to_it->second, max_distance);
+
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+
+  if (cache_.size() >= MAX_CACHE_SIZE)
+  {
+    cache_.clear();
+  }
+
+  cache_[key] = CacheEntry{ result, max_distance };
+
+  return result;
+}
+
+size_t LaneletReachabilityIndex::size() const
+{
+  return lengths_.size();
+}
+
+size_t LaneletReachabilityIndex::cacheSize() const
+{
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return cache_.size();
+}
+
+}  // namespace carma_wm
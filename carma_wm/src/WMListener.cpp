@@ -53,7 +53,14 @@ WMListener::WMListener(
     use_sim_time_param_value = node_params_->declare_parameter("use_sim_time", rclcpp::ParameterValue (false));
   }
 
+  rclcpp::Parameter use_corridor_map_param("use_corridor_map");
+  if(!node_params_->get_parameter("use_corridor_map", use_corridor_map_param)){
+    rclcpp::ParameterValue use_corridor_map_param_value;
+    use_corridor_map_param_value = node_params_->declare_parameter("use_corridor_map", rclcpp::ParameterValue(true));
+  }
+
   // Get params
+  use_corridor_map_param = node_params_->get_parameter("use_corridor_map");
   config_speed_limit_param = node_params_->get_parameter("config_speed_limit");
   participant_param = node_params_->get_parameter("vehicle_participant_type");
   use_sim_time_param = node_params_->get_parameter("use_sim_time");
@@ -69,7 +76,6 @@ WMListener::WMListener(
   worker_->isUsingSimTime(use_sim_time_param.as_bool());
 
   rclcpp::SubscriptionOptions map_update_options;
-  rclcpp::SubscriptionOptions map_options;
   rclcpp::SubscriptionOptions route_options;
   rclcpp::SubscriptionOptions roadway_objects_options;
   rclcpp::SubscriptionOptions traffic_spat_options;
@@ -82,7 +88,7 @@ WMListener::WMListener(
 
     map_update_options.callback_group = node_base_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
 
-    map_options.callback_group = node_base_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    map_options_.callback_group = node_base_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
 
     route_options.callback_group = node_base_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
 
@@ -145,7 +151,32 @@ WMListener::WMListener(
                   }
                   , map_update_options);
 
-  map_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable; // Disable intra-process comms for the semantic map subscriber
+  map_options_.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable; // Disable intra-process comms for the semantic map subscriber
+
+  subscribeToFullMap();
+
+  if (use_corridor_map_param.as_bool())
+  {
+    auto corridor_map_sub_qos = rclcpp::QoS(rclcpp::KeepLast(2));
+    corridor_map_sub_qos.transient_local();
+
+    // Corridor maps share the callback group of the full map so the two are never applied concurrently
+    corridor_map_sub_ = rclcpp::create_subscription<autoware_lanelet2_msgs::msg::MapBin>(node_topics_, "semantic_map_corridor", corridor_map_sub_qos,
+                    [this](const autoware_lanelet2_msgs::msg::MapBin::SharedPtr msg)
+                    {
+                      this->corridorMapCallback(msg);
+                    }
+                    , map_options_);
+  }
+}
+
+void WMListener::subscribeToFullMap()
+{
+  if (map_sub_)
+  {
+    return;
+  }
+
   auto map_sub_qos = rclcpp::QoS(rclcpp::KeepLast(2)); // Set the queue size for the semantic map subscriber
   map_sub_qos.transient_local();  // If it is possible that this node is a late-joiner to its topic, it must be set to transient_local to receive earlier messages that were missed.
                                   // NOTE: The publisher's QoS must be set to transisent_local() as well for earlier messages to be resent to this later-joiner.
@@ -156,7 +187,22 @@ WMListener::WMListener(
                   {
                     this->worker_->mapCallback(msg);
                   }
-                  , map_options);
+                  , map_options_);
+}
+
+void WMListener::corridorMapCallback(autoware_lanelet2_msgs::msg::MapBin::SharedPtr map_msg)
+{
+  // Applying the corridor re-applies recent map updates, so it must not run concurrently with mapUpdateCallback
+  const std::lock_guard<std::mutex> lock(mw_mutex_);
+
+  worker_->corridorMapCallback(map_msg);
+
+  if (worker_->isUsingCorridorMap() && map_sub_)
+  {
+    // The corridor replaces the full map until the next map version, which is signalled by the map updates
+    RCLCPP_INFO_STREAM(node_logging_->get_logger(), "WMListener: Corridor map in use. Unsubscribing from the full map");
+    map_sub_.reset();
+  }
 }
 
 WMListener::~WMListener() {}
@@ -185,6 +231,13 @@ void WMListener::mapUpdateCallback(autoware_lanelet2_msgs::msg::MapBin::SharedPt
 
   RCLCPP_INFO_STREAM(node_logging_->get_logger(), "New Map Update Received. SeqNum: " << geofence_msg->seq_id);
 
+  if (!map_sub_ && geofence_msg->map_version > worker_->getWorldModel()->getMapVersion())
+  {
+    // A new base map was loaded. Receive it in full until a corridor for the new version arrives
+    RCLCPP_INFO_STREAM(node_logging_->get_logger(), "WMListener: New map version " << geofence_msg->map_version << ". Resubscribing to the full map");
+    subscribeToFullMap();
+  }
+
   worker_->mapUpdateCallback(geofence_msg);
 }
 
@@ -211,6 +264,47 @@ std::unique_lock<std::mutex> WMListener::getLock(bool pre_locked)
   return lock;
 }
 
+void WMListener::enableRouteStateUpdates(double max_age)
+{
+  const std::lock_guard<std::mutex> lock(mw_mutex_);
+
+  worker_->setRouteStateMaxAge(max_age);
+
+  if (route_state_sub_)
+  {
+    return;
+  }
+
+  RCLCPP_DEBUG_STREAM(node_logging_->get_logger(), "WMListener: Enabling route state updates");
+
+  rclcpp::SubscriptionOptions route_state_options;
+
+  if(multi_threaded_)
+  {
+    route_state_options.callback_group = node_base_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  }
+
+  route_state_sub_ = rclcpp::create_subscription<carma_planning_msgs::msg::RouteState>(node_topics_, "route_state", 1,
+                                  [this](const carma_planning_msgs::msg::RouteState::SharedPtr msg)
+                                  {
+                                    const std::lock_guard<std::mutex> lock(mw_mutex_);
+                                    this->worker_->routeStateCallback(msg);
+                                  }
+                                  , route_state_options);
+}
+
+lanelet::Optional<EgoTrackState> WMListener::getCachedEgoTrackState(const rclcpp::Time& now)
+{
+  const std::lock_guard<std::mutex> lock(mw_mutex_);
+  return worker_->getCachedEgoTrackState(now.seconds());
+}
+
+EgoTrackState WMListener::getEgoTrackState(const lanelet::BasicPoint2d& ego_position, const rclcpp::Time& now)
+{
+  const std::lock_guard<std::mutex> lock(mw_mutex_);
+  return worker_->getEgoTrackState(ego_position, now.seconds());
+}
+
 void WMListener::setConfigSpeedLimit(double config_lim) const
 {
   worker_->setConfigSpeedLimit(config_lim);
@@ -20,6 +20,7 @@
 #include <lanelet2_extension/regulatory_elements/CarmaTrafficSignal.h>
 #include <lanelet2_extension/regulatory_elements/SignalizedIntersection.h>
 #include <lanelet2_routing/internal/Graph.h>
+#include <carma_wm/Geometry.hpp>
 #include "WMListenerWorker.hpp"
 
 namespace carma_wm
@@ -54,6 +55,60 @@ WorldModelConstPtr WMListenerWorker::getWorldModel() const
 
 
 void WMListenerWorker::mapCallback(const autoware_lanelet2_msgs::msg::MapBin::SharedPtr map_msg)
+{
+  if (using_corridor_map_ && map_msg->map_version <= current_map_version_) {
+    RCLCPP_DEBUG_STREAM(rclcpp::get_logger("carma_wm::WMListenerWorker"), "Ignoring full map as a corridor map for the same version is in use. Version: " << map_msg->map_version);
+    return;
+  }
+
+  using_corridor_map_ = false;
+  applied_updates_.clear();
+
+  applyMap(map_msg);
+}
+
+void WMListenerWorker::corridorMapCallback(const autoware_lanelet2_msgs::msg::MapBin::SharedPtr map_msg)
+{
+  if (route_node_flag_) { // The route node plans over the whole map so it always keeps the full map
+    return;
+  }
+
+  if (map_msg->map_version < current_map_version_) {
+    RCLCPP_WARN_STREAM(rclcpp::get_logger("carma_wm::WMListenerWorker"), "Dropping corridor map for an older map version. Received: " << map_msg->map_version << " current: " << current_map_version_);
+    return;
+  }
+
+  RCLCPP_INFO_STREAM(rclcpp::get_logger("carma_wm::WMListenerWorker"), "Applying corridor map. Version: " << map_msg->map_version << " includes updates before seq: " << map_msg->seq_id);
+
+  using_corridor_map_ = true;
+
+  // The corridor already contains every map update with a lower sequence number
+  most_recent_update_msg_seq_ = static_cast<long>(map_msg->seq_id) - 1;
+
+  bool has_delayed_route = !!delayed_route_msg_; // A delayed route is applied by applyMap
+
+  applyMap(map_msg);
+
+  // Updates which were applied to the previous map after this corridor was built would otherwise be lost
+  auto updates_to_reapply = std::move(applied_updates_);
+  applied_updates_.clear();
+  for (const auto& update : updates_to_reapply)
+  {
+    if (update->map_version != current_map_version_ || update->seq_id < map_msg->seq_id) {
+      continue;
+    }
+    auto reapplied = std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(*update);
+    reapplied->invalidates_route = false; // Already handled when the update was first applied
+    mapUpdateCallback(reapplied);
+  }
+
+  // The current route still refers to lanelets of the replaced map so rebuild it against the new one
+  if (!has_delayed_route && last_route_msg_ && last_route_msg_.get().map_version == current_map_version_) {
+    routeCallback(std::make_shared<carma_planning_msgs::msg::Route>(last_route_msg_.get()));
+  }
+}
+
+void WMListenerWorker::applyMap(const autoware_lanelet2_msgs::msg::MapBin::SharedPtr map_msg)
 {
   current_map_version_ = map_msg->map_version;
 
@@ -111,6 +166,11 @@ bool WMListenerWorker::checkIfReRoutingNeeded() const
   return rerouting_flag_;
 }
 
+bool WMListenerWorker::isUsingCorridorMap() const
+{
+  return using_corridor_map_;
+}
+
 void WMListenerWorker::enableUpdatesWithoutRoute()
 {
   route_node_flag_=true;
@@ -187,6 +247,13 @@ void WMListenerWorker::mapUpdateCallback(autoware_lanelet2_msgs::msg::MapBin::Sh
 
   most_recent_update_msg_seq_ = geofence_msg->seq_id; // Update current sequence count
 
+  if (!route_node_flag_) { // Kept so updates can be reapplied on top of a corridor map built before they were sent
+    applied_updates_.emplace_back(geofence_msg);
+    if (applied_updates_.size() > MAX_APPLIED_UPDATES) {
+      applied_updates_.pop_front();
+    }
+  }
+
   auto gf_ptr = std::shared_ptr<carma_wm::TrafficControl>(new carma_wm::TrafficControl);
 
   // convert ros msg to geofence object
@@ -239,6 +306,9 @@ void WMListenerWorker::mapUpdateCallback(autoware_lanelet2_msgs::msg::MapBin::Sh
   RCLCPP_DEBUG_STREAM(rclcpp::get_logger("carma_wm::WMListenerWorker"), "Geofence id" << gf_ptr->id_ << " requests removal of size: " << gf_ptr->remove_list_.size());
   for (auto const &[lanelet_id, lanelet_to_remove] : gf_ptr->remove_list_)
   {
+    if (using_corridor_map_ && !world_model_->getMutableMap()->laneletLayer.exists(lanelet_id)) {
+      continue; // Lanelet is outside the corridor
+    }
     auto parent_llt = world_model_->getMutableMap()->laneletLayer.get(lanelet_id);
     // we can only check by id, if the element is there
     // this is only for speed optimization, as world model here should blindly accept the map update received
@@ -258,6 +328,9 @@ void WMListenerWorker::mapUpdateCallback(autoware_lanelet2_msgs::msg::MapBin::Sh
   // we should extract general regem to specific type of regem the geofence specifies
   for (auto const &[lanelet_id, lanelet_to_update]: gf_ptr->update_list_)
   {
+    if (using_corridor_map_ && !world_model_->getMutableMap()->laneletLayer.exists(lanelet_id)) {
+      continue; // Lanelet is outside the corridor
+    }
 
     auto parent_llt = world_model_->getMutableMap()->laneletLayer.get(lanelet_id);
 
@@ -279,12 +352,16 @@ void WMListenerWorker::mapUpdateCallback(autoware_lanelet2_msgs::msg::MapBin::Sh
     }
   }
 
+  // The provided graph covers the full map so it cannot be applied to a corridor map. Recompute it locally instead.
+  bool use_provided_graph = geofence_msg->has_routing_graph && !using_corridor_map_;
+  bool recompute_graph = using_corridor_map_ ? (recompute_route_flag_ || geofence_msg->has_routing_graph) : recompute_route_flag_ && !geofence_msg->has_routing_graph;
+
   // set the Map to trigger a new route graph construction if rerouting was required by the updates and a new graph was not provided
-  world_model_->setMap(world_model_->getMutableMap(), current_map_version_, recompute_route_flag_ && !geofence_msg->has_routing_graph );
+  world_model_->setMap(world_model_->getMutableMap(), current_map_version_, recompute_graph);
 
   // If a new graph was provided then set that graph
   // recompute_route_flag_ not checked here to support the case of the first map or map version changing
-  if (geofence_msg->has_routing_graph) {
+  if (use_provided_graph) {
 
     LaneletRoutingGraphPtr graph = routingGraphFromMsg(geofence_msg->routing_graph, world_model_->getMutableMap());
 
@@ -576,6 +653,80 @@ void WMListenerWorker::roadwayObjectListCallback(const carma_perception_msgs::ms
   world_model_->setRoadwayObjects(msg->roadway_obstacles);
 }
 
+void WMListenerWorker::routeStateCallback(const carma_planning_msgs::msg::RouteState::SharedPtr route_state_msg)
+{
+  route_state_ = *route_state_msg;
+}
+
+void WMListenerWorker::setRouteStateMaxAge(double max_age)
+{
+  route_state_max_age_ = max_age;
+}
+
+lanelet::Optional<EgoTrackState> WMListenerWorker::getCachedEgoTrackState(double now) const
+{
+  if (!route_state_)
+  {
+    return boost::none;
+  }
+
+  const auto& msg = route_state_.get();
+
+  double stamp = rclcpp::Time(msg.header.stamp).seconds();
+  if (std::fabs(now - stamp) > route_state_max_age_)
+  {
+    RCLCPP_DEBUG_STREAM(rclcpp::get_logger("carma_wm::WMListenerWorker"), "Cached route state is stale. Age: " << now - stamp);
+    return boost::none;
+  }
+
+  // Route state values are only updated while following and are relative to the route they were computed for
+  if (msg.state != ROUTE_STATE_FOLLOWING || msg.route_id != world_model_->getRouteName() || msg.lanelet_id == lanelet::InvalId)
+  {
+    return boost::none;
+  }
+
+  EgoTrackState state;
+  state.stamp = stamp;
+  state.route_track_pos = TrackPos(msg.down_track, msg.cross_track);
+  state.lanelet_id = msg.lanelet_id;
+  state.lanelet_downtrack = msg.lanelet_downtrack;
+  state.speed_limit = msg.speed_limit;
+  state.from_route_state = true;
+
+  return state;
+}
+
+EgoTrackState WMListenerWorker::getEgoTrackState(const lanelet::BasicPoint2d& ego_position, double now) const
+{
+  auto cached_state = getCachedEgoTrackState(now);
+  if (cached_state)
+  {
+    return cached_state.get();
+  }
+
+  EgoTrackState state;
+  state.stamp = now;
+  state.route_track_pos = world_model_->routeTrackPos(ego_position);
+
+  // Prefer a lanelet on the route if the position overlaps multiple lanelets
+  auto llts = world_model_->getLaneletsFromPoint(ego_position, 10);
+  auto route = world_model_->getRoute();
+  auto route_llt = std::find_if(llts.begin(), llts.end(), [&](const lanelet::ConstLanelet& llt) { return route->contains(llt); });
+  if (route_llt == llts.end())
+  {
+    route_llt = llts.begin();
+  }
+
+  if (route_llt != llts.end())
+  {
+    state.lanelet_id = route_llt->id();
+    state.lanelet_downtrack = geometry::trackPos(*route_llt, ego_position).downtrack;
+    state.speed_limit = world_model_->getSpeedLimit(*route_llt);
+  }
+
+  return state;
+}
+
 void WMListenerWorker::ros1ClockCallback(const rosgraph_msgs::msg::Clock::SharedPtr clock_msg)
 {
   world_model_->setRos1Clock(rclcpp::Time(clock_msg->clock));
@@ -656,6 +807,17 @@ void WMListenerWorker::routeCallback(const carma_planning_msgs::msg::Route::Shar
   else {
     rerouting_flag_ = false; // Reset flag since no applied queued map updates invalidated the route for the route node
 
+    if (using_corridor_map_) {
+      for (auto id : route_msg->shortest_path_lanelet_ids)
+      {
+        if (!world_model_->getMap()->laneletLayer.exists(id)) {
+          RCLCPP_INFO_STREAM(rclcpp::get_logger("carma_wm::WMListenerWorker"), "Route leaves the current corridor map at lanelet: " << id << ". Delaying application until the expanded corridor is received");
+          delayed_route_msg_ = *route_msg;
+          return;
+        }
+      }
+    }
+
     auto path = lanelet::ConstLanelets();
     for(auto id : route_msg->shortest_path_lanelet_ids)
     {
@@ -669,10 +831,13 @@ void WMListenerWorker::routeCallback(const carma_planning_msgs::msg::Route::Shar
       RCLCPP_DEBUG_STREAM(rclcpp::get_logger("carma_wm::WMListenerWorker"), "Setting route in world model");
       auto ptr = std::make_shared<lanelet::routing::Route>(std::move(route_opt.get()));
       world_model_->setRoute(ptr);
+      route_state_ = boost::none; // Cached route state downtracks are relative to the previous route
     }
 
     world_model_->setRouteEndPoint({route_msg->end_point.x,route_msg->end_point.y,route_msg->end_point.z});
     world_model_->setRouteName(route_msg->route_name);
+    last_route_msg_ = *route_msg;
+    delayed_route_msg_ = boost::none;
 
     // Call route_callback_
     if (route_callback_)
@@ -17,10 +17,13 @@
  */
 #include <autoware_lanelet2_msgs/msg/map_bin.hpp>
 #include <carma_planning_msgs/msg/route.hpp>
+#include <carma_planning_msgs/msg/route_state.hpp>
 #include <carma_v2x_msgs/msg/spat.hpp>
 #include <carma_wm/CARMAWorldModel.hpp>
 #include <carma_wm/TrafficControl.hpp>
+#include <carma_wm/EgoTrackState.hpp>
 #include <queue>
+#include <deque>
 #include <carma_wm/SignalizedIntersectionManager.hpp>
 #include <utility>
 #include <rosgraph_msgs/msg/clock.hpp>
@@ -51,6 +54,15 @@ public:
    */
   void mapCallback(const autoware_lanelet2_msgs::msg::MapBin::SharedPtr map_msg);
 
+  /*!
+   * \brief Callback for corridor map messages. Replaces the underlying map with the corridor around the active route.
+   *        Once a corridor map is in use, full maps of the same version are ignored and map updates to lanelets
+   *        outside the corridor are skipped. Ignored if this is the route node.
+   *
+   * \param map_msg The corridor map. The seq_id field holds the number of map updates already applied to it.
+   */
+  void corridorMapCallback(const autoware_lanelet2_msgs::msg::MapBin::SharedPtr map_msg);
+
   /*!
    * \brief Callback for new map update messages (geofence). Updates the underlying map
    *
@@ -63,6 +75,41 @@ public:
    */
   void routeCallback(const carma_planning_msgs::msg::Route::SharedPtr route_msg);
 
+  /*!
+   * \brief Callback for route state messages published by the route node. Caches the ego track state they contain.
+   */
+  void routeStateCallback(const carma_planning_msgs::msg::RouteState::SharedPtr route_state_msg);
+
+  /*!
+   * \brief Set the maximum age of a cached route state before it is considered stale
+   *
+   * \param max_age The maximum age in seconds
+   */
+  void setRouteStateMaxAge(double max_age);
+
+  /*!
+   * \brief Returns the ego track state from the most recent route state message if it is still valid
+   *
+   * \param now The current time in seconds
+   *
+   * \return The cached ego track state. boost::none if no route state was received, it is older than the max age,
+   *         the route node is not following a route, or it was computed for a different route than the one in the world model
+   */
+  lanelet::Optional<EgoTrackState> getCachedEgoTrackState(double now) const;
+
+  /*!
+   * \brief Returns the ego track state from the most recent route state message if valid.
+   *        Otherwise the state is computed locally from the provided position.
+   *
+   * \param ego_position The position to compute the state from if the cached state cannot be used
+   * \param now The current time in seconds
+   *
+   * \throw std::invalid_argument if the state must be computed locally and the route is not yet loaded
+   *
+   * \return The ego track state
+   */
+  EgoTrackState getEgoTrackState(const lanelet::BasicPoint2d& ego_position, double now) const;
+
   /*!
    * \brief Callback for ROS1 clock message (used in Simulation runs)
    */
@@ -125,6 +172,12 @@ public:
    *
    */
   bool checkIfReRoutingNeeded() const;
+
+  /**
+   *  \brief Returns true if the current map is a corridor map rather than the full map
+   *
+   */
+  bool isUsingCorridorMap() const;
   /**
    *  \brief Enable updates without route and set route_node_flag_ as true
    *
@@ -157,15 +210,26 @@ private:
   std::function<void()> map_callback_;
   std::function<void()> route_callback_;
   void newRegemUpdateHelper(lanelet::Lanelet parent_llt, lanelet::RegulatoryElement* regem) const;
+  void applyMap(const autoware_lanelet2_msgs::msg::MapBin::SharedPtr map_msg);
   double config_speed_limit_;
 
   size_t current_map_version_ = 0; // Current map version based on recived map messages
   std::queue<autoware_lanelet2_msgs::msg::MapBin::SharedPtr> map_update_queue_; // Update queue used to cache map updates when they cannot be immeadiatly applied due to waiting for rerouting
   boost::optional<carma_planning_msgs::msg::Route> delayed_route_msg_;
+  boost::optional<carma_planning_msgs::msg::Route> last_route_msg_; // Most recently applied route. Reapplied when the corridor map is replaced
+  bool using_corridor_map_ = false; // True if the current map is a corridor map rather than the full map
+  std::deque<autoware_lanelet2_msgs::msg::MapBin::SharedPtr> applied_updates_; // Most recently applied map updates for the current map version
+  static constexpr size_t MAX_APPLIED_UPDATES = 100; // Maximum size of applied_updates_
 
   bool recompute_route_flag_=false; // indicates whether if this node should recompute its route based on invalidated msg
   bool rerouting_flag_=false; //indicates whether if route node is in middle of rerouting
   bool route_node_flag_=false; //indicates whether if this node is route node
+  boost::optional<carma_planning_msgs::msg::RouteState> route_state_; // Most recent route state received from the route node
+  double route_state_max_age_ = 0.2; // Max age in seconds of route_state_ before local computation is used instead
+
+  // Route state value indicating the route node is following a route. Matches RouteStateWorker::RouteState::FOLLOWING
+  static constexpr uint8_t ROUTE_STATE_FOLLOWING = 3;
+
   long most_recent_update_msg_seq_ = -1; // Tracks the current sequence number for map update messages. Dropping even a single message would invalidate the map
 
 };
@@ -632,6 +632,38 @@ TEST(CARMAWorldModelTest, getSetRoute)
   ASSERT_TRUE((bool)cmw.getMapRoutingGraph());
 }
 
+TEST(CARMAWorldModelTest, routeOrdinalIndex)
+{
+  CARMAWorldModel cmw;
+
+  // No route loaded
+  ASSERT_FALSE(cmw.isOnRoute(1));
+  ASSERT_FALSE(!!cmw.routeIndexOf(1));
+
+  addStraightRoute(cmw);
+
+  auto path = cmw.getRoute()->shortestPath();
+  ASSERT_EQ(2u, path.size());
+  lanelet::Id first = path[0].id();
+  lanelet::Id second = path[1].id();
+
+  ASSERT_TRUE(cmw.isOnRoute(first));
+  ASSERT_TRUE(cmw.isOnRoute(second));
+  ASSERT_FALSE(cmw.isOnRoute(lanelet::InvalId));
+
+  ASSERT_EQ(0u, cmw.routeIndexOf(first).get());
+  ASSERT_EQ(1u, cmw.routeIndexOf(second).get());
+  ASSERT_FALSE(!!cmw.routeIndexOf(lanelet::InvalId));
+
+  ASSERT_EQ(second, cmw.nextOnRoute(first).get().id());
+  ASSERT_FALSE(!!cmw.nextOnRoute(second));
+  ASSERT_FALSE(!!cmw.nextOnRoute(lanelet::InvalId));
+
+  ASSERT_EQ(first, cmw.previousOnRoute(second).get().id());
+  ASSERT_FALSE(!!cmw.previousOnRoute(first));
+  ASSERT_FALSE(!!cmw.previousOnRoute(lanelet::InvalId));
+}
+
 TEST(CARMAWorldModelTest, routeTrackPos_point)
 {
   CARMAWorldModel cmw;
@@ -1464,4 +1496,48 @@ TEST(CARMAWorldModelTest, getIntersectionAlongRoute)
 
 }
 
+TEST(CARMAWorldModelTest, speedLimitCache)
+{
+  std::shared_ptr<carma_wm::CARMAWorldModel> wm = std::make_shared<carma_wm::CARMAWorldModel>();
+  wm->setConfigSpeedLimit(30.0);
+
+  auto map = carma_wm::test::buildGuidanceTestMap(3.7, 10);
+
+  wm->setMap(map);
+  carma_wm::test::setSpeedLimit(20_mph, wm);
+  carma_wm::test::setRouteByIds({ 1200, 1201, 1202, 1203 }, wm);
+
+  // Traffic rules are only built once per participant
+  auto rules_1 = wm->getTrafficRules();
+  auto rules_2 = wm->getTrafficRules();
+  ASSERT_TRUE(!!rules_1);
+  ASSERT_TRUE(!!rules_2);
+  EXPECT_EQ(rules_1.get().get(), rules_2.get().get());
+
+  auto llt = wm->getMap()->laneletLayer.get(1201);
+  EXPECT_NEAR(wm->getSpeedLimit(llt), lanelet::Velocity(20_mph).value(), 0.0001);
+
+  // Route profile covers the shortest path in downtrack order
+  auto profile = wm->getRouteSpeedLimitProfile();
+  ASSERT_EQ(4u, profile.size());
+  EXPECT_EQ(1200, profile[0].lanelet_id);
+  EXPECT_EQ(1203, profile[3].lanelet_id);
+  EXPECT_NEAR(0.0, profile[0].start_downtrack, 0.0001);
+  EXPECT_NEAR(10.0, profile[1].start_downtrack, 0.0001);
+  EXPECT_NEAR(lanelet::Velocity(20_mph).value(), profile[2].speed_limit, 0.0001);
+
+  auto route_limit = wm->getRouteSpeedLimit(15.0);
+  ASSERT_TRUE(!!route_limit);
+  EXPECT_NEAR(lanelet::Velocity(20_mph).value(), route_limit.get(), 0.0001);
+  EXPECT_FALSE(!!wm->getRouteSpeedLimit(-1.0));
+  EXPECT_FALSE(!!wm->getRouteSpeedLimit(1000.0));
+
+  // Changing the speed limit and re-setting the map invalidates the cached values
+  carma_wm::test::setSpeedLimit(10_mph, wm);
+  EXPECT_NEAR(wm->getSpeedLimit(llt), lanelet::Velocity(10_mph).value(), 0.0001);
+  route_limit = wm->getRouteSpeedLimit(15.0);
+  ASSERT_TRUE(!!route_limit);
+  EXPECT_NEAR(lanelet::Velocity(10_mph).value(), route_limit.get(), 0.0001);
+}
+
 }  // namespace carma_wm
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <carma_wm/CARMAWorldModel.hpp>
+#include <carma_wm/ConflictZoneIndex.hpp>
+#include "TestHelpers.hpp"
+
+namespace carma_wm
+{
+carma_perception_msgs::msg::RoadwayObstacle makeObstacle(lanelet::Id lanelet_id, double down_track, double x, double y,
+                                                         double speed)
+{
+  carma_perception_msgs::msg::RoadwayObstacle obs;
+  obs.lanelet_id = lanelet_id;
+  obs.down_track = down_track;
+  obs.object.pose.pose.position.x = x;
+  obs.object.pose.pose.position.y = y;
+  obs.object.pose.pose.orientation.w = 1.0;
+  obs.object.size.x = 1.0;
+  obs.object.size.y = 1.0;
+  obs.object.velocity.twist.linear.x = speed;
+  return obs;
+}
+
+TEST(ConflictZoneIndexTest, crossingLanelets)
+{
+  /**
+   *         |  A  |
+   *    _____|_____|_____
+   *      B  |zone |  -->
+   *    _____|_____|_____
+   *         |  ^  |
+   *         |  |  |
+   */
+  auto ll_a = getLanelet({ getPoint(0, 0, 0), getPoint(0, 20, 0) }, { getPoint(3, 0, 0), getPoint(3, 20, 0) });
+  auto ll_b = getLanelet({ getPoint(-10, 11, 0), getPoint(13, 11, 0) }, { getPoint(-10, 8, 0), getPoint(13, 8, 0) });
+  auto ll_c = getLanelet({ getPoint(20, 0, 0), getPoint(20, 20, 0) }, { getPoint(23, 0, 0), getPoint(23, 20, 0) });
+
+  lanelet::LaneletMapPtr map = lanelet::utils::createMap({ ll_a, ll_b, ll_c }, {});
+
+  CARMAWorldModel cmw;
+  cmw.setMap(map);
+
+  ConflictZoneIndex index;
+  index.build(*cmw.getMapRoutingGraph());
+
+  ASSERT_EQ(1u, index.size());
+  ASSERT_TRUE(index.getConflictZones(ll_c).empty());
+
+  auto a_zones = index.getConflictZones(ll_a);
+  ASSERT_EQ(1u, a_zones.size());
+  ASSERT_EQ(ll_a.id(), a_zones[0].lanelet.id());
+  ASSERT_EQ(ll_b.id(), a_zones[0].conflicting_lanelet.id());
+  ASSERT_EQ(4u, a_zones[0].area.size());
+  ASSERT_NEAR(8.0, a_zones[0].entry_downtrack, 0.0001);
+  ASSERT_NEAR(11.0, a_zones[0].exit_downtrack, 0.0001);
+  ASSERT_NEAR(10.0, a_zones[0].conflicting_entry_downtrack, 0.0001);
+  ASSERT_NEAR(13.0, a_zones[0].conflicting_exit_downtrack, 0.0001);
+
+  // The same zone seen from the other lanelet
+  auto b_zones = index.getConflictZones(ll_b);
+  ASSERT_EQ(1u, b_zones.size());
+  ASSERT_EQ(ll_a.id(), b_zones[0].conflicting_lanelet.id());
+  ASSERT_NEAR(10.0, b_zones[0].entry_downtrack, 0.0001);
+  ASSERT_NEAR(8.0, b_zones[0].conflicting_entry_downtrack, 0.0001);
+
+  // Lanelets which do not overlap have no zone
+  ASSERT_FALSE(ConflictZoneIndex::computeZone(ll_a, ll_c));
+
+  // World model answers from the same index
+  ASSERT_EQ(1u, cmw.getConflictZones(ll_a).size());
+
+  // Objects in, approaching and far from the zone
+  auto zone = a_zones[0];
+  cmw.setRoadwayObjects({
+      makeObstacle(ll_a.id(), 9.5, 1.5, 9.5, 0.0),     // Occupying
+      makeObstacle(ll_b.id(), 5.0, -5.0, 9.5, 5.0),    // 5 m from the entry at 5 m/s
+      makeObstacle(ll_b.id(), 15.0, 5.0, 9.5, 5.0),    // Already past the zone
+      makeObstacle(ll_c.id(), 5.0, 21.5, 5.0, 10.0),   // Unrelated lanelet
+  });
+
+  auto objects = cmw.getConflictZoneObjects(zone, 2.0);
+  ASSERT_EQ(2u, objects.size());
+  ASSERT_NEAR(1.5, objects[0].object.pose.pose.position.x, 0.0001);
+  ASSERT_NEAR(-5.0, objects[1].object.pose.pose.position.x, 0.0001);
+
+  // Too slow to reach the zone in the shorter horizon
+  ASSERT_EQ(1u, cmw.getConflictZoneObjects(zone, 0.5).size());
+}
+
+TEST(ConflictZoneIndexTest, conflictZonesAlongRoute)
+{
+  /**
+   *         |  |  |
+   *    _____|__|__|_____
+   *      D  |  A2 |  -->
+   *    _____|__|__|_____
+   *         |  |  |
+   *    _____|__|__|_____
+   *      E  |  A1 |  -->
+   *    _____|__|__|_____
+   *      B  |  |  |  -->
+   *    _____|__|__|_____
+   *         |  ^  |
+   */
+  auto pl0 = getPoint(0, 0, 0);
+  auto pl1 = getPoint(0, 20, 0);
+  auto pl2 = getPoint(0, 40, 0);
+  auto pr0 = getPoint(3, 0, 0);
+  auto pr1 = getPoint(3, 20, 0);
+  auto pr2 = getPoint(3, 40, 0);
+  auto ll_a1 = getLanelet({ pl0, pl1 }, { pr0, pr1 });
+  auto ll_a2 = getLanelet({ pl1, pl2 }, { pr1, pr2 });
+  auto ll_b = getLanelet({ getPoint(-10, 11, 0), getPoint(13, 11, 0) }, { getPoint(-10, 8, 0), getPoint(13, 8, 0) });
+  auto ll_e = getLanelet({ getPoint(-10, 17, 0), getPoint(13, 17, 0) }, { getPoint(-10, 14, 0), getPoint(13, 14, 0) });
+  auto ll_d = getLanelet({ getPoint(-10, 31, 0), getPoint(13, 31, 0) }, { getPoint(-10, 28, 0), getPoint(13, 28, 0) });
+
+  lanelet::LaneletMapPtr map = lanelet::utils::createMap({ ll_a1, ll_a2, ll_b, ll_e, ll_d }, {});
+
+  CARMAWorldModel cmw;
+
+  // No map or route yet
+  ASSERT_TRUE(cmw.getConflictZonesAlongRoute({ 1.5, 0.0 }).empty());
+
+  cmw.setMap(map);
+  ASSERT_TRUE(cmw.getConflictZonesAlongRoute({ 1.5, 0.0 }).empty());
+
+  auto route = cmw.getMapRoutingGraph()->getRoute(ll_a1, ll_a2);
+  ASSERT_TRUE((bool)route);
+  cmw.setRoute(std::make_shared<lanelet::routing::Route>(std::move(route.get())));
+
+  // All zones along the route in route order
+  auto zones = cmw.getConflictZonesAlongRoute({ 1.5, 0.0 });
+  ASSERT_EQ(3u, zones.size());
+  ASSERT_EQ(ll_b.id(), zones[0].conflicting_lanelet.id());
+  ASSERT_EQ(ll_e.id(), zones[1].conflicting_lanelet.id());
+  ASSERT_EQ(ll_d.id(), zones[2].conflicting_lanelet.id());
+
+  // The zone behind the vehicle is dropped
+  zones = cmw.getConflictZonesAlongRoute({ 1.5, 12.0 });
+  ASSERT_EQ(2u, zones.size());
+
+  ASSERT_EQ(ll_a1.id(), zones[0].lanelet.id());
+  ASSERT_EQ(ll_e.id(), zones[0].conflicting_lanelet.id());
+  ASSERT_NEAR(14.0, zones[0].route_entry_downtrack, 0.0001);
+  ASSERT_NEAR(17.0, zones[0].route_exit_downtrack, 0.0001);
+  ASSERT_NEAR(14.0, zones[0].entry_downtrack, 0.0001);
+
+  // Zones on later lanelets are offset by the route downtrack of the lanelet start, lanelet downtracks are kept
+  ASSERT_EQ(ll_a2.id(), zones[1].lanelet.id());
+  ASSERT_EQ(ll_d.id(), zones[1].conflicting_lanelet.id());
+  ASSERT_NEAR(28.0, zones[1].route_entry_downtrack, 0.0001);
+  ASSERT_NEAR(31.0, zones[1].route_exit_downtrack, 0.0001);
+  ASSERT_NEAR(8.0, zones[1].entry_downtrack, 0.0001);
+  ASSERT_NEAR(11.0, zones[1].exit_downtrack, 0.0001);
+  ASSERT_NEAR(10.0, zones[1].conflicting_entry_downtrack, 0.0001);
+
+  // Zones along the route can be used to look up zone objects
+  cmw.setRoadwayObjects({ makeObstacle(ll_a2.id(), 9.5, 1.5, 29.5, 0.0) });
+  ASSERT_EQ(1u, cmw.getConflictZoneObjects(zones[1], 1.0).size());
+  ASSERT_TRUE(cmw.getConflictZoneObjects(zones[0], 1.0).empty());
+}
+
+}  // namespace carma_wm
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <carma_wm/CARMAWorldModel.hpp>
+#include <carma_wm/LaneChainIndex.hpp>
+#include <carma_wm/WMTestLibForGuidance.hpp>
+#include "TestHelpers.hpp"
+
+namespace carma_wm
+{
+TEST(LaneChainIndexTest, straightLanes)
+{
+  auto cmw = std::make_shared<CARMAWorldModel>();
+  cmw->setMap(test::buildGuidanceTestMap(3.7, 10));
+
+  LaneChainIndex index;
+  index.build(*cmw->getMapRoutingGraph());
+
+  // Three parallel lanes of four lanelets each
+  ASSERT_EQ(3u, index.size());
+  ASSERT_EQ(index.getIndexFromId(1200).first, index.getIndexFromId(1203).first);
+  ASSERT_EQ(0u, index.getIndexFromId(1200).second);
+  ASSERT_EQ(3u, index.getIndexFromId(1203).second);
+  ASSERT_NE(index.getIndexFromId(1200).first, index.getIndexFromId(1210).first);
+  ASSERT_THROW(index.getIndexFromId(1), std::out_of_range);
+
+  auto llt = cmw->getMap()->laneletLayer.get(1201);
+
+  auto ahead = index.getLane(llt, LANE_AHEAD);
+  ASSERT_EQ(3u, ahead.size());
+  ASSERT_EQ(1201, ahead[0].id());
+  ASSERT_EQ(1203, ahead[2].id());
+
+  auto behind = index.getLane(llt, LANE_BEHIND);
+  ASSERT_EQ(2u, behind.size());
+  ASSERT_EQ(1200, behind[0].id());
+  ASSERT_EQ(1201, behind[1].id());
+
+  auto full = index.getLane(llt, LANE_FULL);
+  ASSERT_EQ(4u, full.size());
+  ASSERT_EQ(1200, full[0].id());
+  ASSERT_EQ(1203, full[3].id());
+
+  // Results should match the world model
+  auto wm_full = cmw->getLane(llt, LANE_FULL);
+  ASSERT_EQ(full.size(), wm_full.size());
+  for (size_t i = 0; i < full.size(); i++)
+  {
+    ASSERT_EQ(full[i].id(), wm_full[i].id());
+  }
+
+  // Unknown lanelets are their own lane
+  auto unknown = getLanelet({ getPoint(100, 0, 0), getPoint(100, 1, 0) }, { getPoint(101, 0, 0), getPoint(101, 1, 0) });
+  ASSERT_EQ(1u, index.getLane(unknown, LANE_FULL).size());
+}
+
+TEST(LaneChainIndexTest, merge)
+{
+  /**
+   *        |  C  |
+   *        |_____|
+   *       /     /|
+   *      / B   / | A
+   *     /     /  |
+   */
+  auto p_c_left_start = getPoint(0, 10, 0);
+  auto p_c_right_start = getPoint(3, 10, 0);
+
+  auto ll_a = getLanelet({ getPoint(0, 0, 0), p_c_left_start }, { getPoint(3, 0, 0), p_c_right_start });
+  auto ll_b = getLanelet({ getPoint(-5, 0, 0), p_c_left_start }, { getPoint(-2, 0, 0), p_c_right_start });
+  auto ll_c = getLanelet({ p_c_left_start, getPoint(0, 20, 0) }, { p_c_right_start, getPoint(3, 20, 0) });
+
+  lanelet::LaneletMapPtr map = lanelet::utils::createMap({ ll_a, ll_b, ll_c }, {});
+
+  CARMAWorldModel cmw;
+  cmw.setMap(map);
+
+  LaneChainIndex index;
+  index.build(*cmw.getMapRoutingGraph());
+
+  // Only one of the merging lanelets can share a chain with C
+  ASSERT_EQ(2u, index.size());
+
+  for (const auto& llt : { ll_a, ll_b })
+  {
+    auto ahead = index.getLane(llt, LANE_AHEAD);
+    ASSERT_EQ(2u, ahead.size());
+    ASSERT_EQ(llt.id(), ahead[0].id());
+    ASSERT_EQ(ll_c.id(), ahead[1].id());
+  }
+
+  auto behind = index.getLane(ll_c, LANE_BEHIND);
+  ASSERT_EQ(2u, behind.size());
+  ASSERT_EQ(ll_c.id(), behind[1].id());
+
+  ASSERT_THROW(index.getLane(ll_c, static_cast<LaneSection>(5)), std::invalid_argument);
+}
+
+}  // namespace carma_wm
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <carma_wm/CARMAWorldModel.hpp>
+#include <carma_wm/LaneletReachabilityIndex.hpp>
+#include <carma_wm/WMTestLibForGuidance.hpp>
+#include "TestHelpers.hpp"
+
+namespace carma_wm
+{
+TEST(LaneletReachabilityIndexTest, boundedDistance)
+{
+  /**
+   *        |1203|1213|1223|
+   *        | _  _  _  _  _|
+   *        |1202|1212|1222|
+   *        | _  _  _  _  _|
+   *        |1201|1211|1221|    num   = lanelet id hardcoded for easier testing
+   *        | _  _  _  _  _|    |     = lane lines
+   *        |1200|1210|1220|    - - - = Lanelet boundary
+   *        |              |    Each lanelet is 10 m long
+   *        ****************
+   */
+  CARMAWorldModel cmw;
+  cmw.setMap(carma_wm::test::buildGuidanceTestMap(3.7, 10));
+
+  LaneletReachabilityIndex index;
+  index.build(*cmw.getMapRoutingGraph());
+
+  ASSERT_EQ(12u, index.size());
+  ASSERT_EQ(0u, index.cacheSize());
+
+  // Same lanelet
+  ASSERT_TRUE(index.distance(1200, 1200, 0.0));
+  ASSERT_NEAR(0.0, index.distance(1200, 1200, 0.0).get(), 0.0001);
+
+  // Straight ahead within and beyond the bound
+  ASSERT_TRUE(index.distance(1200, 1203, 100.0));
+  ASSERT_NEAR(30.0, index.distance(1200, 1203, 100.0).get(), 0.0001);
+  ASSERT_FALSE(index.distance(1200, 1203, 25.0));
+
+  // Behind is not reachable
+  ASSERT_FALSE(index.distance(1203, 1200, 100.0));
+
+  // Lane changes add no distance
+  ASSERT_TRUE(index.distance(1200, 1213, 100.0));
+  ASSERT_NEAR(30.0, index.distance(1200, 1213, 100.0).get(), 0.0001);
+  ASSERT_TRUE(index.distance(1200, 1220, 100.0));
+  ASSERT_NEAR(0.0, index.distance(1200, 1220, 100.0).get(), 0.0001);
+
+  // Unknown lanelets
+  ASSERT_FALSE(index.distance(1200, 9999, 100.0));
+
+  ASSERT_EQ(5u, index.cacheSize());
+
+  // Unreachable with a small bound is searched again with a larger one
+  ASSERT_FALSE(index.distance(1200, 1212, 15.0));
+  ASSERT_TRUE(index.distance(1200, 1212, 20.0));
+  ASSERT_NEAR(20.0, index.distance(1200, 1212, 20.0).get(), 0.0001);
+  ASSERT_EQ(6u, index.cacheSize());
+}
+
+TEST(LaneletReachabilityIndexTest, longitudinalGap)
+{
+  CARMAWorldModel cmw;
+  ASSERT_THROW(cmw.getReachableDistance(1200, 1203, 100.0), std::invalid_argument);
+
+  cmw.setMap(carma_wm::test::buildGuidanceTestMap(3.7, 10));
+
+  auto map = cmw.getMap();
+  auto rear = map->laneletLayer.get(1200);
+  auto front = map->laneletLayer.get(1213);
+
+  ASSERT_TRUE(cmw.getReachableDistance(1200, 1213, 100.0));
+  ASSERT_NEAR(30.0, cmw.getReachableDistance(1200, 1213, 100.0).get(), 0.0001);
+
+  auto gap = cmw.getLongitudinalGap(rear, 5.0, front, 2.0, 100.0);
+  ASSERT_TRUE(gap);
+  ASSERT_NEAR(27.0, gap.get(), 0.0001);
+
+  // The bound is measured from the rear position
+  ASSERT_TRUE(cmw.getLongitudinalGap(rear, 5.0, front, 2.0, 25.0));
+  ASSERT_FALSE(cmw.getLongitudinalGap(rear, 5.0, front, 2.0, 24.0));
+  ASSERT_FALSE(cmw.getLongitudinalGap(front, 2.0, rear, 5.0, 100.0));
+}
+
+}  // namespace carma_wm
@@ -35,6 +35,7 @@
 #include <autoware_lanelet2_ros2_interface/utility/utilities.hpp>
 #include <lanelet2_extension/projection/local_frame_projector.h>
 #include <lanelet2_extension/io/autoware_osm_parser.h>
+#include <carma_wm/WMTestLibForGuidance.hpp>
 
 
 namespace carma_wm
@@ -309,4 +310,154 @@ TEST(WMListenerWorkerTest, checkIfReRoutingNeeded2)
   ASSERT_EQ(true, wmlw.checkIfReRoutingNeeded());
 }
 
+TEST(WMListenerWorkerTest, routeStateCache)
+{
+  WMListenerWorker wmlw;
+  CARMAWorldModel cwm;
+
+  addStraightRoute(cwm);
+
+  auto map_ptr = lanelet::utils::removeConst(cwm.getMap());
+
+  autoware_lanelet2_msgs::msg::MapBin msg;
+  lanelet::utils::conversion::toBinMsg(map_ptr, &msg);
+
+  wmlw.mapCallback(std::make_unique<autoware_lanelet2_msgs::msg::MapBin>(msg));
+
+  carma_planning_msgs::msg::Route route_msg;
+  route_msg.route_name = "test_route";
+  route_msg.shortest_path_lanelet_ids.push_back(cwm.getRoute()->shortestPath()[0].id());
+  route_msg.shortest_path_lanelet_ids.push_back(cwm.getRoute()->shortestPath()[1].id());
+  wmlw.routeCallback(std::make_unique<carma_planning_msgs::msg::Route>(route_msg));
+
+  // No route state received yet
+  ASSERT_FALSE(!!wmlw.getCachedEgoTrackState(10.0));
+
+  carma_planning_msgs::msg::RouteState route_state;
+  route_state.header.stamp = rclcpp::Time(10, 0);
+  route_state.route_id = "test_route";
+  route_state.state = 3;  // FOLLOWING
+  route_state.lanelet_id = cwm.getRoute()->shortestPath()[1].id();
+  route_state.down_track = 1.5;
+  route_state.cross_track = 0.1;
+  route_state.lanelet_downtrack = 0.5;
+  route_state.speed_limit = 11.0;
+  wmlw.routeStateCallback(std::make_shared<carma_planning_msgs::msg::RouteState>(route_state));
+
+  auto cached = wmlw.getCachedEgoTrackState(10.1);
+  ASSERT_TRUE(!!cached);
+  ASSERT_TRUE(cached->from_route_state);
+  ASSERT_EQ(route_state.lanelet_id, cached->lanelet_id);
+  ASSERT_NEAR(1.5, cached->route_track_pos.downtrack, 0.00001);
+  ASSERT_NEAR(0.1, cached->route_track_pos.crosstrack, 0.00001);
+  ASSERT_NEAR(0.5, cached->lanelet_downtrack, 0.00001);
+  ASSERT_NEAR(11.0, cached->speed_limit, 0.00001);
+
+  // Stale state is not used
+  ASSERT_FALSE(!!wmlw.getCachedEgoTrackState(11.0));
+  wmlw.setRouteStateMaxAge(2.0);
+  ASSERT_TRUE(!!wmlw.getCachedEgoTrackState(11.0));
+
+  // Local computation is used when the cached state is unusable
+  route_state.route_id = "other_route";
+  wmlw.routeStateCallback(std::make_shared<carma_planning_msgs::msg::RouteState>(route_state));
+  ASSERT_FALSE(!!wmlw.getCachedEgoTrackState(10.1));
+
+  auto computed = wmlw.getEgoTrackState(lanelet::BasicPoint2d(0.5, 0.5), 10.1);
+  ASSERT_FALSE(computed.from_route_state);
+  ASSERT_EQ(cwm.getRoute()->shortestPath()[0].id(), computed.lanelet_id);
+  ASSERT_NEAR(0.5, computed.route_track_pos.downtrack, 0.00001);
+  ASSERT_NEAR(0.5, computed.lanelet_downtrack, 0.00001);
+
+  // A new route invalidates the cached state
+  route_state.route_id = "test_route";
+  wmlw.routeStateCallback(std::make_shared<carma_planning_msgs::msg::RouteState>(route_state));
+  ASSERT_TRUE(!!wmlw.getCachedEgoTrackState(10.1));
+  wmlw.routeCallback(std::make_unique<carma_planning_msgs::msg::Route>(route_msg));
+  ASSERT_FALSE(!!wmlw.getCachedEgoTrackState(10.1));
+}
+
+namespace
+{
+autoware_lanelet2_msgs::msg::MapBin corridorMsg(const lanelet::LaneletMapPtr& map, const std::vector<lanelet::Id>& ids, size_t version, size_t seq_id)
+{
+  lanelet::Lanelets lanelets;
+  for (auto id : ids)
+  {
+    lanelets.push_back(map->laneletLayer.get(id));
+  }
+
+  autoware_lanelet2_msgs::msg::MapBin msg;
+  lanelet::utils::conversion::toBinMsg(lanelet::utils::createMap(lanelets, {}), &msg);
+  msg.map_version = version;
+  msg.seq_id = seq_id;
+  return msg;
+}
+}  // namespace
+
+TEST(WMListenerWorkerTest, corridorMapCallback)
+{
+  WMListenerWorker wmlw;
+
+  auto map = carma_wm::test::buildGuidanceTestMap(3.7, 100, 4);
+
+  autoware_lanelet2_msgs::msg::MapBin full_msg;
+  lanelet::utils::conversion::toBinMsg(map, &full_msg);
+
+  wmlw.mapCallback(std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(full_msg));
+  ASSERT_EQ(12u, wmlw.getWorldModel()->getMap()->laneletLayer.size());
+  ASSERT_FALSE(wmlw.isUsingCorridorMap());
+
+  carma_planning_msgs::msg::Route route_msg;
+  route_msg.route_name = "test_route";
+  route_msg.shortest_path_lanelet_ids = { 1200, 1201 };
+  wmlw.routeCallback(std::make_shared<carma_planning_msgs::msg::Route>(route_msg));
+  ASSERT_TRUE((bool)wmlw.getWorldModel()->getRoute());
+
+  int route_callback_count = 0;
+  wmlw.setRouteCallback([&route_callback_count]() { route_callback_count++; });
+
+  // Corridor replaces the full map and the route is rebuilt on it
+  wmlw.corridorMapCallback(std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(corridorMsg(map, { 1200, 1201, 1210, 1211 }, 0, 0)));
+  ASSERT_EQ(4u, wmlw.getWorldModel()->getMap()->laneletLayer.size());
+  ASSERT_TRUE(wmlw.isUsingCorridorMap());
+  ASSERT_EQ(1, route_callback_count);
+  ASSERT_EQ(2u, wmlw.getWorldModel()->getRoute()->shortestPath().size());
+  ASSERT_TRUE(wmlw.getWorldModel()->getMap()->laneletLayer.get(1201).constData() ==
+              wmlw.getWorldModel()->getRoute()->shortestPath()[1].constData());
+
+  // The full map of the same version is not used while the corridor is
+  wmlw.mapCallback(std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(full_msg));
+  ASSERT_EQ(4u, wmlw.getWorldModel()->getMap()->laneletLayer.size());
+
+  // A route leaving the corridor waits for the expanded corridor
+  route_msg.shortest_path_lanelet_ids = { 1200, 1201, 1202 };
+  wmlw.routeCallback(std::make_shared<carma_planning_msgs::msg::Route>(route_msg));
+  ASSERT_EQ(1, route_callback_count);
+  ASSERT_EQ(2u, wmlw.getWorldModel()->getRoute()->shortestPath().size());
+
+  wmlw.corridorMapCallback(std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(corridorMsg(map, { 1200, 1201, 1202, 1210, 1211, 1212 }, 0, 0)));
+  ASSERT_EQ(6u, wmlw.getWorldModel()->getMap()->laneletLayer.size());
+  ASSERT_EQ(2, route_callback_count);
+  ASSERT_EQ(3u, wmlw.getWorldModel()->getRoute()->shortestPath().size());
+
+  // A new map version switches back to the full map
+  full_msg.map_version = 1;
+  wmlw.mapCallback(std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(full_msg));
+  ASSERT_EQ(12u, wmlw.getWorldModel()->getMap()->laneletLayer.size());
+  ASSERT_FALSE(wmlw.isUsingCorridorMap());
+
+  // Corridors for older maps are dropped
+  wmlw.corridorMapCallback(std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(corridorMsg(map, { 1200, 1201 }, 0, 0)));
+  ASSERT_EQ(12u, wmlw.getWorldModel()->getMap()->laneletLayer.size());
+
+  // The route node always keeps the full map
+  WMListenerWorker route_node_wmlw;
+  route_node_wmlw.enableUpdatesWithoutRoute();
+  route_node_wmlw.mapCallback(std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(full_msg));
+  route_node_wmlw.corridorMapCallback(std::make_shared<autoware_lanelet2_msgs::msg::MapBin>(corridorMsg(map, { 1200, 1201 }, 1, 0)));
+  ASSERT_EQ(12u, route_node_wmlw.getWorldModel()->getMap()->laneletLayer.size());
+  ASSERT_FALSE(route_node_wmlw.isUsingCorridorMap());
+}
+
 }  // namespace carma_wm
@@ -0,0 +1,63 @@
+#pragma once
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#include <unordered_set>
+#include <vector>
+#include <lanelet2_core/LaneletMap.h>
+
+namespace carma_wm_ctrl
+{
+/*!
+ * \brief Ids of the map primitives which make up a route corridor
+ */
+struct CorridorPrimitives
+{
+  std::unordered_set<lanelet::Id> lanelet_ids;
+  std::unordered_set<lanelet::Id> area_ids;
+};
+
+/*!
+ * \brief Adds all lanelets and areas whose bounding boxes are within buffer meters of the bounding box of any route lanelet
+ *        to the provided corridor. Existing corridor entries are kept so a corridor only ever grows.
+ *
+ * \param map The map to search
+ * \param route_ids The ids of the route lanelets. Ids which are not in the map are ignored.
+ * \param buffer The distance in meters to expand around the route
+ * \param corridor The corridor to add to
+ */
+void addToCorridor(const lanelet::LaneletMapPtr& map, const std::vector<lanelet::Id>& route_ids, double buffer,
+                   CorridorPrimitives& corridor);
+
+/*!
+ * \brief Returns true if every provided lanelet id is part of the corridor
+ */
+bool corridorContains(const CorridorPrimitives& corridor, const std::vector<lanelet::Id>& lanelet_ids);
+
+/*!
+ * \brief Creates a submap containing the corridor primitives.
+ *        Referenced primitives, including the regulatory elements of each lanelet and everything those regulatory elements
+ *        refer to, are added as well so the submap is self consistent.
+ *
+ * NOTE: The submap shares primitives with the provided map. It is intended to be serialized and discarded.
+ *
+ * \param map The map containing the corridor primitives
+ * \param corridor The corridor to extract
+ *
+ * \return The corridor submap
+ */
+lanelet::LaneletMapPtr createCorridorMap(const lanelet::LaneletMapPtr& map, const CorridorPrimitives& corridor);
+
+}  // namespace carma_wm_ctrl
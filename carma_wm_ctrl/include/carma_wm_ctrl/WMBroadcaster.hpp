@@ -30,6 +30,7 @@
 #include <autoware_lanelet2_ros2_interface/utility/message_conversion.hpp>
 #include <lanelet2_extension/projection/local_frame_projector.h>
 #include <carma_wm_ctrl/GeofenceScheduler.hpp>
+#include <carma_wm_ctrl/CorridorMap.hpp>
 #include <lanelet2_core/geometry/BoundingBox.h>
 #include <lanelet2_core/primitives/BoundingBox.h>
 #include <carma_wm/WMListener.hpp>
@@ -185,6 +186,25 @@ public:
    */
   void setConfigSpeedLimit(double cL);
 
+  /*!
+   * \brief Configures publication of a submap around the active route. The full map continues to be published
+   *        to the map publisher provided in the constructor so nodes which need the full map can ignore the corridor.
+   *
+   * \param enabled True to publish corridor maps
+   * \param buffer Distance in meters around the route lanelets to include in the corridor
+   * \param corridor_map_pub Callback used to publish corridor maps
+   */
+  void setCorridorMapConfig(bool enabled, double buffer, const PublishMapCallback& corridor_map_pub);
+
+  /*!
+   * \brief Publishes a corridor map if the provided route is not fully contained in the most recently published corridor.
+   *        The corridor is expanded rather than replaced so lanelets held by listeners remain valid.
+   *        Does nothing if corridor maps are disabled or no map has been loaded.
+   *
+   * \param route_msg The active route
+   */
+  void updateCorridorMap(const carma_planning_msgs::msg::Route& route_msg);
+
 /**
  * @brief Set the Vehicle Participation Type 
  * 
@@ -450,6 +470,13 @@ private:
    */
   size_t current_map_version_ = 0;
 
+  // Corridor map publication
+  bool corridor_map_enabled_ = false;
+  double corridor_map_buffer_ = 300.0; // meters
+  PublishMapCallback corridor_map_pub_;
+  CorridorPrimitives corridor_; // Primitives in the most recently published corridor map. Cleared on each new map version
+  size_t corridor_map_version_ = 0; // Map version the corridor was built for
+
   carma_planning_msgs::msg::Route current_route; // Most recently received route message
   /**
    * Queue which stores the map updates applied to the current map version as a sequence of diffs
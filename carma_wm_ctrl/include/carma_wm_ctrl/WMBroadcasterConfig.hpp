@@ -35,6 +35,8 @@ namespace carma_wm_ctrl
     double config_limit = 6.67; //config speed limit in m/s
     std::string vehicle_id = "CARMA"; 
     std::string participant = "vehicle:car";
+    bool corridor_map_enabled = false; // If true a submap around the active route is published on semantic_map_corridor
+    double corridor_map_buffer = 300.0; // Distance in meters around the route lanelets which is included in the corridor map
     
     // Stream operator for this config
     friend std::ostream &operator<<(std::ostream &output, const Config &c)
@@ -48,6 +50,8 @@ namespace carma_wm_ctrl
            << "vehicle_id: " << c.vehicle_id << std::endl
            << "participant: " << c.participant << std::endl
            << "config_limit: " << c.config_limit << std::endl
+           << "corridor_map_enabled: " << c.corridor_map_enabled << std::endl
+           << "corridor_map_buffer: " << c.corridor_map_buffer << std::endl
            << "}" << std::endl;
       return output;
     }
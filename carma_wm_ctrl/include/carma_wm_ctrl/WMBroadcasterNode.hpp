@@ -62,6 +62,13 @@ public:
    * @param map_msg The map message to publish
    */
   void publishMap(const autoware_lanelet2_msgs::msg::MapBin& map_msg);
+
+  /**
+   * @brief Callback to publish a corridor submap around the active route
+   *
+   * @param map_msg The corridor map message to publish
+   */
+  void publishCorridorMap(const autoware_lanelet2_msgs::msg::MapBin& map_msg);
   
   /**
    * @brief Initializes the WMBroadcaster worker with reference to the CarmaLifecycleNode itself
@@ -109,6 +116,7 @@ private:
   Config config_;
 
   carma_ros2_utils::PubPtr<autoware_lanelet2_msgs::msg::MapBin> map_pub_;
+  carma_ros2_utils::PubPtr<autoware_lanelet2_msgs::msg::MapBin> corridor_map_pub_;
   carma_ros2_utils::PubPtr<autoware_lanelet2_msgs::msg::MapBin> map_update_pub_;
   carma_ros2_utils::PubPtr<carma_v2x_msgs::msg::TrafficControlRequest> control_msg_pub_;
   carma_ros2_utils::PubPtr<visualization_msgs::msg::MarkerArray> tcm_visualizer_pub_;
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <carma_wm_ctrl/CorridorMap.hpp>
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+
+namespace carma_wm_ctrl
+{
+void addToCorridor(const lanelet::LaneletMapPtr& map, const std::vector<lanelet::Id>& route_ids, double buffer,
+                   CorridorPrimitives& corridor)
+{
+  for (auto id : route_ids)
+  {
+    if (!map->laneletLayer.exists(id))
+    {
+      continue;
+    }
+
+    auto box = lanelet::geometry::boundingBox2d(map->laneletLayer.get(id));
+    lanelet::BoundingBox2d search_box(lanelet::BasicPoint2d(box.min().x() - buffer, box.min().y() - buffer),
+                                      lanelet::BasicPoint2d(box.max().x() + buffer, box.max().y() + buffer));
+
+    for (const auto& llt : map->laneletLayer.search(search_box))
+    {
+      corridor.lanelet_ids.insert(llt.id());
+    }
+
+    for (const auto& area : map->areaLayer.search(search_box))
+    {
+      corridor.area_ids.insert(area.id());
+    }
+  }
+}
+
+bool corridorContains(const CorridorPrimitives& corridor, const std::vector<lanelet::Id>& lanelet_ids)
+{
+  for (auto id : lanelet_ids)
+  {
+    if (corridor.lanelet_ids.find(id) == corridor.lanelet_ids.end())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+lanelet::LaneletMapPtr createCorridorMap(const lanelet::LaneletMapPtr& map, const CorridorPrimitives& corridor)
+{
+  lanelet::Lanelets lanelets;
+  lanelets.reserve(corridor.lanelet_ids.size());
+  for (auto id : corridor.lanelet_ids)
+  {
+    if (map->laneletLayer.exists(id))
+    {
+      lanelets.push_back(map->laneletLayer.get(id));
+    }
+  }
+
+  lanelet::Areas areas;
+  areas.reserve(corridor.area_ids.size());
+  for (auto id : corridor.area_ids)
+  {
+    if (map->areaLayer.exists(id))
+    {
+      areas.push_back(map->areaLayer.get(id));
+    }
+  }
+
+  // Adding a lanelet or area to a map also adds its regulatory elements and all primitives they reference
+  return lanelet::utils::createMap(lanelets, areas);
+}
+
+}  // namespace carma_wm_ctrl
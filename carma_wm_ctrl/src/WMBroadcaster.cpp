@@ -107,6 +107,9 @@ void WMBroadcaster::baseMapCallback(autoware_lanelet2_msgs::msg::MapBin::UniqueP
   lanelet::utils::conversion::toBinMsg(current_map_, &compliant_map_msg);
   compliant_map_msg.map_version = current_map_version_;
   map_pub_(compliant_map_msg);
+
+  // A new map version invalidates the previous corridor. Listeners use the full map until a route is available again
+  corridor_ = CorridorPrimitives();
 };
 
 /*!
@@ -1636,6 +1639,63 @@ void  WMBroadcaster::routeCallbackMessage(carma_planning_msgs::msg::Route::Uniqu
  cR =  controlRequestFromRoute(*route_msg);
  control_msg_pub_(cR);
 
+ updateCorridorMap(*route_msg);
+}
+
+void WMBroadcaster::setCorridorMapConfig(bool enabled, double buffer, const PublishMapCallback& corridor_map_pub)
+{
+  corridor_map_enabled_ = enabled;
+  corridor_map_buffer_ = buffer;
+  corridor_map_pub_ = corridor_map_pub;
+}
+
+void WMBroadcaster::updateCorridorMap(const carma_planning_msgs::msg::Route& route_msg)
+{
+  if (!corridor_map_enabled_ || !corridor_map_pub_)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(map_mutex_);
+
+  if (!current_map_)
+  {
+    return;
+  }
+
+  // Listeners build their route from the shortest path while the route path may contain additional lane changes
+  std::vector<lanelet::Id> route_ids(route_msg.route_path_lanelet_ids.begin(), route_msg.route_path_lanelet_ids.end());
+  route_ids.insert(route_ids.end(), route_msg.shortest_path_lanelet_ids.begin(), route_msg.shortest_path_lanelet_ids.end());
+
+  if (route_ids.empty() || (corridor_map_version_ == current_map_version_ && corridorContains(corridor_, route_ids)))
+  {
+    return; // The current corridor already covers this route
+  }
+
+  if (corridor_map_version_ != current_map_version_)
+  {
+    corridor_ = CorridorPrimitives();
+    corridor_map_version_ = current_map_version_;
+  }
+
+  addToCorridor(current_map_, route_ids, corridor_map_buffer_, corridor_);
+
+  auto corridor_map = createCorridorMap(current_map_, corridor_);
+
+  RCLCPP_INFO_STREAM(rclcpp::get_logger("carma_wm_ctrl"), "Publishing corridor map with " << corridor_map->laneletLayer.size()
+                      << " of " << current_map_->laneletLayer.size() << " lanelets for route " << route_msg.route_name);
+
+  autoware_lanelet2_msgs::msg::MapBin corridor_msg;
+  lanelet::utils::conversion::toBinMsg(corridor_map, &corridor_msg);
+  corridor_msg.map_version = current_map_version_;
+  // The corridor is built from the current map so it already contains every update sent so far.
+  // update_count_ is the seq_id of the last update sent and starts at -1, so sent_updates is both the number of
+  // updates included in the corridor and the seq_id of the first update which is not. Listeners skip updates below it.
+  const size_t sent_updates = update_count_ + 1;
+  corridor_msg.seq_id = sent_updates;
+  corridor_msg.has_routing_graph = false; // Listeners build the routing graph over the corridor lanelets
+
+  corridor_map_pub_(corridor_msg);
 }
 
 carma_v2x_msgs::msg::TrafficControlRequest WMBroadcaster::controlRequestFromRoute(const carma_planning_msgs::msg::Route& route_msg, std::shared_ptr<j2735_v2x_msgs::msg::Id64b> req_id_for_testing)
@@ -29,6 +29,11 @@ void WMBroadcasterNode::publishMap(const autoware_lanelet2_msgs::msg::MapBin& ma
   map_pub_->publish(map_msg);
 }
 
+void WMBroadcasterNode::publishCorridorMap(const autoware_lanelet2_msgs::msg::MapBin& map_msg)
+{
+  corridor_map_pub_->publish(map_msg);
+}
+
 void WMBroadcasterNode::publishMapUpdate(const autoware_lanelet2_msgs::msg::MapBin& geofence_msg) const
 {
   map_update_pub_->publish(geofence_msg);
@@ -61,6 +66,8 @@ WMBroadcasterNode::WMBroadcasterNode(const rclcpp::NodeOptions &options)
   config_.vehicle_id = declare_parameter<std::string>("vehicle_id", config_.vehicle_id);
   config_.participant = declare_parameter<std::string>("vehicle_participant_type", config_.participant);
   config_.participant = declare_parameter<double>("config_speed_limit", config_.config_limit);
+  config_.corridor_map_enabled = declare_parameter<bool>("corridor_map_enabled", config_.corridor_map_enabled);
+  config_.corridor_map_buffer = declare_parameter<double>("corridor_map_buffer", config_.corridor_map_buffer);
 
   declare_parameter("intersection_ids_for_correction");
   declare_parameter("intersection_coord_correction");
@@ -91,12 +98,16 @@ carma_ros2_utils::CallbackReturn WMBroadcasterNode::handle_on_configure(const rc
   get_parameter<std::string>("vehicle_id", config_.vehicle_id);
   get_parameter<std::string>("vehicle_participant_type", config_.participant);
   get_parameter<double>("config_speed_limit", config_.config_limit);
+  get_parameter<bool>("corridor_map_enabled", config_.corridor_map_enabled);
+  get_parameter<double>("corridor_map_buffer", config_.corridor_map_buffer);
 
   wmb_->setConfigACKPubTimes(config_.ack_pub_times);
   wmb_->setMaxLaneWidth(config_.max_lane_width);
   wmb_->setConfigSpeedLimit(config_.config_limit);
   wmb_->setConfigVehicleId(config_.vehicle_id);
   wmb_->setVehicleParticipationType(config_.participant);
+  wmb_->setCorridorMapConfig(config_.corridor_map_enabled, config_.corridor_map_buffer,
+    std::bind(&WMBroadcasterNode::publishCorridorMap, this, std_ph::_1));
 
   rclcpp::Parameter intersection_coord_correction_param = get_parameter("intersection_coord_correction");
   config_.intersection_coord_correction = intersection_coord_correction_param.as_double_array();
@@ -127,6 +138,9 @@ carma_ros2_utils::CallbackReturn WMBroadcasterNode::handle_on_configure(const rc
   // Map Publisher
   map_pub_ = create_publisher<autoware_lanelet2_msgs::msg::MapBin>("semantic_map", pub_qos_transient_local, intra_proc_disabled);
 
+  // Corridor Map Publisher. Only used when corridor_map_enabled is true
+  corridor_map_pub_ = create_publisher<autoware_lanelet2_msgs::msg::MapBin>("semantic_map_corridor", pub_qos_transient_local, intra_proc_disabled);
+
   //Route Message Publisher
   control_msg_pub_= create_publisher<carma_v2x_msgs::msg::TrafficControlRequest>("outgoing_geofence_request", 1);
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <carma_wm/WMTestLibForGuidance.hpp>
+#include <autoware_lanelet2_ros2_interface/utility/message_conversion.hpp>
+#include <carma_wm_ctrl/CorridorMap.hpp>
+
+namespace carma_wm_ctrl
+{
+
+TEST(CorridorMap, addToCorridor)
+{
+  // 3 lanes wide and 4 lanelets long. Each lanelet is 3.7m wide and 100m long
+  auto map = carma_wm::test::buildGuidanceTestMap(3.7, 100, 4);
+
+  CorridorPrimitives corridor;
+  addToCorridor(map, { 1200 }, 10.0, corridor);
+
+  // Adjacent lanes and the next segment are within the buffer
+  ASSERT_EQ(6u, corridor.lanelet_ids.size());
+  ASSERT_TRUE(corridorContains(corridor, { 1200, 1210, 1220, 1201, 1211, 1221 }));
+  ASSERT_FALSE(corridorContains(corridor, { 1202 }));
+  ASSERT_FALSE(corridorContains(corridor, { 1200, 1203 }));
+
+  // Unknown ids are ignored
+  addToCorridor(map, { 9999 }, 10.0, corridor);
+  ASSERT_EQ(6u, corridor.lanelet_ids.size());
+
+  // Extending the route only grows the corridor
+  addToCorridor(map, { 1203 }, 10.0, corridor);
+  ASSERT_EQ(12u, corridor.lanelet_ids.size());
+  ASSERT_TRUE(corridorContains(corridor, { 1200, 1202, 1203, 1223 }));
+}
+
+TEST(CorridorMap, createCorridorMap)
+{
+  auto map = carma_wm::test::buildGuidanceTestMap(3.7, 100, 4);
+
+  CorridorPrimitives corridor;
+  addToCorridor(map, { 1200 }, 1.0, corridor);
+
+  auto corridor_map = createCorridorMap(map, corridor);
+
+  ASSERT_EQ(corridor.lanelet_ids.size(), corridor_map->laneletLayer.size());
+  ASSERT_LT(corridor_map->laneletLayer.size(), map->laneletLayer.size());
+
+  for (auto id : corridor.lanelet_ids)
+  {
+    ASSERT_TRUE(corridor_map->laneletLayer.exists(id));
+    // Regulations such as the speed limit are carried into the corridor
+    ASSERT_EQ(map->laneletLayer.get(id).regulatoryElements().size(), corridor_map->laneletLayer.get(id).regulatoryElements().size());
+    for (const auto& regem : corridor_map->laneletLayer.get(id).regulatoryElements())
+    {
+      ASSERT_TRUE(corridor_map->regulatoryElementLayer.exists(regem->id()));
+    }
+  }
+
+  // The corridor survives serialization
+  autoware_lanelet2_msgs::msg::MapBin msg;
+  lanelet::utils::conversion::toBinMsg(corridor_map, &msg);
+
+  lanelet::LaneletMapPtr decoded(new lanelet::LaneletMap);
+  lanelet::utils::conversion::fromBinMsg(msg, decoded);
+
+  ASSERT_EQ(corridor_map->laneletLayer.size(), decoded->laneletLayer.size());
+}
+
+}  // namespace carma_wm_ctrl
@@ -48,6 +48,7 @@ namespace cooperative_lanechange
     double mid_fraction = 0.5;
     double min_desired_gap = 5.0;
     double desired_time_gap = 3.0;
+    double max_gap_search_distance = 300.0;
     int turn_downsample_ratio = 0;
     double curve_resample_step_size = 1.0;
     double back_distance = 0.0;
@@ -79,6 +80,7 @@ namespace cooperative_lanechange
            << "mid_fraction: " << c.mid_fraction << std::endl
            << "min_desired_gap: " << c.min_desired_gap << std::endl
            << "desired_time_gap: " << c.desired_time_gap << std::endl
+           << "max_gap_search_distance: " << c.max_gap_search_distance << std::endl
            << "turn_downsample_ratio: " << c.turn_downsample_ratio << std::endl
            << "curve_resample_step_size: " << c.curve_resample_step_size << std::endl
            << "back_distance: " << c.back_distance << std::endl
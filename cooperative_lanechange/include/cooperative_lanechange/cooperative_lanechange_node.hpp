@@ -85,6 +85,9 @@ namespace cooperative_lanechange
     // World Model object
     carma_wm::WorldModelConstPtr wm_;
 
+    // Working buffers reused across trajectory requests
+    basic_autonomy::waypoint_generation::TrajectoryWorkspace trajectory_workspace_;
+
     // Map projection string, which defines the lat/lon -> map conversion
     std::shared_ptr<lanelet::projection::LocalFrameProjector> map_projector_;
 
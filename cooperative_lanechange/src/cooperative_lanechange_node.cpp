@@ -47,6 +47,7 @@ namespace cooperative_lanechange
     config_.mid_fraction = declare_parameter<double>("mid_fraction", config_.mid_fraction);
     config_.min_desired_gap = declare_parameter<double>("min_desired_gap", config_.min_desired_gap);
     config_.desired_time_gap = declare_parameter<double>("desired_time_gap", config_.desired_time_gap);
+    config_.max_gap_search_distance = declare_parameter<double>("max_gap_search_distance", config_.max_gap_search_distance);
     config_.turn_downsample_ratio = declare_parameter<int>("turn_downsample_ratio", config_.turn_downsample_ratio);
     config_.curve_resample_step_size = declare_parameter<double>("curve_resample_step_size", config_.curve_resample_step_size);
     config_.back_distance = declare_parameter<double>("back_distance", config_.back_distance);
@@ -79,7 +80,8 @@ namespace cooperative_lanechange
       {"curve_resample_step_size", config_.curve_resample_step_size},
       {"back_distance", config_.back_distance},
       {"buffer_ending_downtrack", config_.buffer_ending_downtrack},
-      {"desired_time_gap", config_.desired_time_gap}}, parameters);
+      {"desired_time_gap", config_.desired_time_gap},
+      {"max_gap_search_distance", config_.max_gap_search_distance}}, parameters);
       
     auto error_3 = update_params<int>(
       {{"speed_moving_average_window_size", config_.speed_moving_average_window_size},
@@ -124,6 +126,7 @@ namespace cooperative_lanechange
     get_parameter<double>("mid_fraction", config_.mid_fraction);
     get_parameter<double>("min_desired_gap", config_.min_desired_gap);
     get_parameter<double>("desired_time_gap", config_.desired_time_gap);
+    get_parameter<double>("max_gap_search_distance", config_.max_gap_search_distance);
     get_parameter<int>("turn_downsample_ratio", config_.turn_downsample_ratio);
     get_parameter<double>("curve_resample_step_size", config_.curve_resample_step_size);
     get_parameter<double>("back_distance", config_.back_distance);
@@ -206,38 +209,18 @@ namespace cooperative_lanechange
     lanelet::ConstLanelet current_lanelet = current_lanelets[0].second;
     RCLCPP_DEBUG_STREAM(get_logger(), "current llt id " << current_lanelet.id());
         
-    //Create temporary route between the two vehicles
-    lanelet::ConstLanelet start_lanelet = veh2_lanelet;
-    lanelet::ConstLanelet end_lanelet = current_lanelet;
-        
-    auto map_graph = wm_->getMapRoutingGraph();
-    RCLCPP_DEBUG_STREAM(get_logger(), "Graph created");
-
-    auto temp_route = map_graph->getRoute(start_lanelet, end_lanelet);
-    RCLCPP_DEBUG_STREAM(get_logger(), "Route created");
+    double veh1_current_downtrack = carma_wm::geometry::trackPos(current_lanelet, ego_pos).downtrack;
+    RCLCPP_DEBUG_STREAM(get_logger(), "ego_current_downtrack:" << veh1_current_downtrack);
 
-    //Throw exception if there is no shortest path from veh2 to subject vehicle
-    lanelet::routing::LaneletPath shortest_path2;
-    if(temp_route)
+    //Throw exception if the subject vehicle cannot be reached from veh2 within the search distance
+    auto gap = wm_->getLongitudinalGap(veh2_lanelet, veh2_downtrack, current_lanelet, veh1_current_downtrack, config_.max_gap_search_distance);
+    if(!gap)
     {
-      shortest_path2 = temp_route.get().shortestPath();
-    }
-    else{
       RCLCPP_ERROR_STREAM(get_logger(), "No path exists from roadway object to subject");
       throw std::invalid_argument("No path exists from roadway object to subject");
     }
- 
-    RCLCPP_DEBUG_STREAM(get_logger(), "Shorted path created size: " << shortest_path2.size());
-    for (auto llt : shortest_path2)
-    {
-      RCLCPP_DEBUG_STREAM(get_logger(), "llt id  route: " << llt.id());
-    }  
 
-    //To find downtrack- creating temporary route from veh2 to veh1(ego vehicle)
-    double veh1_current_downtrack = wm_->routeTrackPos(ego_pos).downtrack;      
-    RCLCPP_DEBUG_STREAM(get_logger(), "ego_current_downtrack:" << veh1_current_downtrack);
-        
-    current_gap = veh1_current_downtrack - veh2_downtrack;
+    current_gap = gap.get();
     RCLCPP_DEBUG_STREAM(get_logger(), "Finding current gap");
     RCLCPP_DEBUG_STREAM(get_logger(), "Veh1 current downtrack: " << veh1_current_downtrack << " veh2 downtrack: " << veh2_downtrack);
      
@@ -626,7 +609,7 @@ namespace cooperative_lanechange
     auto downsampled_points = carma_ros2_utils::containers::downsample_vector(points_and_target_speeds, config_.downsample_ratio);
 
     std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> trajectory_points = basic_autonomy::waypoint_generation::compose_lanechange_trajectory_from_path(downsampled_points, req->vehicle_state, req->header.stamp,
-                                                                                      wm_, ending_state_before_buffer_, wpg_detail_config);
+                                                                                      wm_, ending_state_before_buffer_, wpg_detail_config, trajectory_workspace_);
     RCLCPP_DEBUG_STREAM(get_logger(), "Compose Trajectory size: " << trajectory_points.size());
     return trajectory_points;
   }
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 LEIDOS.
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+import argparse
+import csv
+import struct
+import sys
+
+# USAGE:
+# This script decodes planning telemetry files written by guidance plugins (see carma_guidance_plugins/planning_telemetry.hpp)
+# into CSV. Telemetry files are written next to slow planning call dumps (telemetry.bin) and on plugin shutdown
+# (<plugin>_telemetry_<stamp>.bin) when the planning_telemetry_capacity parameter is greater than 0.
+#
+# decode_planning_telemetry.py <telemetry file> [--type TYPE] [--plan-id ID] [--output FILE]
+#
+# One row is written per record. Records are ordered by sequence and the value columns are named according to the record type.
+
+MAGIC = b"CARMATLM"
+VERSION = 1
+HEADER = struct.Struct("<8sIIQ")
+RECORD = struct.Struct("<QqQB7x32s6d")
+
+# Must match carma_guidance_plugins::TelemetryRecordType
+RECORD_TYPES = {
+  1: ("maneuver_plan", ["maneuver_type", "start_dist", "end_dist", "start_speed", "end_speed", "duration"]),
+  2: ("trajectory_summary", ["point_count", "duration", "path_length", "start_speed", "end_speed", "max_speed"]),
+  3: ("cost_term", ["value", "weight", "weighted_value", "candidate"]),
+  4: ("decision_branch", ["branch", "input_0", "input_1", "input_2", "input_3", "input_4"]),
+}
+
+def read_records(path):
+  with open(path, "rb") as infile:
+    data = infile.read()
+
+  if len(data) < HEADER.size:
+    raise ValueError(path + " is too short to be a planning telemetry file")
+
+  magic, version, record_size, count = HEADER.unpack_from(data, 0)
+  if magic != MAGIC:
+    raise ValueError(path + " is not a planning telemetry file")
+  if version != VERSION or record_size != RECORD.size:
+    raise ValueError("Unsupported planning telemetry file version " + str(version) + " with record size " + str(record_size))
+  if len(data) < HEADER.size + count * RECORD.size:
+    raise ValueError(path + " is truncated")
+
+  records = []
+  for i in range(count):
+    sequence, stamp_ns, plan_id, record_type, label, *values = RECORD.unpack_from(data, HEADER.size + i * RECORD.size)
+    type_name, value_names = RECORD_TYPES.get(record_type, ("unknown_" + str(record_type), []))
+    records.append({
+      "sequence": sequence,
+      "stamp": stamp_ns / 1e9,
+      "plan_id": plan_id,
+      "type": type_name,
+      "label": label.split(b"\0", 1)[0].decode("utf-8", errors="replace"),
+      "values": {name: values[j] for j, name in enumerate(value_names)},
+    })
+
+  return records
+
+def main():
+  parser = argparse.ArgumentParser(description="Decode a planning telemetry file into CSV")
+  parser.add_argument("file", help="Telemetry file written by a guidance plugin")
+  parser.add_argument("--type", choices=[name for name, _ in RECORD_TYPES.values()], help="Only output records of this type")
+  parser.add_argument("--plan-id", type=int, help="Only output records made during this planning call")
+  parser.add_argument("--output", help="CSV file to write. Defaults to stdout")
+  args = parser.parse_args()
+
+  try:
+    records = read_records(args.file)
+  except ValueError as e:
+    print(e, file=sys.stderr)
+    exit(1)
+
+  records = [r for r in records if (args.type is None or r["type"] == args.type) and (args.plan_id is None or r["plan_id"] == args.plan_id)]
+
+  value_columns = []
+  for _, value_names in RECORD_TYPES.values():
+    value_columns += [name for name in value_names if name not in value_columns]
+
+  outfile = open(args.output, "w", newline="") if args.output else sys.stdout
+  writer = csv.writer(outfile)
+  writer.writerow(["sequence", "stamp", "plan_id", "type", "label"] + value_columns)
+  for r in records:
+    writer.writerow([r["sequence"], "%.9f" % r["stamp"], r["plan_id"], r["type"], r["label"]] + [r["values"].get(name, "") for name in value_columns])
+
+  if args.output:
+    outfile.close()
+
+if __name__ == "__main__":
+  main()
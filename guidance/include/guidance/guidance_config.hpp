@@ -28,12 +28,14 @@ namespace guidance
   struct Config
   {
     double spin_rate_hz = 10.0; // (Hz) The rate at which the Guidance Node will process messages
+    double state_heartbeat_period_s = 1.0; // (s) The period at which an unchanged guidance state is republished
 
     // Stream operator for this config
     friend std::ostream &operator<<(std::ostream &output, const Config &c)
     {
       output << "guidance::Config { " << std::endl
            << "spin_rate_hz: " << c.spin_rate_hz << std::endl
+           << "state_heartbeat_period_s: " << c.state_heartbeat_period_s << std::endl
            << "}" << std::endl;
       return output;
     }
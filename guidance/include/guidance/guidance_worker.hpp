@@ -18,6 +18,7 @@
 
 #include <rclcpp/rclcpp.hpp>
 #include <functional>
+#include <boost/optional.hpp>
 #include <carma_planning_msgs/srv/set_guidance_active.hpp>
 #include <carma_driver_msgs/srv/set_enable_robotic.hpp>
 #include <carma_planning_msgs/msg/guidance_state.hpp>
@@ -63,6 +64,10 @@ namespace guidance
     // Guidance state machine
     GuidanceStateMachine gsm_;
 
+    // Last published guidance state and the time it was published
+    boost::optional<uint8_t> last_published_state_;
+    rclcpp::Time last_state_publish_time_;
+
   public:
     /**
      * \brief GuidanceWorker constructor 
@@ -80,6 +85,12 @@ namespace guidance
      */
     bool spin_cb();
 
+    /**
+     * \brief Publish the current guidance state if it changed since it was last published or the heartbeat period has elapsed.
+     *        Does nothing unless this node is active.
+     */
+    void publish_state();
+
     /**
       * \brief Callback for route event messages
       * \param msg Latest route event message 
@@ -13,6 +13,7 @@
  * License for the specific language governing permissions and limitations under
  * the License.
  */
+#include <lifecycle_msgs/msg/state.hpp>
 #include "guidance/guidance_worker.hpp"
 
 namespace guidance
@@ -28,11 +29,12 @@ namespace guidance
 
     // Declare parameters
     config_.spin_rate_hz = declare_parameter<double>("spin_rate_hz", config_.spin_rate_hz);
+    config_.state_heartbeat_period_s = declare_parameter<double>("state_heartbeat_period_s", config_.state_heartbeat_period_s);
   }
 
   rcl_interfaces::msg::SetParametersResult GuidanceWorker::parameter_update_callback(const std::vector<rclcpp::Parameter> &parameters)
   {
-    auto error = update_params<double>({{"spin_rate_hz", config_.spin_rate_hz}}, parameters);
+    auto error = update_params<double>({{"spin_rate_hz", config_.spin_rate_hz}, {"state_heartbeat_period_s", config_.state_heartbeat_period_s}}, parameters);
 
     rcl_interfaces::msg::SetParametersResult result;
 
@@ -50,6 +52,7 @@ namespace guidance
 
     // Load parameters
     get_parameter<double>("spin_rate_hz", config_.spin_rate_hz);
+    get_parameter<double>("state_heartbeat_period_s", config_.state_heartbeat_period_s);
 
     RCLCPP_INFO_STREAM(get_logger(), "Loaded params: " << config_);
 
@@ -65,7 +68,8 @@ namespace guidance
                                                               std::bind(&GuidanceWorker::vehicle_status_cb, this, std_ph::_1));
 
     // Setup publishers
-    state_publisher_  = create_publisher<carma_planning_msgs::msg::GuidanceState>("state", 5);
+    // The state is latched and only republished on transitions and heartbeats so late joining nodes still receive the current state
+    state_publisher_  = create_publisher<carma_planning_msgs::msg::GuidanceState>("state", rclcpp::QoS(1).reliable().transient_local());
 
     // Setup service clients
     enable_client_  = create_client<carma_driver_msgs::srv::SetEnableRobotic>("enable_robotic");
@@ -112,6 +116,7 @@ namespace guidance
     }
 
     gsm_.onSetGuidanceActive(req->guidance_active);
+    publish_state();
     resp->guidance_status = (gsm_.getCurrentState() == GuidanceStateMachine::ACTIVE);
     return true;  
   }
@@ -124,25 +129,47 @@ namespace guidance
       enable_client_->async_send_request(req);
     }
 
+    publish_state();
+    return true;
+  }
+
+  void GuidanceWorker::publish_state()
+  {
+    if (get_current_state().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+      return;
+
+    uint8_t current_state = gsm_.getCurrentState();
+    auto now = this->now();
+
+    bool changed = !last_published_state_ || last_published_state_.get() != current_state;
+
+    if (!changed && (now - last_state_publish_time_).seconds() < config_.state_heartbeat_period_s)
+      return;
+
     carma_planning_msgs::msg::GuidanceState state;
-    state.state = gsm_.getCurrentState();
+    state.state = current_state;
     state_publisher_->publish(state);
-    return true;
+
+    last_published_state_ = current_state;
+    last_state_publish_time_ = now;
   }
 
   void GuidanceWorker::route_event_cb(carma_planning_msgs::msg::RouteEvent::UniquePtr msg)
   {
     gsm_.onRouteEvent(move(msg));
+    publish_state();
   }
 
   void GuidanceWorker::robot_status_cb(carma_driver_msgs::msg::RobotEnabled::UniquePtr msg)
   {
     gsm_.onRoboticStatus(move(msg));
+    publish_state();
   }
 
   void GuidanceWorker::vehicle_status_cb(autoware_msgs::msg::VehicleStatus::UniquePtr msg)
   {
     gsm_.onVehicleStatus(move(msg));
+    publish_state();
   }
 
 } // guidance
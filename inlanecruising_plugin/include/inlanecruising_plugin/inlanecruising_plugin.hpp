@@ -33,6 +33,7 @@
 #include <autoware_msgs/msg/lane.h>
 #include <rclcpp/rclcpp.hpp>
 #include <carma_debug_ros2_msgs/msg/trajectory_curvature_speeds.hpp>
+#include <carma_guidance_plugins/planning_telemetry.hpp>
 #include <gtest/gtest.h>
 
 namespace inlanecruising_plugin
@@ -84,6 +85,13 @@ public:
    */
   void set_yield_client(carma_ros2_utils::ClientPtr<carma_planning_msgs::srv::PlanTrajectory> client);
 
+  /**
+   * \brief set the telemetry buffer which planning decisions are recorded to
+   *
+   * \param telemetry The plugin node's telemetry buffer. Must outlive this object. nullptr disables recording.
+   */
+  void set_planning_telemetry(carma_guidance_plugins::PlanningTelemetry* telemetry);
+
   carma_planning_msgs::msg::VehicleState ending_state_before_buffer_; //state before applying extra points for curvature calculation that are removed later
 
 private:
@@ -93,8 +101,10 @@ private:
   carma_wm::WorldModelConstPtr wm_;
   InLaneCruisingPluginConfig config_;
   carma_ros2_utils::ClientPtr<carma_planning_msgs::srv::PlanTrajectory> yield_client_;
+  carma_guidance_plugins::PlanningTelemetry* telemetry_ = nullptr;
   DebugPublisher debug_publisher_;
   carma_debug_ros2_msgs::msg::TrajectoryCurvatureSpeeds debug_msg_;
+  basic_autonomy::waypoint_generation::TrajectoryWorkspace trajectory_workspace_; // Reused across trajectory requests
   std::shared_ptr<carma_ros2_utils::CarmaLifecycleNode> nh_;
 
   // Access members for unit test
@@ -99,7 +99,7 @@ void InLaneCruisingPlugin::plan_trajectory_callback(
 
   original_trajectory.trajectory_points = basic_autonomy:: waypoint_generation::compose_lanefollow_trajectory_from_path(points_and_target_speeds,
                                                                                 req->vehicle_state, req->header.stamp, wm_, ending_state_before_buffer_, debug_msg_,
-                                                                                wpg_detail_config); // Compute the trajectory
+                                                                                wpg_detail_config, trajectory_workspace_); // Compute the trajectory
   original_trajectory.initial_longitudinal_velocity = std::max(req->vehicle_state.longitudinal_vel, config_.minimum_speed);
 
   // Set the planning plugin field name
@@ -110,7 +110,16 @@ void InLaneCruisingPlugin::plan_trajectory_callback(
   resp->trajectory_plan = original_trajectory;
 
   // Aside from the flag, ILC should not call yield_plugin on invalid trajectories
-  if (config_.enable_object_avoidance && original_trajectory.trajectory_points.size() >= 2)
+  const bool yield_to_obstacles = config_.enable_object_avoidance && original_trajectory.trajectory_points.size() >= 2;
+
+  if (telemetry_)
+  {
+    telemetry_->record_decision_branch("object_avoidance", yield_to_obstacles,
+                                       { static_cast<double>(config_.enable_object_avoidance),
+                                         static_cast<double>(original_trajectory.trajectory_points.size()) });
+  }
+
+  if (yield_to_obstacles)
   {
     basic_autonomy::waypoint_generation::modify_trajectory_to_yield_to_obstacles(nh_, req, resp, yield_client_, config_.tactical_plugin_service_call_timeout);
   }
@@ -137,5 +146,10 @@ void InLaneCruisingPlugin::set_yield_client(carma_ros2_utils::ClientPtr<carma_pl
   yield_client_ = client;
 }
 
+void InLaneCruisingPlugin::set_planning_telemetry(carma_guidance_plugins::PlanningTelemetry* telemetry)
+{
+  telemetry_ = telemetry;
+}
+
 
 }  // namespace inlanecruising_plugin
\ No newline at end of file
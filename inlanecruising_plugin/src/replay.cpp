@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <carma_guidance_plugins/planning_call_replay.hpp>
+#include <inlanecruising_plugin/inlanecruising_plugin_node.hpp>
+
+// Offline replay of planning calls dumped by this plugin. See carma_guidance_plugins::replay_main
+int main(int argc, char **argv) 
+{
+  return carma_guidance_plugins::replay_main<inlanecruising_plugin::InLaneCruisingPluginNode>(argc, argv);
+}
@@ -263,15 +263,7 @@ LCIStrategicPlugin::VehicleState LCIStrategicPlugin::extractInitialState(carma_p
 
 double LCIStrategicPlugin::findSpeedLimit(const lanelet::ConstLanelet& llt) const
 {
-  lanelet::Optional<carma_wm::TrafficRulesConstPtr> traffic_rules = wm_->getTrafficRules();
-  if (traffic_rules)
-  {
-    return (*traffic_rules)->speedLimit(llt).speedLimit.value();
-  }
-  else
-  {
-    throw std::invalid_argument("Valid traffic rules object could not be built");
-  }
+  return wm_->getSpeedLimit(llt);
 }
 
 bool LCIStrategicPlugin::validLightState(const boost::optional<std::pair<boost::posix_time::ptime, lanelet::CarmaTrafficSignalState>>& optional_state,
@@ -851,11 +843,10 @@ void LCIStrategicPlugin::planWhenAPPROACHING(carma_planning_msgs::srv::PlanManeu
   // All we need to now determine is if we should stop or if we should continue
   lanelet::ConstLanelet intersection_lanelet;
 
-  auto route = wm_->getRoute()->shortestPath();
-  auto entry_llt_iter = std::find(route.begin(), route.end(), entry_lanelet);
-  if (entry_llt_iter != route.end())
+  auto lanelet_after_entry = wm_->nextOnRoute(entry_lanelet.id());
+  if (lanelet_after_entry)
   {
-    intersection_lanelet = *(entry_llt_iter + 1);
+    intersection_lanelet = lanelet_after_entry.get();
   }
 
   if (intersection_lanelet.id() != lanelet::InvalId)
@@ -1323,8 +1314,7 @@ void LCIStrategicPlugin::plan_maneuvers_callback(
   // get the lanelet that is on the route in case overlapping ones found
   for (auto llt : current_lanelets)
   {
-    auto route = wm_->getRoute()->shortestPath();
-    if (std::find(route.begin(), route.end(), llt) != route.end())
+    if (wm_->isOnRoute(llt.id()))
     {
       current_lanelet = llt;
       break;
@@ -128,6 +128,7 @@ namespace light_controlled_intersection_tactical_plugin
 
     std::string plugin_name_;
     carma_debug_ros2_msgs::msg::TrajectoryCurvatureSpeeds debug_msg_;
+    basic_autonomy::waypoint_generation::TrajectoryWorkspace trajectory_workspace_; // Reused across trajectory requests
     std::vector<double> last_final_speeds_;
 
     std::string light_controlled_intersection_strategy_ = "Carma/signalized_intersection"; // Strategy carma-streets is sending. Could be more verbose but needs to be changed on both ends
@@ -73,8 +73,7 @@ namespace light_controlled_intersection_tactical_plugin
         // get the lanelet that is on the route in case overlapping ones found
         for (auto llt : current_lanelets)
         {
-            auto route = wm_->getRoute()->shortestPath();
-            if (std::find(route.begin(), route.end(), llt) != route.end())
+            if (wm_->isOnRoute(llt.id()))
             {
                 current_lanelet = llt;
                 break;
@@ -201,7 +200,7 @@ namespace light_controlled_intersection_tactical_plugin
         // Compose smooth trajectory/speed by resampling
         trajectory.trajectory_points = basic_autonomy::waypoint_generation::compose_lanefollow_trajectory_from_path(points_and_target_speeds,
                                                                                     req->vehicle_state, req->header.stamp, wm_, ending_state_before_buffer_, debug_msg_,
-                                                                                    wpg_detail_config); // Compute the trajectory
+                                                                                    wpg_detail_config, trajectory_workspace_); // Compute the trajectory
 
         // Set the planning plugin field name
         for (auto& p : trajectory.trajectory_points) {
@@ -385,15 +384,7 @@ namespace light_controlled_intersection_tactical_plugin
 
     double LightControlledIntersectionTacticalPlugin::findSpeedLimit(const lanelet::ConstLanelet& llt, const carma_wm::WorldModelConstPtr &wm) const
     {
-        lanelet::Optional<carma_wm::TrafficRulesConstPtr> traffic_rules = wm->getTrafficRules();
-        if (traffic_rules)
-        {
-            return (*traffic_rules)->speedLimit(llt).speedLimit.value();
-        }
-        else
-        {
-            throw std::invalid_argument("Valid traffic rules object could not be built");
-        }
+        return wm->getSpeedLimit(llt);
     }
 
     std::vector<PointSpeedPair> LightControlledIntersectionTacticalPlugin::createGeometryProfile(const std::vector<carma_planning_msgs::msg::Maneuver> &maneuvers, double max_starting_downtrack,const carma_wm::WorldModelConstPtr &wm,
@@ -30,6 +30,7 @@
 #include <carma_v2x_msgs/msg/bsm.hpp>
 
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
+#include <carma_guidance_plugins/guidance_state_gate.hpp>
 #include "mobilitypath_publisher/mobilitypath_publisher_config.hpp"
 
 namespace mobilitypath_publisher
@@ -59,6 +60,9 @@ namespace mobilitypath_publisher
     // Timer for publishing MobilityPath message
     rclcpp::TimerBase::SharedPtr path_pub_timer_;
 
+    // Suspends path_pub_timer_ while guidance is not engaged
+    carma_guidance_plugins::GuidanceStateGate guidance_state_gate_;
+
     // Node configuration
     Config config_;
 
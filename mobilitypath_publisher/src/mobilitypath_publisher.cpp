@@ -64,7 +64,7 @@ namespace mobilitypath_publisher
     bsm_sub_ = create_subscription<carma_v2x_msgs::msg::BSM>("bsm_outbound", 1,
                                                              std::bind(&MobilityPathPublication::bsm_cb, this, std_ph::_1));
     
-    guidance_state_sub_ = create_subscription<carma_planning_msgs::msg::GuidanceState>("guidance_state", 5, std::bind(&MobilityPathPublication::guidance_state_cb, this, std::placeholders::_1));
+    guidance_state_sub_ = create_subscription<carma_planning_msgs::msg::GuidanceState>("guidance_state", carma_guidance_plugins::GuidanceStateGate::qos(), std::bind(&MobilityPathPublication::guidance_state_cb, this, std::placeholders::_1));
 
     georeference_sub_ = create_subscription<std_msgs::msg::String>("georeference", 1,
                                                                    std::bind(&MobilityPathPublication::georeference_cb, this, std_ph::_1));
@@ -80,6 +80,7 @@ namespace mobilitypath_publisher
   void MobilityPathPublication::guidance_state_cb(const carma_planning_msgs::msg::GuidanceState::UniquePtr msg)
   {
     guidance_engaged_ = (msg->state == carma_planning_msgs::msg::GuidanceState::ENGAGED);
+    guidance_state_gate_.on_guidance_state(*msg, get_clock()->now());
   }
 
   carma_ros2_utils::CallbackReturn MobilityPathPublication::handle_on_activate(const rclcpp_lifecycle::State &prev_state)
@@ -90,6 +91,9 @@ namespace mobilitypath_publisher
                                    std::chrono::milliseconds(path_pub_period_millisecs),
                                    std::bind(&MobilityPathPublication::spin_callback, this));
 
+    guidance_state_gate_.clear_timers();
+    guidance_state_gate_.add_timer(path_pub_timer_);
+
     return CallbackReturn::SUCCESS;
   }
 
@@ -57,6 +57,10 @@ struct Config
   // will occur (objects may be duplicated)
   bool enable_sensor_processing = false;
 
+  // If true then sensor ExternalObjects which already contain predictions (such as those
+  // produced from cooperative perception tracks) are passed through without being predicted again
+  bool enable_sensor_prediction_passthrough = false;
+
   // Stream operator for this config
   friend std::ostream & operator<<(std::ostream & output, const Config & c)
   {
@@ -72,6 +76,8 @@ struct Config
            << "enable_psm_processing: " << c.enable_psm_processing << std::endl
            << "enable_mobility_path_processing: " << c.enable_mobility_path_processing << std::endl
            << "enable_sensor_processing: " << c.enable_sensor_processing << std::endl
+           << "enable_sensor_prediction_passthrough: " << c.enable_sensor_prediction_passthrough
+           << std::endl
            << "}" << std::endl;
     return output;
   }
@@ -73,6 +73,7 @@ public:
   void setDetectionInputFlags(
     bool enable_sensor_processing, bool enable_bsm_processing, bool enable_psm_processing,
     bool enable_mobility_path_processing);
+  void setSensorPredictionPassthrough(bool enable_passthrough);
 
   // callbacks
   void mobilityPathCallback(const carma_v2x_msgs::msg::MobilityPath::UniquePtr msg);
@@ -140,6 +141,9 @@ private:
   bool enable_psm_processing_ = false;
   bool enable_mobility_path_processing_ = false;
 
+  // If true, sensor objects which already have predictions keep them instead of being re-predicted
+  bool enable_sensor_prediction_passthrough_ = false;
+
   // Map frame
   std::string map_frame_id_ = "map";
 
@@ -50,6 +50,8 @@ MotionComputationNode::MotionComputationNode(const rclcpp::NodeOptions & options
     "enable_mobility_path_processing", config_.enable_mobility_path_processing);
   config_.enable_sensor_processing =
     declare_parameter<bool>("enable_sensor_processing", config_.enable_sensor_processing);
+  config_.enable_sensor_prediction_passthrough = declare_parameter<bool>(
+    "enable_sensor_prediction_passthrough", config_.enable_sensor_prediction_passthrough);
 }
 
 rcl_interfaces::msg::SetParametersResult MotionComputationNode::parameter_update_callback(
@@ -68,7 +70,8 @@ rcl_interfaces::msg::SetParametersResult MotionComputationNode::parameter_update
     {{"enable_bsm_processing", config_.enable_bsm_processing},
      {"enable_psm_processing", config_.enable_psm_processing},
      {"enable_mobility_path_processing", config_.enable_mobility_path_processing},
-     {"enable_sensor_processing", config_.enable_sensor_processing}},
+     {"enable_sensor_processing", config_.enable_sensor_processing},
+     {"enable_sensor_prediction_passthrough", config_.enable_sensor_prediction_passthrough}},
     parameters);
 
   rcl_interfaces::msg::SetParametersResult result;
@@ -86,6 +89,7 @@ rcl_interfaces::msg::SetParametersResult MotionComputationNode::parameter_update
     motion_worker_.setDetectionInputFlags(
       config_.enable_sensor_processing, config_.enable_bsm_processing,
       config_.enable_psm_processing, config_.enable_mobility_path_processing);
+    motion_worker_.setSensorPredictionPassthrough(config_.enable_sensor_prediction_passthrough);
   }
 
   return result;
@@ -110,6 +114,8 @@ carma_ros2_utils::CallbackReturn MotionComputationNode::handle_on_configure(
   get_parameter<bool>("enable_psm_processing", config_.enable_psm_processing);
   get_parameter<bool>("enable_mobility_path_processing", config_.enable_mobility_path_processing);
   get_parameter<bool>("enable_sensor_processing", config_.enable_sensor_processing);
+  get_parameter<bool>(
+    "enable_sensor_prediction_passthrough", config_.enable_sensor_prediction_passthrough);
 
   RCLCPP_INFO_STREAM(get_logger(), "Loaded params: " << config_);
 
@@ -152,6 +158,7 @@ carma_ros2_utils::CallbackReturn MotionComputationNode::handle_on_configure(
   motion_worker_.setDetectionInputFlags(
     config_.enable_sensor_processing, config_.enable_bsm_processing, config_.enable_psm_processing,
     config_.enable_mobility_path_processing);
+  motion_worker_.setSensorPredictionPassthrough(config_.enable_sensor_prediction_passthrough);
 
   // Return success if everything initialized successfully
   return CallbackReturn::SUCCESS;
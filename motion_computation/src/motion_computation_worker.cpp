@@ -36,6 +36,15 @@ void MotionComputationWorker::predictionLogic(
   sensor_list.header = obj_list->header;
 
   for (auto obj : obj_list->objects) {
+    if (
+      enable_sensor_prediction_passthrough_ &&
+      (obj.presence_vector & carma_perception_msgs::msg::ExternalObject::PREDICTION_PRESENCE_VECTOR) &&
+      !obj.predictions.empty()) {
+      // The upstream source already propagated this object with its own motion model
+      sensor_list.objects.emplace_back(obj);
+      continue;
+    }
+
     // Header contains the frame rest of the fields will use
     // obj.header = obj_list.objects[i].header;
 
@@ -184,6 +193,11 @@ void MotionComputationWorker::setDetectionInputFlags(
   enable_mobility_path_processing_ = enable_mobility_path_processing;
 }
 
+void MotionComputationWorker::setSensorPredictionPassthrough(bool enable_passthrough)
+{
+  enable_sensor_prediction_passthrough_ = enable_passthrough;
+}
+
 void MotionComputationWorker::mobilityPathCallback(
   const carma_v2x_msgs::msg::MobilityPath::UniquePtr msg)
 {
@@ -166,6 +166,48 @@ TEST(MotionComputationWorker, MotionPredictionCallback)
   ASSERT_EQ(published_data, true);
 }
 
+TEST(MotionComputationWorker, SensorPredictionPassthrough)
+{
+  auto node = std::make_shared<rclcpp::Node>("test_node");
+  rclcpp::node_interfaces::NodeLoggingInterface::SharedPtr logger =
+    node->get_node_logging_interface();
+  rclcpp::node_interfaces::NodeClockInterface::SharedPtr clock = node->get_node_clock_interface();
+
+  carma_perception_msgs::msg::ExternalObjectList published;
+  MotionComputationWorker worker(
+    [&](const carma_perception_msgs::msg::ExternalObjectList & obj_pub) { published = obj_pub; },
+    logger, clock);
+  worker.setDetectionInputFlags(true, false, false, false);  // SENSORS_ONLY
+
+  carma_perception_msgs::msg::ExternalObject predicted_obj;
+  predicted_obj.object_type = predicted_obj.SMALL_VEHICLE;
+  predicted_obj.velocity.twist.linear.x = 5.0;
+  carma_perception_msgs::msg::PredictedState upstream_prediction;
+  upstream_prediction.predicted_position.position.x = 42.0;
+  predicted_obj.predictions.push_back(upstream_prediction);
+  predicted_obj.presence_vector |= predicted_obj.PREDICTION_PRESENCE_VECTOR;
+
+  carma_perception_msgs::msg::ExternalObject unpredicted_obj = predicted_obj;
+  unpredicted_obj.predictions.clear();
+  unpredicted_obj.presence_vector &= ~unpredicted_obj.PREDICTION_PRESENCE_VECTOR;
+
+  carma_perception_msgs::msg::ExternalObjectList obj_list;
+  obj_list.objects = {predicted_obj, unpredicted_obj};
+
+  // Passthrough disabled by default so all objects are predicted
+  worker.predictionLogic(std::make_unique<carma_perception_msgs::msg::ExternalObjectList>(obj_list));
+  ASSERT_EQ(2ul, published.objects.size());
+  ASSERT_GT(published.objects[0].predictions.size(), 1ul);
+
+  // Existing predictions are kept when passthrough is enabled
+  worker.setSensorPredictionPassthrough(true);
+  worker.predictionLogic(std::make_unique<carma_perception_msgs::msg::ExternalObjectList>(obj_list));
+  ASSERT_EQ(2ul, published.objects.size());
+  ASSERT_EQ(1ul, published.objects[0].predictions.size());
+  ASSERT_NEAR(42.0, published.objects[0].predictions[0].predicted_position.position.x, 0.0001);
+  ASSERT_GT(published.objects[1].predictions.size(), 1ul);
+}
+
 TEST(MotionComputationWorker, ComposePredictedState)
 {
   auto node = std::make_shared<rclcpp::Node>("test_node");
@@ -24,6 +24,7 @@
 #include <carma_planning_msgs/msg/upcoming_lane_change_status.hpp>
 #include <carma_planning_msgs/srv/plan_trajectory.hpp>
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
+#include <carma_guidance_plugins/guidance_state_gate.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <geometry_msgs/msg/twist_stamped.hpp>
 #include <autoware_msgs/msg/lamp_cmd.hpp>
@@ -153,9 +154,10 @@ namespace plan_delegator
             std::shared_ptr<carma_planning_msgs::srv::PlanTrajectory::Request> composePlanTrajectoryRequest(const carma_planning_msgs::msg::TrajectoryPlan& latest_trajectory_plan, const uint16_t& current_maneuver_index) const;
 
             /**
-             * \brief Lookup transfrom from front bumper to base link
+             * \brief Lookup transfrom from front bumper to base link without blocking. Releases the TF listener once the transform is found.
+             * \return True if the transform was found
              */
-            void lookupFrontBumperTransform();
+            bool lookupFrontBumperTransform();
 
             /**
              * \brief Update the starting downtrack, ending downtrack, and maneuver-specific Lanelet ID parameters associated 
@@ -200,6 +202,9 @@ namespace plan_delegator
 
             rclcpp::TimerBase::SharedPtr traj_timer_;
 
+            // Suspends traj_timer_ while guidance is not engaged
+            carma_guidance_plugins::GuidanceStateGate guidance_state_gate_;
+
             bool guidance_engaged = false;
 
             double length_to_front_bumper_ = 3.0;
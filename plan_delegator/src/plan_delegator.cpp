@@ -170,8 +170,10 @@ namespace plan_delegator
         twist_sub_ = create_subscription<geometry_msgs::msg::TwistStamped>("current_velocity", 5,
             [this](geometry_msgs::msg::TwistStamped::UniquePtr twist) {this->latest_twist_ = *twist;});
         pose_sub_ = create_subscription<geometry_msgs::msg::PoseStamped>("current_pose", 5, std::bind(&PlanDelegator::poseCallback, this, std_ph::_1));
-        guidance_state_sub_ = create_subscription<carma_planning_msgs::msg::GuidanceState>("guidance_state", 5,  std::bind(&PlanDelegator::guidanceStateCallback, this, std_ph::_1));
+        guidance_state_sub_ = create_subscription<carma_planning_msgs::msg::GuidanceState>("guidance_state", carma_guidance_plugins::GuidanceStateGate::qos(), std::bind(&PlanDelegator::guidanceStateCallback, this, std_ph::_1));
 
+        tf2_listener_.reset(new tf2_ros::TransformListener(tf2_buffer_));
+        tf2_buffer_.setUsingDedicatedThread(true);
         lookupFrontBumperTransform();
         wm_ = wml_.getWorldModel();
         return CallbackReturn::SUCCESS;
@@ -182,12 +184,17 @@ namespace plan_delegator
         traj_timer_ = create_timer(get_clock(),
             std::chrono::milliseconds((int)(1 / config_.trajectory_planning_rate * 1000)),
             std::bind(&PlanDelegator::onTrajPlanTick, this));
+
+        guidance_state_gate_.clear_timers();
+        guidance_state_gate_.add_timer(traj_timer_);
+
          return CallbackReturn::SUCCESS;
     }
 
     void PlanDelegator::guidanceStateCallback(carma_planning_msgs::msg::GuidanceState::UniquePtr msg)
     {
         guidance_engaged = (msg->state == carma_planning_msgs::msg::GuidanceState::ENGAGED);
+        guidance_state_gate_.on_guidance_state(*msg, get_clock()->now());
     }
 
     void PlanDelegator::maneuverPlanCallback(carma_planning_msgs::msg::ManeuverPlan::UniquePtr plan)
@@ -245,6 +252,12 @@ namespace plan_delegator
     {
         latest_pose_ = *pose_msg;
 
+        // Retry the static front bumper lookup until it succeeds instead of blocking configuration on it
+        if (tf2_listener_)
+        {
+            lookupFrontBumperTransform();
+        }
+
         // Publish the upcoming lane change status
         publishUpcomingLaneChangeStatus(upcoming_lane_change_information_);
 
@@ -500,8 +513,7 @@ namespace plan_delegator
                 // pick a lanelet on the shortest path
                 for (const auto& llt : previous_lanelets)
                 {
-                    auto route = wm_->getRoute()->shortestPath();
-                    if (std::find(route.begin(), route.end(), llt) != route.end())
+                    if (wm_->isOnRoute(llt.id()))
                     {
                         previous_lanelet_to_add = llt;
                         break;
@@ -707,20 +719,22 @@ namespace plan_delegator
         }
     }
 
-    void PlanDelegator::lookupFrontBumperTransform()
+    bool PlanDelegator::lookupFrontBumperTransform()
     {
-        tf2_listener_.reset(new tf2_ros::TransformListener(tf2_buffer_));
-        tf2_buffer_.setUsingDedicatedThread(true);
         try
         {
-            geometry_msgs::msg::TransformStamped tf = tf2_buffer_.lookupTransform("base_link", "vehicle_front", rclcpp::Time(0), rclcpp::Duration(20.0, 0)); //save to local copy of transform 20 sec timeout
+            geometry_msgs::msg::TransformStamped tf = tf2_buffer_.lookupTransform("base_link", "vehicle_front", tf2::TimePointZero); // non-blocking, the transform is static
             length_to_front_bumper_ = tf.transform.translation.x;
             RCLCPP_DEBUG_STREAM(rclcpp::get_logger("plan_delegator"),"length_to_front_bumper_: " << length_to_front_bumper_);
 
+            // The offset is static so the listener is no longer needed
+            tf2_listener_.reset();
+            return true;
         }
         catch (const tf2::TransformException &ex)
         {
-            RCLCPP_WARN_STREAM(rclcpp::get_logger("plan_delegator"), ex.what());
+            RCLCPP_WARN_STREAM_THROTTLE(rclcpp::get_logger("plan_delegator"), *get_clock(), 5000, "Using default length_to_front_bumper_ of " << length_to_front_bumper_ << " until the transform is available: " << ex.what());
+            return false;
         }
     }
 
@@ -167,15 +167,7 @@ namespace platoon_strategic_ihp
     {
         double target_speed = 0.0;
 
-        lanelet::Optional<carma_wm::TrafficRulesConstPtr> traffic_rules = wm_->getTrafficRules();
-        if (traffic_rules)
-        {
-            target_speed =(*traffic_rules)->speedLimit(llt).speedLimit.value();
-        }
-        else
-        {
-            throw std::invalid_argument("Valid traffic rules object could not be built");
-        }
+        target_speed = wm_->getSpeedLimit(llt);
 
         RCLCPP_DEBUG_STREAM(rclcpp::get_logger("platoon_strategic_ihp"), "target speed (limit) " << target_speed);
         
@@ -3245,9 +3237,6 @@ namespace platoon_strategic_ihp
             return true;
         }
 
-        // locate lanelet on shortest path
-        auto shortest_path = wm_->getRoute()->shortestPath(); // find path amoung route
-
         // read status data
         double current_progress = wm_->routeTrackPos(current_loc).downtrack;
         double speed_progress = current_speed_;
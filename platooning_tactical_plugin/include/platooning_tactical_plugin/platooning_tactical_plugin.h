@@ -82,6 +82,7 @@ private:
   PlatooningTacticalPluginConfig config_;
 
   carma_debug_ros2_msgs::msg::TrajectoryCurvatureSpeeds debug_msg_;
+  basic_autonomy::waypoint_generation::TrajectoryWorkspace trajectory_workspace_; // Reused across trajectory requests
   DebugPublisher debug_publisher_;
 
   carma_planning_msgs::msg::VehicleState ending_state_before_buffer; //state before applying extra points for curvature calculation that are removed later
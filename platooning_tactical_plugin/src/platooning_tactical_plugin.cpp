@@ -96,7 +96,7 @@ bool PlatooningTacticalPlugin::plan_trajectory_cb(carma_planning_msgs::srv::Plan
   original_trajectory.trajectory_id = boost::uuids::to_string(boost::uuids::random_generator()());
   original_trajectory.trajectory_points = basic_autonomy:: waypoint_generation::compose_lanefollow_trajectory_from_path(points_and_target_speeds, 
                                                                                 req.vehicle_state, req.header.stamp, wm_, ending_state_before_buffer_, debug_msg_, 
-                                                                                wpg_detail_config); // Compute the trajectory
+                                                                                wpg_detail_config, trajectory_workspace_); // Compute the trajectory
   original_trajectory.initial_longitudinal_velocity = std::max(req.vehicle_state.longitudinal_vel, config_.minimum_speed);
 
   resp.trajectory_plan = original_trajectory;
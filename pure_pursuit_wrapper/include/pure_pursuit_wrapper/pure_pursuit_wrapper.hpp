@@ -79,6 +79,12 @@ class PurePursuitWrapperNode : public carma_guidance_plugins::ControlPlugin
 
     std::shared_ptr<pure_pursuit::PurePursuit> pp_;
 
+    // Trajectory converted for pure pursuit along with the inputs it was generated from
+    boost::optional<autoware_auto_msgs::msg::Trajectory> processed_trajectory_;
+    std::string processed_trajectory_id_;
+    builtin_interfaces::msg::Time processed_trajectory_stamp_;
+    double processed_response_lag_ = 0.0;
+
     std::shared_ptr<pure_pursuit::PurePursuit> get_pure_pursuit_worker()
     {
         return pp_;
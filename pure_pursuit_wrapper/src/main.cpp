@@ -14,6 +14,7 @@
  * the License.
  */
 #include <pure_pursuit_wrapper/pure_pursuit_wrapper.hpp>
+#include <carma_guidance_plugins/realtime_profile.hpp>
 
 // Main execution
 int main(int argc, char** argv)
@@ -23,9 +24,8 @@ int main(int argc, char** argv)
   
   auto node = std::make_shared<pure_pursuit_wrapper::PurePursuitWrapperNode>(rclcpp::NodeOptions());
   
-  rclcpp::executors::MultiThreadedExecutor executor;
-  executor.add_node(node->get_node_base_interface());
-  executor.spin();
+  carma_guidance_plugins::spin_with_realtime_profile(node->get_node_base_interface(),
+    carma_guidance_plugins::get_realtime_profile_parameters(node->get_node_parameters_interface()), node->get_logger());
 
   rclcpp::shutdown();
 };
\ No newline at end of file
@@ -143,9 +143,18 @@ autoware_msgs::msg::ControlCommandStamped PurePursuitWrapperNode::generate_comma
 
   current_trajectory_.get().header.frame_id = state_tf.header.frame_id;
 
-  auto autoware_traj_plan = basic_autonomy::waypoint_generation::process_trajectory_plan(current_trajectory_.get(), config_.vehicle_response_lag);
+  // The converted trajectory only changes when a new plan arrives so it is reused between command cycles
+  const auto& trajectory = current_trajectory_.get();
+  if (!processed_trajectory_ || trajectory.trajectory_id != processed_trajectory_id_ ||
+      trajectory.header.stamp != processed_trajectory_stamp_ || config_.vehicle_response_lag != processed_response_lag_)
+  {
+    processed_trajectory_ = basic_autonomy::waypoint_generation::process_trajectory_plan(trajectory, config_.vehicle_response_lag);
+    processed_trajectory_id_ = trajectory.trajectory_id;
+    processed_trajectory_stamp_ = trajectory.header.stamp;
+    processed_response_lag_ = config_.vehicle_response_lag;
+  }
 
-  pp_->set_trajectory(autoware_traj_plan);
+  pp_->set_trajectory(processed_trajectory_.get());
 
   const auto cmd{pp_->compute_command(state_tf)};
   
@@ -46,6 +46,9 @@
 #include <math.h>
 #include <unordered_set>
 #include <functional>
+#include <ctime>
+#include <map>
+#include <memory>
 #include <tf2_ros/transform_listener.h>
 #include <tf2/LinearMath/Transform.h>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.h>
@@ -54,6 +57,33 @@
 
 namespace route {
 
+    /**
+     * \brief Precomputed data for a single route file. The map frame destinations only depend on the file contents and the
+     *        map projection, while the resolved route is only valid for the map version it was computed on. Routes are resolved
+     *        when they are selected with the vehicle in the lanelet of the first destination and reused by later such selections
+     *        until the map changes. Other selections route from the vehicle only.
+     */
+    struct RouteCatalogEntry
+    {
+        std::string route_id;
+        // Name of the final destination. Routes without a name are not offered for selection.
+        std::string route_name;
+        // Modification time and size of the route file when it was loaded
+        std::time_t last_write_time = 0;
+        boost::uintmax_t file_size = 0;
+        std::vector<carma_v2x_msgs::msg::Position3D> gps_destination_points;
+        // Destination points in the map frame. Only valid if destinations_projected is true
+        std::vector<lanelet::BasicPoint3d> destination_points;
+        bool destinations_projected = false;
+        // Route through all destinations starting from the first one. Only valid if route_cached is true
+        bool route_cached = false;
+        size_t map_version = 0;
+        carma_planning_msgs::msg::Route route_msg;
+        visualization_msgs::msg::Marker route_marker_msg;
+        // Length in meters of the shortest path from the first to the last destination
+        double route_length = 0.0;
+    };
+
     class RouteGeneratorWorker
     {
 
@@ -134,9 +164,12 @@ namespace route {
                                 std::shared_ptr<carma_planning_msgs::srv::AbortActiveRoute::Response> resp);
 
         /**
-         * \brief Callback for the front bumper pose transform
+         * \brief Callback for the current pose subscriber. Computes the front bumper pose from the vehicle pose and the static
+         *        base_link to vehicle_front transform, updates the route tracking and publishes the front bumper pose and route state
+         *        stamped with the time of the localization update.
+         * \param msg Latest pose of base_link in the map frame
          */
-        void bumperPoseCb();
+        void poseCb(geometry_msgs::msg::PoseStamped::UniquePtr msg);
 
         /**
          * \brief Callback for the twist subscriber, which will store latest twist locally
@@ -151,11 +184,29 @@ namespace route {
         void georeferenceCb(std_msgs::msg::String::UniquePtr msg);
 
         /**
-         * \brief Set method for configurable parameter
+         * \brief Set method for configurable parameter. The route catalog is rebuilt for the new location.
          * \param path The location of route files
          */
         void setRouteFilePath(const std::string& path);
 
+        /**
+         * \brief Bring the route catalog in line with the route file directory. Only new or modified route files are read and
+         *        only entries whose projection is out of date are recomputed. Routes are not resolved here.
+         * \return False if the route file directory does not exist
+         */
+        bool refreshRouteCatalog();
+
+        /**
+         * \brief Callback for world model map updates. Marks all cached routes as stale since they may no longer be valid for the new map.
+         *        Stale routes are resolved again when they are selected.
+         */
+        void onMapUpdate();
+
+        /**
+         * \brief Get the current route catalog keyed by route id
+         */
+        const std::map<std::string, RouteCatalogEntry>& getRouteCatalog() const;
+
         /**
          * \brief Set method for configurable parameter
          * \param dt_dest_range Minimum down track error which can trigger route complete event
@@ -168,11 +219,13 @@ namespace route {
          * \param route_state_pub Route state publisher
          * \param route_pub Route publisher
          * \param route_marker_pub Route marker publisher
+         * \param front_bumper_pose_pub Front bumper pose publisher
          */
         void setPublishers(const carma_ros2_utils::PubPtr<carma_planning_msgs::msg::RouteEvent>& route_event_pub,
                         const carma_ros2_utils::PubPtr<carma_planning_msgs::msg::RouteState>& route_state_pub,
                         const carma_ros2_utils::PubPtr<carma_planning_msgs::msg::Route>& route_pub,
-                        const carma_ros2_utils::PubPtr<visualization_msgs::msg::Marker>& route_marker_pub);
+                        const carma_ros2_utils::PubPtr<visualization_msgs::msg::Marker>& route_marker_pub,
+                        const carma_ros2_utils::PubPtr<geometry_msgs::msg::PoseStamped>& front_bumper_pose_pub);
         
         /**
          * \brief Helper function to check whether a route's shortest path contains any duplicate Lanelet IDs.
@@ -210,6 +263,13 @@ namespace route {
          */
         visualization_msgs::msg::Marker composeRouteMarkerMsg(const lanelet::Optional<lanelet::routing::Route>& route);
 
+        /**
+         * \brief Helper function to compute the length of a route's shortest path between the start of the route and its end point
+         * \param route Route object from lanelet2 lib routing function with its end point set
+         * \param start Start point of the route in the map frame
+         */
+        double computeRouteLength(const lanelet::routing::Route& route, const lanelet::BasicPoint2d& start) const;
+
         /**
         * \brief crosstrackErrorCheck is a function that determines when the vehicle has left the route and reports when a crosstrack error has
         * taken place
@@ -252,7 +312,7 @@ namespace route {
         lanelet::Optional<lanelet::routing::Route> rerouteAfterRouteInvalidation(const std::vector<lanelet::BasicPoint2d>& destination_points_in_map);
 
         /**
-         * \brief Initialize transform lookup from front bumper to map
+         * \brief Initialize transform lookup from base_link to front bumper. The listener is released once the static transform has been found.
          */
         void initializeBumperTransformLookup();
 
@@ -315,6 +375,7 @@ namespace route {
         carma_ros2_utils::PubPtr<carma_planning_msgs::msg::RouteState> route_state_pub_;
         carma_ros2_utils::PubPtr<carma_planning_msgs::msg::Route> route_pub_;
         carma_ros2_utils::PubPtr<visualization_msgs::msg::Marker> route_marker_pub_;
+        carma_ros2_utils::PubPtr<geometry_msgs::msg::PoseStamped> front_bumper_pose_pub_;
 
         // a bool flag indicates a new route has been generated such that a local copy of Route message should be published again
         bool new_route_msg_generated_ = false;
@@ -340,8 +401,33 @@ namespace route {
         // The current map projection for lat/lon to map frame conversion
         boost::optional<std::string> map_proj_;
 
-        geometry_msgs::msg::TransformStamped tf_;
-        tf2::Stamped<tf2::Transform> frontbumper_transform_;
+        // Projector built from map_proj_ so it is not rebuilt for every conversion
+        std::unique_ptr<lanelet::projection::LocalFrameProjector> projector_;
+
+        // Route files in route_file_path_ keyed by route id
+        std::map<std::string, RouteCatalogEntry> route_catalog_;
+
+        // private helper function to reload a catalog entry if its route file changed and recompute its out of date fields.
+        // The route through the destinations is only resolved if resolve_route is true.
+        RouteCatalogEntry* updateRouteCatalogEntry(const std::string& route_id, const boost::filesystem::path& file_path, bool resolve_route);
+
+        // private helper function to make the provided route the active route and transition to route following
+        void startRoute(const carma_planning_msgs::msg::Route& route_msg, const visualization_msgs::msg::Marker& route_marker_msg, const std::string& route_name);
+
+        // private helper function to load route destination points from the route file at the given path
+        std::vector<carma_v2x_msgs::msg::Position3D> loadRouteDestinationGpsPointsFromFile(const std::string& route_file_name) const;
+
+        // private helper function to build the marker for a route without touching the marker publication state
+        visualization_msgs::msg::Marker buildRouteMarker(const lanelet::routing::Route& route) const;
+
+        // Static transform from base_link to the front bumper once it has been received
+        boost::optional<tf2::Transform> base_to_front_bumper_;
+
+        // private helper function to update the route tracking and check for route events based on the latest vehicle_pose_
+        void updateRouteTracking();
+
+        // private helper function to publish the route state stamped with the provided time
+        void publishRouteState(const rclcpp::Time& stamp);
 
         // TF listenser
         tf2_ros::Buffer& tf2_buffer_;
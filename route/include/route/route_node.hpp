@@ -54,12 +54,14 @@ namespace route
     // Subscribers
     carma_ros2_utils::SubPtr<geometry_msgs::msg::TwistStamped> twist_sub_;
     carma_ros2_utils::SubPtr<std_msgs::msg::String> geo_sub_;
+    carma_ros2_utils::SubPtr<geometry_msgs::msg::PoseStamped> pose_sub_;
 
     // Publishers
     carma_ros2_utils::PubPtr<carma_planning_msgs::msg::Route> route_pub_;
     carma_ros2_utils::PubPtr<carma_planning_msgs::msg::RouteState> route_state_pub_;
     carma_ros2_utils::PubPtr<carma_planning_msgs::msg::RouteEvent> route_event_pub_;
     carma_ros2_utils::PubPtr<visualization_msgs::msg::Marker> route_marker_pub_;
+    carma_ros2_utils::PubPtr<geometry_msgs::msg::PoseStamped> front_bumper_pose_pub_;
 
     // Service Servers
     carma_ros2_utils::ServicePtr<carma_planning_msgs::srv::GetAvailableRoutes> get_available_route_srv_;
@@ -98,6 +100,7 @@ namespace route
     ////
     carma_ros2_utils::CallbackReturn handle_on_configure(const rclcpp_lifecycle::State &);
     carma_ros2_utils::CallbackReturn handle_on_activate(const rclcpp_lifecycle::State &);
+    carma_ros2_utils::CallbackReturn handle_on_deactivate(const rclcpp_lifecycle::State &);
   };
 
 } // route
@@ -78,55 +78,24 @@ namespace route {
                                 std::shared_ptr<carma_planning_msgs::srv::GetAvailableRoutes::Response> resp)
     {   
         // Return if the the directory specified by route_file_path_ does not exist
-        if(!boost::filesystem::exists(boost::filesystem::path(this->route_file_path_)))
+        if(!refreshRouteCatalog())
         {
             RCLCPP_ERROR_STREAM(logger_->get_logger(), "No directory exists at " << route_file_path_);
             return true;
         }
- 
-        // Read all route files in the given directory
-        boost::filesystem::directory_iterator end_point;
-        for(boost::filesystem::directory_iterator itr(boost::filesystem::path(this->route_file_path_)); itr != end_point; ++itr)
+
+        // Routes without a destination name are not offered for selection
+        for(const auto& id_entry : route_catalog_)
         {
-            // Skip if the iterator has landed on a folder
-            if(boost::filesystem::is_directory(itr->status()))
+            if(id_entry.second.route_name.empty())
             {
                 continue;
             }
 
-            auto full_file_name = itr->path().filename().generic_string();
             carma_planning_msgs::msg::Route route_msg;
-
-            // Skip if '.csv' is not found in the file name
-            if(full_file_name.find(".csv") == std::string::npos)
-            { 
-                continue;
-            }          
-
-            // Assume route files ending with ".csv", before that is the actual route name
-            route_msg.route_id = full_file_name.substr(0, full_file_name.find(".csv"));
-            std::ifstream fin(itr->path().generic_string());
-            std::string dest_name;
-            if(fin.is_open())
-            {
-                while (!fin.eof())
-                {
-                    std::string temp;
-                    std::getline(fin, temp);
-                    if(temp != "") dest_name = temp;
-                }
-                fin.close();
-            } 
-            else
-            {
-                RCLCPP_ERROR_STREAM(logger_->get_logger(), "File open failed...");
-            }
-            auto last_comma = dest_name.find_last_of(',');
-            if(!std::isdigit(dest_name.substr(last_comma + 1).at(0)))
-            {
-                route_msg.route_name = dest_name.substr(last_comma + 1);
-                resp->available_routes.push_back(move(route_msg));
-            }
+            route_msg.route_id = id_entry.second.route_id;
+            route_msg.route_name = id_entry.second.route_name;
+            resp->available_routes.push_back(move(route_msg));
         }
             
         //after route path object is available to select, worker will able to transit state and provide route selection service
@@ -142,6 +111,8 @@ namespace route {
     void RouteGeneratorWorker::setRouteFilePath(const std::string& path)
     {
         this->route_file_path_ = path;
+        route_catalog_.clear();
+        refreshRouteCatalog();
         // after route path is set, worker will able to transit state and provide route selection service
         this->rs_worker_.onRouteEvent(RouteStateWorker::RouteEvent::ROUTE_LOADED);
         publishRouteEvent(carma_planning_msgs::msg::RouteEvent::ROUTE_LOADED);
@@ -185,11 +156,15 @@ namespace route {
 
         // load destination points in map frame
         std::vector<lanelet::BasicPoint3d> destination_points;
+        const RouteCatalogEntry* catalog_entry = nullptr;
         if(req->choice == carma_planning_msgs::srv::SetActiveRoute::Request::ROUTE_ID)
         {   
             RCLCPP_INFO_STREAM(logger_->get_logger(), "set_active_route_cb: Selected Route ID: " << req->route_id);
-            std::vector<carma_v2x_msgs::msg::Position3D> gps_destination_points = loadRouteDestinationGpsPointsFromRouteId(req->route_id);
-            destination_points = loadRouteDestinationsInMapFrame(gps_destination_points);
+            catalog_entry = updateRouteCatalogEntry(req->route_id, boost::filesystem::path(route_file_path_ + req->route_id + ".csv"), false);
+            if(catalog_entry && catalog_entry->destinations_projected)
+            {
+                destination_points = catalog_entry->destination_points;
+            }
         }
         else if(req->choice == carma_planning_msgs::srv::SetActiveRoute::Request::DESTINATION_POINTS_ARRAY)
         {
@@ -240,8 +215,31 @@ namespace route {
             idx ++;
         }
             
-        // get route graph from world model object
-        auto p = world_model_->getMapRoutingGraph();
+        // The catalog route starts at the first destination. It can be used as is when the vehicle starts in the same lanelet
+        // since routing from the vehicle through that destination gives the same lanelet path. Otherwise the catalog route is not
+        // resolved at all so that only the route from the vehicle is computed.
+        if(catalog_entry)
+        {
+            auto vehicle_lanelet = lanelet::geometry::findNearest(world_model_->getMap()->laneletLayer, vehicle_position, 1);
+            auto first_destination_lanelet = lanelet::geometry::findNearest(world_model_->getMap()->laneletLayer, destination_points_in_map_.front(), 1);
+
+            if(!vehicle_lanelet.empty() && !first_destination_lanelet.empty()
+                && vehicle_lanelet[0].second.id() == first_destination_lanelet[0].second.id())
+            {
+                // Resolve the catalog route now if it is missing or was invalidated by a map update
+                catalog_entry = updateRouteCatalogEntry(req->route_id, boost::filesystem::path(route_file_path_ + req->route_id + ".csv"), true);
+
+                if(catalog_entry && catalog_entry->route_cached && catalog_entry->map_version == world_model_->getMapVersion()
+                    && !catalog_entry->route_msg.shortest_path_lanelet_ids.empty()
+                    && vehicle_lanelet[0].second.id() == catalog_entry->route_msg.shortest_path_lanelet_ids.front())
+                {
+                    RCLCPP_INFO_STREAM(logger_->get_logger(), "Using cached route for " << req->route_id << " with length " << catalog_entry->route_length << " m");
+                    startRoute(catalog_entry->route_msg, catalog_entry->route_marker_msg, req->route_id);
+                    return true;
+                }
+            }
+        }
+
         // generate a route
         auto route = routing(destination_points_in_map_with_vehicle.front(),
                             std::vector<lanelet::BasicPoint2d>(destination_points_in_map_with_vehicle.begin() + 1, destination_points_in_map_with_vehicle.end() - 1),
@@ -271,8 +269,14 @@ namespace route {
 
         route->setEndPoint(end_point);
 
+        startRoute(composeRouteMsg(route), buildRouteMarker(route.get()), req->route_id);
+        return true;
+    }
+
+    void RouteGeneratorWorker::startRoute(const carma_planning_msgs::msg::Route& route_msg, const visualization_msgs::msg::Marker& route_marker_msg, const std::string& route_name)
+    {
         // update route message
-        route_msg_ = composeRouteMsg(route);
+        route_msg_ = route_msg;
 
         for(auto id : route_msg_.route_path_lanelet_ids)
         {
@@ -280,8 +284,16 @@ namespace route {
             route_llts.push_back(ll);
         }
 
-        route_msg_.route_name = req->route_id;
-        route_marker_msg_ = composeRouteMarkerMsg(route);
+        route_msg_.route_name = route_name;
+        route_marker_msg_ = route_marker_msg;
+        if(route_marker_msg_.points.empty())
+        {
+            RCLCPP_WARN_STREAM(logger_->get_logger(), "No central line points! Returning");
+        }
+        else
+        {
+            new_route_marker_generated_ = true;
+        }
         route_msg_.header.stamp = clock_->now();
         route_msg_.header.frame_id = "map";
         route_msg_.map_version = world_model_->getMapVersion();
@@ -290,7 +302,6 @@ namespace route {
         publishRouteEvent(carma_planning_msgs::msg::RouteEvent::ROUTE_STARTED);
         // set publish flag such that updated msg will be published in the next spin
         new_route_msg_generated_ = true;
-        return true;
     }
 
     bool RouteGeneratorWorker::checkForDuplicateLaneletsInShortestPath(const lanelet::routing::Route& route) const
@@ -319,11 +330,9 @@ namespace route {
 
     std::vector<lanelet::BasicPoint3d> RouteGeneratorWorker::loadRouteDestinationsInMapFrame(const std::vector<carma_v2x_msgs::msg::Position3D>& destinations) const
     {
-        if (!map_proj_) {
+        if (!projector_) {
             throw std::invalid_argument("loadRouteDestinationsInMapFrame (using destination points array) before map projection was set");
         }
-        
-        lanelet::projection::LocalFrameProjector projector(map_proj_.get().c_str()); // Build map projector
 
         // Process each point in 'destinations'
         std::vector<lanelet::BasicPoint3d> destination_points;
@@ -342,7 +351,7 @@ namespace route {
                 coordinate.ele = 0.0;
             }
 
-            destination_points.emplace_back(projector.forward(coordinate));
+            destination_points.emplace_back(projector_->forward(coordinate));
         }
 
         return destination_points;
@@ -351,7 +360,11 @@ namespace route {
     std::vector<carma_v2x_msgs::msg::Position3D> RouteGeneratorWorker::loadRouteDestinationGpsPointsFromRouteId(const std::string& route_id) const
     {
         // compose full path of the route file
-        std::string route_file_name = route_file_path_ + route_id + ".csv";
+        return loadRouteDestinationGpsPointsFromFile(route_file_path_ + route_id + ".csv");
+    }
+
+    std::vector<carma_v2x_msgs::msg::Position3D> RouteGeneratorWorker::loadRouteDestinationGpsPointsFromFile(const std::string& route_file_name) const
+    {
         std::ifstream fs(route_file_name);
         std::string line;
         
@@ -382,16 +395,32 @@ namespace route {
     }
 
     visualization_msgs::msg::Marker RouteGeneratorWorker::composeRouteMarkerMsg(const lanelet::Optional<lanelet::routing::Route>& route)
+    {
+        auto marker = buildRouteMarker(route.get());
+
+        route_marker_msg_.points={};
+
+        if (marker.points.empty())
+        {
+            RCLCPP_WARN_STREAM(logger_->get_logger(), "No central line points! Returning");
+            return route_marker_msg_;
+        }
+
+        new_route_marker_generated_ = true;
+        return marker;
+    }
+
+    visualization_msgs::msg::Marker RouteGeneratorWorker::buildRouteMarker(const lanelet::routing::Route& route) const
     {
         std::vector<lanelet::ConstPoint3d> points;
-        auto end_point_3d = route.get().getEndPoint();
-        auto last_ll = route.get().shortestPath().back();
+        auto end_point_3d = route.getEndPoint();
+        auto last_ll = route.shortestPath().back();
         double end_point_downtrack = carma_wm::geometry::trackPos(last_ll, {end_point_3d.x(), end_point_3d.y()}).downtrack;
         double lanelet_downtrack = carma_wm::geometry::trackPos(last_ll, last_ll.centerline().back().basicPoint2d()).downtrack;
         // get number of points to display using ratio of the downtracks
         auto points_until_end_point = int (last_ll.centerline().size() * (end_point_downtrack / lanelet_downtrack));
   
-        for(const auto& ll : route.get().shortestPath())
+        for(const auto& ll : route.shortestPath())
         {
             if (ll.id() == last_ll.id())
             {
@@ -407,8 +436,6 @@ namespace route {
             }
         }
 
-        route_marker_msg_.points={};
-
         // create the marker msgs
         visualization_msgs::msg::Marker marker;
         marker.header.frame_id = "map";
@@ -427,12 +454,6 @@ namespace route {
         marker.color.g = 1.0F;
         marker.color.b = 1.0F;
         marker.color.a = 1.0F;
-
-        if (points.empty())
-        {
-            RCLCPP_WARN_STREAM(logger_->get_logger(), "No central line points! Returning");
-            return route_marker_msg_;
-        }
  
         for (int i = 0; i < points.size(); i=i+5)
         {
@@ -443,7 +464,6 @@ namespace route {
             
             marker.points.push_back(temp_point);
         }
-        new_route_marker_generated_ = true;
         return marker;
     }
 
@@ -491,24 +511,67 @@ namespace route {
         tf2_buffer_.setUsingDedicatedThread(true);
     }
 
-    void RouteGeneratorWorker::bumperPoseCb()
+    void RouteGeneratorWorker::poseCb(geometry_msgs::msg::PoseStamped::UniquePtr msg)
     {
-        try
+        if (!base_to_front_bumper_)
         {
-            tf_ = tf2_buffer_.lookupTransform("map", "vehicle_front", rclcpp::Time(0,0), rclcpp::Duration(1.0*1e9)); //save to local copy of transform 0.1 sec timeout
-            tf2::fromMsg(tf_, frontbumper_transform_);
+            // The front bumper is a static offset from base_link so it only needs to be looked up once. The lookup is non-blocking and retried on the next pose.
+            try
+            {
+                tf2::Stamped<tf2::Transform> base_to_front_bumper;
+                tf2::fromMsg(tf2_buffer_.lookupTransform("base_link", "vehicle_front", tf2::TimePointZero), base_to_front_bumper);
+                base_to_front_bumper_ = base_to_front_bumper;
+                // No further transforms are needed so stop deserializing /tf
+                tf2_listener_.reset();
+            }
+            catch (const tf2::TransformException &ex)
+            {
+                RCLCPP_WARN_STREAM_THROTTLE(logger_->get_logger(), *clock_, 1000, "Waiting for base_link to vehicle_front transform: " << ex.what());
+                return;
+            }
         }
-        catch (const tf2::TransformException &ex)
+
+        tf2::Transform map_to_base;
+        tf2::fromMsg(msg->pose, map_to_base);
+        tf2::Transform map_to_front_bumper = map_to_base * base_to_front_bumper_.get();
+
+        geometry_msgs::msg::PoseStamped updated_vehicle_pose;
+        updated_vehicle_pose.header.stamp = msg->header.stamp;
+        updated_vehicle_pose.header.frame_id = msg->header.frame_id;
+        tf2::toMsg(map_to_front_bumper, updated_vehicle_pose.pose);
+        vehicle_pose_ = updated_vehicle_pose;
+
+        updateRouteTracking();
+
+        if (front_bumper_pose_pub_)
         {
-            RCLCPP_WARN_STREAM(logger_->get_logger(), ex.what());
+            front_bumper_pose_pub_->publish(updated_vehicle_pose);
         }
-        
-        geometry_msgs::msg::PoseStamped updated_vehicle_pose;
-        updated_vehicle_pose.pose.position.x = frontbumper_transform_.getOrigin().getX();
-        updated_vehicle_pose.pose.position.y = frontbumper_transform_.getOrigin().getY();
-        updated_vehicle_pose.pose.position.z = frontbumper_transform_.getOrigin().getZ();
-        vehicle_pose_ = updated_vehicle_pose; 
-            
+
+        publishRouteState(msg->header.stamp);
+    }
+
+    void RouteGeneratorWorker::publishRouteState(const rclcpp::Time& stamp)
+    {
+        // publish route state messsage if a route is selected
+        if(route_state_pub_ && route_msg_.route_name != "")
+        {
+            carma_planning_msgs::msg::RouteState state_msg;
+            state_msg.header.stamp = stamp;
+            state_msg.header.frame_id = "map";
+            state_msg.route_id = route_msg_.route_name;
+            state_msg.cross_track = current_crosstrack_distance_;
+            state_msg.down_track = current_downtrack_distance_;
+            state_msg.lanelet_downtrack = ll_downtrack_distance_;            
+            state_msg.state = this->rs_worker_.getRouteState();
+            state_msg.lanelet_id = ll_id_;
+            state_msg.speed_limit = speed_limit_;
+            route_state_pub_->publish(state_msg);
+        }
+    }
+
+    void RouteGeneratorWorker::updateRouteTracking()
+    {
         if(this->rs_worker_.getRouteState() == RouteStateWorker::RouteState::FOLLOWING) {
             // convert from pose stamp into lanelet basic 2D point
             current_loc_ = lanelet::BasicPoint2d(vehicle_pose_->pose.position.x, vehicle_pose_->pose.position.y);
@@ -535,25 +598,23 @@ namespace route {
             current_crosstrack_distance_ = track.crosstrack;
             current_downtrack_distance_ = track.downtrack;
             // Determine speed limit
-            lanelet::Optional<carma_wm::TrafficRulesConstPtr> traffic_rules = world_model_->getTrafficRules();
-            
-            if (traffic_rules) 
+            auto laneletIterator = world_model_->getMap()->laneletLayer.find(ll_id_);
+            if (laneletIterator != world_model_->getMap()->laneletLayer.end())
             {
-                auto laneletIterator = world_model_->getMap()->laneletLayer.find(ll_id_);
-                if (laneletIterator != world_model_->getMap()->laneletLayer.end()) {
-                    speed_limit_ = (*traffic_rules)->speedLimit(*laneletIterator).speedLimit.value();
-                } 
-                else 
+                try
+                {
+                    speed_limit_ = world_model_->getSpeedLimit(*laneletIterator);
+                }
+                catch (const std::invalid_argument& e)
                 {
-                    RCLCPP_ERROR_STREAM(logger_->get_logger(), "Failed to set the current speed limit. The lanelet_id: "
-                        << ll_id_ << " could not be matched with a lanelet in the map. The previous speed limit of "
-                        << speed_limit_ << " will be used.");
+                    RCLCPP_ERROR_STREAM(logger_->get_logger(), "Failed to set the current speed limit. " << e.what());
                 }
-                
             } 
             else 
             {
-                RCLCPP_ERROR_STREAM(logger_->get_logger(), "Failed to set the current speed limit. Valid traffic rules object could not be built.");
+                RCLCPP_ERROR_STREAM(logger_->get_logger(), "Failed to set the current speed limit. The lanelet_id: "
+                    << ll_id_ << " could not be matched with a lanelet in the map. The previous speed limit of "
+                    << speed_limit_ << " will be used.");
             }
             std::shared_ptr<geometry_msgs::msg::PoseStamped> pose_ptr(new geometry_msgs::msg::PoseStamped(*vehicle_pose_));
             
@@ -581,18 +642,232 @@ namespace route {
 
     void RouteGeneratorWorker::georeferenceCb(std_msgs::msg::String::UniquePtr msg)
     {
+        if (map_proj_ && map_proj_.get() == msg->data)
+        {
+            return;
+        }
+
         map_proj_ = msg->data;
+        projector_ = std::make_unique<lanelet::projection::LocalFrameProjector>(map_proj_.get().c_str()); // Build map projector
+
+        // All destinations must be projected again and every route depends on its destinations
+        for(auto& id_entry : route_catalog_)
+        {
+            id_entry.second.destinations_projected = false;
+            id_entry.second.route_cached = false;
+        }
+
+        refreshRouteCatalog();
+    }
+
+    void RouteGeneratorWorker::onMapUpdate()
+    {
+        // Only mark routes as stale. Map updates can arrive frequently and routes are resolved again when they are selected.
+        for(auto& id_entry : route_catalog_)
+        {
+            id_entry.second.route_cached = false;
+        }
+    }
+
+    const std::map<std::string, RouteCatalogEntry>& RouteGeneratorWorker::getRouteCatalog() const
+    {
+        return route_catalog_;
+    }
+
+    bool RouteGeneratorWorker::refreshRouteCatalog()
+    {
+        if(route_file_path_.empty() || !boost::filesystem::exists(boost::filesystem::path(this->route_file_path_)))
+        {
+            route_catalog_.clear();
+            return false;
+        }
+
+        std::unordered_set<std::string> found_route_ids;
+
+        // Read all route files in the given directory
+        boost::filesystem::directory_iterator end_point;
+        for(boost::filesystem::directory_iterator itr(boost::filesystem::path(this->route_file_path_)); itr != end_point; ++itr)
+        {
+            // Skip if the iterator has landed on a folder
+            if(boost::filesystem::is_directory(itr->status()))
+            {
+                continue;
+            }
+
+            auto full_file_name = itr->path().filename().generic_string();
+
+            // Skip if '.csv' is not found in the file name
+            if(full_file_name.find(".csv") == std::string::npos)
+            { 
+                continue;
+            }          
+
+            // Assume route files ending with ".csv", before that is the actual route name
+            auto route_id = full_file_name.substr(0, full_file_name.find(".csv"));
+            found_route_ids.insert(route_id);
+            updateRouteCatalogEntry(route_id, itr->path(), false);
+        }
+
+        // Drop routes whose files have been removed
+        for(auto it = route_catalog_.begin(); it != route_catalog_.end();)
+        {
+            if(found_route_ids.find(it->first) == found_route_ids.end())
+            {
+                it = route_catalog_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        return true;
+    }
+
+    RouteCatalogEntry* RouteGeneratorWorker::updateRouteCatalogEntry(const std::string& route_id, const boost::filesystem::path& file_path, bool resolve_route)
+    {
+        boost::system::error_code ec;
+        auto last_write_time = boost::filesystem::last_write_time(file_path, ec);
+        auto file_size = ec ? 0 : boost::filesystem::file_size(file_path, ec);
+        if(ec)
+        {
+            route_catalog_.erase(route_id);
+            return nullptr;
+        }
+
+        auto& entry = route_catalog_[route_id];
+
+        // Reload the route file if it is new or has been modified since it was last read
+        if(entry.route_id.empty() || entry.last_write_time != last_write_time || entry.file_size != file_size)
+        {
+            entry = RouteCatalogEntry();
+            entry.route_id = route_id;
+            entry.last_write_time = last_write_time;
+            entry.file_size = file_size;
+
+            std::ifstream fin(file_path.generic_string());
+            std::string dest_name;
+            if(fin.is_open())
+            {
+                std::string temp;
+                while (std::getline(fin, temp))
+                {
+                    if(temp != "") dest_name = temp;
+                }
+                fin.close();
+            } 
+            else
+            {
+                RCLCPP_ERROR_STREAM(logger_->get_logger(), "File open failed...");
+            }
+            auto last_comma = dest_name.find_last_of(',');
+            auto name = dest_name.substr(last_comma + 1);
+            if(!name.empty() && !std::isdigit(name.at(0)))
+            {
+                entry.route_name = name;
+            }
+
+            try
+            {
+                entry.gps_destination_points = loadRouteDestinationGpsPointsFromFile(file_path.generic_string());
+            }
+            catch(const std::exception& e)
+            {
+                RCLCPP_ERROR_STREAM(logger_->get_logger(), "Failed to read destinations of route " << route_id << ": " << e.what());
+                entry.gps_destination_points.clear();
+            }
+        }
+
+        if(!projector_)
+        {
+            return &entry;
+        }
+
+        if(!entry.destinations_projected)
+        {
+            entry.destination_points = loadRouteDestinationsInMapFrame(entry.gps_destination_points);
+            entry.destinations_projected = true;
+            entry.route_cached = false;
+        }
+
+        if(!resolve_route || !world_model_ || !world_model_->getMap() || entry.destination_points.size() < 2
+            || (entry.route_cached && entry.map_version == world_model_->getMapVersion()))
+        {
+            return &entry;
+        }
+
+        // Resolve the route through all destinations starting from the first one. The route is marked as cached even if routing fails
+        // so that routing is not reattempted until the map or route file changes. In that case route selection falls back to routing from the vehicle.
+        entry.route_cached = true;
+        entry.map_version = world_model_->getMapVersion();
+        entry.route_msg = carma_planning_msgs::msg::Route();
+        entry.route_marker_msg = visualization_msgs::msg::Marker();
+        entry.route_length = 0.0;
+
+        auto destination_points_2d = lanelet::utils::transform(entry.destination_points, [](auto a) { return lanelet::traits::to2D(a); });
+
+        for (const auto& pt : destination_points_2d)
+        {
+            if ((world_model_->getLaneletsFromPoint(pt, 1)).empty())
+            {
+                return &entry;
+            }
+        }
+
+        auto route = routing(destination_points_2d.front(),
+                            std::vector<lanelet::BasicPoint2d>(destination_points_2d.begin() + 1, destination_points_2d.end() - 1),
+                            destination_points_2d.back(),
+                            world_model_->getMap(), world_model_->getMapRoutingGraph());
+
+        if(!route || checkForDuplicateLaneletsInShortestPath(route.get()))
+        {
+            return &entry;
+        }
+
+        lanelet::Point3d end_point{lanelet::utils::getId(), destination_points_2d.back().x(), destination_points_2d.back().y(), 0};
+        route->setEndPoint(end_point);
+
+        entry.route_msg = composeRouteMsg(route);
+        entry.route_marker_msg = buildRouteMarker(route.get());
+        entry.route_length = computeRouteLength(route.get(), destination_points_2d.front());
+
+        return &entry;
+    }
+
+    double RouteGeneratorWorker::computeRouteLength(const lanelet::routing::Route& route, const lanelet::BasicPoint2d& start) const
+    {
+        const auto& shortest_path = route.shortestPath();
+        if(shortest_path.empty())
+        {
+            return 0.0;
+        }
+
+        double length = 0.0;
+        for(const auto& ll : shortest_path)
+        {
+            length += lanelet::geometry::length2d(ll);
+        }
+
+        // Remove the portion of the first lanelet before the start and the portion of the last lanelet after the end point
+        auto end_point = route.getEndPoint();
+        length -= carma_wm::geometry::trackPos(shortest_path.front(), start).downtrack;
+        length -= lanelet::geometry::length2d(shortest_path.back())
+                    - carma_wm::geometry::trackPos(shortest_path.back(), {end_point.x(), end_point.y()}).downtrack;
+
+        return std::max(0.0, length);
     }
 
     void RouteGeneratorWorker::setPublishers(const carma_ros2_utils::PubPtr<carma_planning_msgs::msg::RouteEvent>& route_event_pub,
                         const carma_ros2_utils::PubPtr<carma_planning_msgs::msg::RouteState>& route_state_pub,
                         const carma_ros2_utils::PubPtr<carma_planning_msgs::msg::Route>& route_pub,
-                        const carma_ros2_utils::PubPtr<visualization_msgs::msg::Marker>& route_marker_pub)
+                        const carma_ros2_utils::PubPtr<visualization_msgs::msg::Marker>& route_marker_pub,
+                        const carma_ros2_utils::PubPtr<geometry_msgs::msg::PoseStamped>& front_bumper_pose_pub)
     {
         route_event_pub_ = route_event_pub;
         route_state_pub_ = route_state_pub;
         route_pub_ = route_pub;
         route_marker_pub_= route_marker_pub;
+        front_bumper_pose_pub_ = front_bumper_pose_pub;
     }
 
     void RouteGeneratorWorker::setDowntrackDestinationRange(double dt_dest_range)
@@ -635,9 +910,6 @@ namespace route {
 
     bool RouteGeneratorWorker::spinCallback()
     {
-        // Update vehicle position
-        bumperPoseCb();
-
         if(reroutingChecker()==true)
         {
            RCLCPP_DEBUG_STREAM(logger_->get_logger(), "Rerouting required");
@@ -684,20 +956,6 @@ namespace route {
             new_route_marker_generated_ = false;
             route_msg_.is_rerouted = false;
         }
-        // publish route state messsage if a route is selected
-        if(route_msg_.route_name != "")
-        {
-            carma_planning_msgs::msg::RouteState state_msg;
-            state_msg.header.stamp = clock_->now();
-            state_msg.route_id = route_msg_.route_name;
-            state_msg.cross_track = current_crosstrack_distance_;
-            state_msg.down_track = current_downtrack_distance_;
-            state_msg.lanelet_downtrack = ll_downtrack_distance_;            
-            state_msg.state = this->rs_worker_.getRouteState();
-            state_msg.lanelet_id = ll_id_;
-            state_msg.speed_limit = speed_limit_;
-            route_state_pub_->publish(state_msg);
-        }
         // publish route event in order if any
         while(!route_event_queue.empty())
         {
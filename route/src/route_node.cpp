@@ -77,10 +77,12 @@ namespace route
                                                               std::bind(&RouteGeneratorWorker::twistCb, &rg_worker_, std_ph::_1));
     geo_sub_ = create_subscription<std_msgs::msg::String>("georeference", 1,
                                                               std::bind(&RouteGeneratorWorker::georeferenceCb, &rg_worker_, std_ph::_1));
+    // current_pose is subscribed to on activation, since each pose update publishes route_state and front_bumper_pose
 
     // Setup publishers
     route_pub_ = create_publisher<carma_planning_msgs::msg::Route>("route", 1);
     route_state_pub_ = create_publisher<carma_planning_msgs::msg::RouteState>("route_state", 1);
+    front_bumper_pose_pub_ = create_publisher<geometry_msgs::msg::PoseStamped>("front_bumper_pose", 1);
 
     // NOTE: Currently, intra-process comms must be disabled for the following two publishers that are transient_local: https://github.com/ros2/rclcpp/issues/1753
     rclcpp::PublisherOptions intra_proc_disabled; 
@@ -105,6 +107,7 @@ namespace route
     // Set world model pointer from wm listener
     wm_ = wml_.getWorldModel();
     wml_.enableUpdatesWithoutRouteWL();
+    wml_.setMapCallback(std::bind(&RouteGeneratorWorker::onMapUpdate, &rg_worker_));
 
     // Configure route generator worker parameters
     rg_worker_.setClock(get_clock());
@@ -114,7 +117,7 @@ namespace route
     rg_worker_.setDowntrackDestinationRange(config_.destination_downtrack_range);
     rg_worker_.setCrosstrackErrorDistance(config_.max_crosstrack_error);
     rg_worker_.setCrosstrackErrorCountMax(config_.cte_max_count);
-    rg_worker_.setPublishers(route_event_pub_, route_state_pub_, route_pub_, route_marker_pub_);
+    rg_worker_.setPublishers(route_event_pub_, route_state_pub_, route_pub_, route_marker_pub_, front_bumper_pose_pub_);
     rg_worker_.initializeBumperTransformLookup();
 
     // Return success if everthing initialized successfully
@@ -125,6 +128,9 @@ namespace route
   {
     rg_worker_.setRouteFilePath(config_.route_file_path);
 
+    pose_sub_ = create_subscription<geometry_msgs::msg::PoseStamped>("current_pose", 1,
+                                                              std::bind(&RouteGeneratorWorker::poseCb, &rg_worker_, std_ph::_1));
+
     // Timer for route generator worker's spin callback
     auto rg_worker_spin_period_ms = int ((1 / config_.route_spin_rate) * 1000); // Conversion from frequency (Hz) to milliseconds time period
     spin_timer_ = create_timer(get_clock(),
@@ -134,6 +140,14 @@ namespace route
     return CallbackReturn::SUCCESS;
   }
 
+  carma_ros2_utils::CallbackReturn Route::handle_on_deactivate(const rclcpp_lifecycle::State &)
+  {
+    // Stop publishing on pose updates while the publishers are inactive
+    pose_sub_.reset();
+
+    return CallbackReturn::SUCCESS;
+  }
+
 } // route
 
 #include "rclcpp_components/register_node_macro.hpp"
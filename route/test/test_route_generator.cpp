@@ -16,6 +16,8 @@
 
 #include <ament_index_cpp/get_package_share_directory.hpp>
 #include <gtest/gtest.h>
+#include <fstream>
+#include <iomanip>
 #include <carma_wm/WMTestLibForGuidance.hpp>
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_io/Io.h>
@@ -725,6 +727,186 @@ TEST(RouteGeneratorTest, test_get_closest_lanelet_from_route_llts)
     ASSERT_EQ(boost::geometry::within(position, llt.polygon2d()), true);
 }
 
+TEST(RouteGeneratorTest, test_route_catalog)
+{
+    // Create a RouteGeneratorWorker for this test
+    auto node = std::make_shared<rclcpp::Node>("test_node");
+    rclcpp::node_interfaces::NodeClockInterface::SharedPtr clock = node->get_node_clock_interface();
+    tf2_ros::Buffer tf2_buffer(clock->get_clock());
+    route::RouteGeneratorWorker worker(tf2_buffer);
+    worker.setLoggerInterface(node->get_node_logging_interface());
+
+    // Create a route file directory for this test
+    auto route_dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("route_catalog_%%%%-%%%%");
+    boost::filesystem::create_directories(route_dir);
+
+    {
+        std::ofstream fout((route_dir / "route_a.csv").generic_string());
+        fout << "8.002665373,48.99873682,0,DEST1\n8.002665558,48.99872955,0,DEST2\n";
+    }
+    {
+        // Routes without a destination name are kept in the catalog but not offered for selection
+        std::ofstream fout((route_dir / "route_b.csv").generic_string());
+        fout << "8.002665373,48.99873682,0\n";
+    }
+    {
+        std::ofstream fout((route_dir / "notes.txt").generic_string());
+        fout << "not a route\n";
+    }
+
+    worker.setRouteFilePath(route_dir.generic_string() + "/");
+
+    ASSERT_EQ(2, worker.getRouteCatalog().size());
+    const auto& route_a = worker.getRouteCatalog().at("route_a");
+    ASSERT_EQ("DEST2", route_a.route_name);
+    ASSERT_EQ(2, route_a.gps_destination_points.size());
+    ASSERT_FALSE(route_a.destinations_projected);
+    ASSERT_TRUE(worker.getRouteCatalog().at("route_b").route_name.empty());
+
+    std::shared_ptr<rmw_request_id_t> header;
+    auto req_ptr = std::make_shared<carma_planning_msgs::srv::GetAvailableRoutes::Request>();
+    auto resp_ptr = std::make_shared<carma_planning_msgs::srv::GetAvailableRoutes::Response>();
+    ASSERT_TRUE(worker.getAvailableRouteCb(header, req_ptr, resp_ptr));
+    ASSERT_EQ(1, resp_ptr->available_routes.size());
+    ASSERT_EQ("route_a", resp_ptr->available_routes[0].route_id);
+    ASSERT_EQ("DEST2", resp_ptr->available_routes[0].route_name);
+
+    // Setting the georeference projects the destinations of every route in the catalog
+    std_msgs::msg::String str_msg;
+    str_msg.data = "+proj=tmerc +lat_0=4.9000000000000000e+1 +lon_0=8.0000000000000000e+0 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +geoidgrids=egm96_15.gtx +vunits=m +no_defs";
+    worker.georeferenceCb(std::make_unique<std_msgs::msg::String>(str_msg));
+
+    ASSERT_TRUE(worker.getRouteCatalog().at("route_a").destinations_projected);
+    ASSERT_EQ(2, worker.getRouteCatalog().at("route_a").destination_points.size());
+    auto map_points = worker.loadRouteDestinationsInMapFrame(worker.loadRouteDestinationGpsPointsFromRouteId("route_a"));
+    ASSERT_NEAR(map_points[1].x(), worker.getRouteCatalog().at("route_a").destination_points[1].x(), 0.001);
+    ASSERT_NEAR(map_points[1].y(), worker.getRouteCatalog().at("route_a").destination_points[1].y(), 0.001);
+
+    // No map is loaded so no route can be resolved
+    ASSERT_FALSE(worker.getRouteCatalog().at("route_a").route_cached);
+
+    // Modified files are reloaded and removed files are dropped
+    {
+        std::ofstream fout((route_dir / "route_a.csv").generic_string(), std::ios::app);
+        fout << "8.002665373,48.99872458,0,DEST3\n";
+    }
+    boost::filesystem::remove(route_dir / "route_b.csv");
+
+    ASSERT_TRUE(worker.refreshRouteCatalog());
+    ASSERT_EQ(1, worker.getRouteCatalog().size());
+    ASSERT_EQ("DEST3", worker.getRouteCatalog().at("route_a").route_name);
+    ASSERT_EQ(3, worker.getRouteCatalog().at("route_a").destination_points.size());
+
+    boost::filesystem::remove_all(route_dir);
+    ASSERT_FALSE(worker.refreshRouteCatalog());
+    ASSERT_TRUE(worker.getRouteCatalog().empty());
+}
+
+TEST(RouteGeneratorTest, test_route_catalog_cached_route)
+{
+    auto node = std::make_shared<rclcpp::Node>("test_node");
+    rclcpp::node_interfaces::NodeClockInterface::SharedPtr clock = node->get_node_clock_interface();
+    tf2_ros::Buffer tf2_buffer(clock->get_clock());
+
+    // Single lane route from lanelet 1201 to lanelet 1203 of the guidance test map
+    auto cmw = carma_wm::test::getGuidanceTestMap();
+
+    std::string proj = "+proj=tmerc +lat_0=0 +lon_0=0 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=m +vunits=m +no_defs";
+    lanelet::projection::LocalFrameProjector projector(proj.c_str());
+
+    auto route_dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("route_catalog_%%%%-%%%%");
+    boost::filesystem::create_directories(route_dir);
+    {
+        std::ofstream fout((route_dir / "route_a.csv").generic_string());
+        fout << std::setprecision(12);
+        auto start = projector.reverse({1.85, 37.5, 0.0});
+        auto end = projector.reverse({1.85, 87.5, 0.0});
+        fout << start.lon << "," << start.lat << ",0,START\n" << end.lon << "," << end.lat << ",0,END\n";
+    }
+
+    std_msgs::msg::String str_msg;
+    str_msg.data = proj;
+
+    std::shared_ptr<rmw_request_id_t> header;
+    auto list_req = std::make_shared<carma_planning_msgs::srv::GetAvailableRoutes::Request>();
+    auto set_req = std::make_shared<carma_planning_msgs::srv::SetActiveRoute::Request>();
+    set_req->choice = carma_planning_msgs::srv::SetActiveRoute::Request::ROUTE_ID;
+    set_req->route_id = "route_a";
+
+    geometry_msgs::msg::PoseStamped pose;
+    pose.pose.position.x = 1.85;
+
+    ////////////
+    // The vehicle starts in the first lanelet of the route so the route resolved into the catalog is used as is
+    ////////////
+    route::RouteGeneratorWorker worker(tf2_buffer);
+    worker.setLoggerInterface(node->get_node_logging_interface());
+    worker.setClock(node->get_clock());
+    worker.setWorldModelPtr(cmw);
+    worker.georeferenceCb(std::make_unique<std_msgs::msg::String>(str_msg));
+    worker.setRouteFilePath(route_dir.generic_string() + "/");
+
+    // Listing routes does not resolve them
+    auto list_resp = std::make_shared<carma_planning_msgs::srv::GetAvailableRoutes::Response>();
+    ASSERT_TRUE(worker.getAvailableRouteCb(header, list_req, list_resp));
+    ASSERT_EQ(1, list_resp->available_routes.size());
+    ASSERT_TRUE(worker.getRouteCatalog().at("route_a").destinations_projected);
+    ASSERT_FALSE(worker.getRouteCatalog().at("route_a").route_cached);
+
+    pose.pose.position.y = 30.0;
+    worker.vehicle_pose_ = pose;
+
+    auto set_resp = std::make_shared<carma_planning_msgs::srv::SetActiveRoute::Response>();
+    ASSERT_TRUE(worker.setActiveRouteCb(header, set_req, set_resp));
+    ASSERT_EQ(carma_planning_msgs::srv::SetActiveRoute::Response::NO_ERROR, set_resp->error_status);
+
+    // The route is resolved on selection and kept for the current map version
+    const auto& entry = worker.getRouteCatalog().at("route_a");
+    ASSERT_TRUE(entry.route_cached);
+    ASSERT_EQ(cmw->getMapVersion(), entry.map_version);
+    ASSERT_EQ(std::vector<lanelet::Id>({1201, 1202, 1203}), entry.route_msg.shortest_path_lanelet_ids);
+    ASSERT_NEAR(50.0, entry.route_length, 0.1);
+    ASSERT_EQ(1201, worker.getClosestLaneletFromRouteLanelets({1.85, 5.0}).id());
+
+    // Refreshing the catalog keeps the cached route
+    auto cached_ids = entry.route_msg.route_path_lanelet_ids;
+    ASSERT_TRUE(worker.refreshRouteCatalog());
+    ASSERT_TRUE(worker.getRouteCatalog().at("route_a").route_cached);
+    ASSERT_EQ(cached_ids, worker.getRouteCatalog().at("route_a").route_msg.route_path_lanelet_ids);
+
+    // Map updates only mark the route as stale, it is not resolved again until it is selected
+    worker.onMapUpdate();
+    ASSERT_FALSE(worker.getRouteCatalog().at("route_a").route_cached);
+    ASSERT_TRUE(worker.refreshRouteCatalog());
+    ASSERT_FALSE(worker.getRouteCatalog().at("route_a").route_cached);
+
+    ////////////
+    // The vehicle starts before the first destination so the route is generated from the vehicle position
+    ////////////
+    route::RouteGeneratorWorker worker2(tf2_buffer);
+    worker2.setLoggerInterface(node->get_node_logging_interface());
+    worker2.setClock(node->get_clock());
+    worker2.setWorldModelPtr(cmw);
+    worker2.georeferenceCb(std::make_unique<std_msgs::msg::String>(str_msg));
+    worker2.setRouteFilePath(route_dir.generic_string() + "/");
+
+    pose.pose.position.y = 5.0;
+    worker2.vehicle_pose_ = pose;
+
+    // Selecting after a map update only routes from the vehicle. The catalog route is not resolved since it could not be used.
+    worker2.onMapUpdate();
+
+    set_resp = std::make_shared<carma_planning_msgs::srv::SetActiveRoute::Response>();
+    ASSERT_TRUE(worker2.setActiveRouteCb(header, set_req, set_resp));
+    ASSERT_EQ(carma_planning_msgs::srv::SetActiveRoute::Response::NO_ERROR, set_resp->error_status);
+
+    ASSERT_FALSE(worker2.getRouteCatalog().at("route_a").route_cached);
+    ASSERT_TRUE(worker2.getRouteCatalog().at("route_a").route_msg.shortest_path_lanelet_ids.empty());
+    ASSERT_EQ(1200, worker2.getClosestLaneletFromRouteLanelets({1.85, 5.0}).id());
+
+    boost::filesystem::remove_all(route_dir);
+}
+
 int main(int argc, char ** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -26,9 +26,7 @@
 #include <carma_planning_msgs/srv/plan_maneuvers.hpp>
 #include <carma_planning_msgs/msg/trajectory_plan.hpp>
 #include <gtest/gtest_prod.h>
-#include <tf2_ros/transform_listener.h>
-#include <tf2/LinearMath/Transform.h>
-#include <tf2_geometry_msgs/tf2_geometry_msgs.h>
+#include <lifecycle_msgs/msg/state.hpp>
 #include <unordered_set>
 #include "carma_guidance_plugins/strategic_plugin.hpp"
 #include "route_following_plugin_config.hpp"
@@ -227,6 +225,7 @@ namespace route_following_plugin
 
         //Subscribers
         carma_ros2_utils::SubPtr<geometry_msgs::msg::TwistStamped> twist_sub_;
+        carma_ros2_utils::SubPtr<geometry_msgs::msg::PoseStamped> bumper_pose_sub_;
         carma_ros2_utils::SubPtr<carma_planning_msgs::msg::ManeuverPlan> current_maneuver_plan_sub_;
     
         // unordered set of all the lanelet ids in shortest path
@@ -260,13 +259,11 @@ namespace route_following_plugin
         std::string planning_strategic_plugin_ = "route_following_plugin";
         std::string lanefollow_planning_tactical_plugin_ = "inlanecruising_plugin"; 
    
-        // Timer used to update the front bumper pose
-        rclcpp::TimerBase::SharedPtr bumper_pose_timer_;
-        
         /**
-         * \brief Callback for the front bumper pose transform
+         * \brief Callback for the front bumper pose subscriber, which checks route progress and whether the vehicle left the shortest path
+         * \param msg Latest pose of the front bumper in the map frame
          */
-        void bumper_pose_cb();
+        void bumper_pose_cb(geometry_msgs::msg::PoseStamped::UniquePtr msg);
 
         /**
          * \brief Callback for the twist subscriber, which will store latest twist locally
@@ -290,20 +287,6 @@ namespace route_following_plugin
          */
         rclcpp::Duration getManeuverDuration(carma_planning_msgs::msg::Maneuver &maneuver, double epsilon) const;
 
-        /**
-         * \brief Initialize transform lookup from front bumper to map
-         */
-        void initializeBumperTransformLookup();
-
-        geometry_msgs::msg::TransformStamped tf_;
-        
-        // front bumper transform
-        tf2::Stamped<tf2::Transform> frontbumper_transform_;
-        
-        // TF listenser
-        tf2_ros::Buffer tf2_buffer_;
-        std::unique_ptr<tf2_ros::TransformListener> tf2_listener_;
-
         //Unit Tests
         FRIEND_TEST(RouteFollowingPluginTest, testComposeManeuverMessage);
         FRIEND_TEST(RouteFollowingPluginTest, testIdentifyLaneChange);
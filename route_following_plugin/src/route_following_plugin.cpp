@@ -86,7 +86,7 @@ void setManeuverLaneletIds(carma_planning_msgs::msg::Maneuver& mvr, lanelet::Id
 }
 
   RouteFollowingPlugin::RouteFollowingPlugin(const rclcpp::NodeOptions &options)
-      : carma_guidance_plugins::StrategicPlugin(options), tf2_buffer_(get_clock()), config_(Config())
+      : carma_guidance_plugins::StrategicPlugin(options), config_(Config())
   {
     // Declare parameters
     config_.min_plan_duration_ = declare_parameter<double>("minimal_plan_duration", config_.min_plan_duration_);
@@ -122,10 +122,15 @@ void setManeuverLaneletIds(carma_planning_msgs::msg::Maneuver& mvr, lanelet::Id
                                                               std::bind(&RouteFollowingPlugin::twist_cb,this,std_ph::_1));
     current_maneuver_plan_sub_ = create_subscription<carma_planning_msgs::msg::ManeuverPlan>("maneuver_plan", 50,
                                                               std::bind(&RouteFollowingPlugin::current_maneuver_plan_cb,this,std_ph::_1));
+    bumper_pose_sub_ = create_subscription<geometry_msgs::msg::PoseStamped>("front_bumper_pose", 1,
+                                                              std::bind(&RouteFollowingPlugin::bumper_pose_cb,this,std_ph::_1));
     
     // set world model point form wm listener
     wml_ = get_world_model_listener();
 
+    // Reuse the front bumper downtrack already computed by the route node when it is available
+    wml_->enableRouteStateUpdates();
+
     wm_ = get_world_model();
 
     //set a route callback to update route and calculate maneuver
@@ -141,18 +146,12 @@ void setManeuverLaneletIds(carma_planning_msgs::msg::Maneuver& mvr, lanelet::Id
         }
     });
 
-    initializeBumperTransformLookup();
-    
     // Return success if everthing initialized successfully
     return CallbackReturn::SUCCESS;
   }
 
     carma_ros2_utils::CallbackReturn RouteFollowingPlugin::on_activate_plugin()
     {
-        bumper_pose_timer_ = create_timer(get_clock(),
-            std::chrono::milliseconds(100),
-            std::bind(&RouteFollowingPlugin::bumper_pose_cb, this));
-
         // Return success if everthing initialized successfully
         return CallbackReturn::SUCCESS;
     }
@@ -528,32 +527,20 @@ void setManeuverLaneletIds(carma_planning_msgs::msg::Maneuver& mvr, lanelet::Id
         return;
     }
 
-    void RouteFollowingPlugin::bumper_pose_cb()
+    void RouteFollowingPlugin::bumper_pose_cb(geometry_msgs::msg::PoseStamped::UniquePtr msg)
     {
         RCLCPP_DEBUG_STREAM(get_logger(),"Entering pose_cb");
 
-        RCLCPP_DEBUG_STREAM(get_logger(),"Looking up front bumper pose...");
-        
-        try
-        {
-            tf_ = tf2_buffer_.lookupTransform("map", "vehicle_front", rclcpp::Time(0), rclcpp::Duration(1, 0)); //save to local copy of transform 1 sec timeout
-            tf2::fromMsg(tf_, frontbumper_transform_);
-        }
-        catch (const tf2::TransformException &ex)
-        {
-            RCLCPP_WARN_STREAM(get_logger(),std::string(ex.what()));
-        }
+        // Route monitoring only runs while the plugin is active
+        if (get_current_state().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+            return;
 
-        geometry_msgs::msg::Pose front_bumper_pose;
-        front_bumper_pose.position.x = frontbumper_transform_.getOrigin().getX();
-        front_bumper_pose.position.y = frontbumper_transform_.getOrigin().getY();
-        
         if (!wm_->getRoute())
             return;
 
-        lanelet::BasicPoint2d current_loc(front_bumper_pose.position.x, front_bumper_pose.position.y);
+        lanelet::BasicPoint2d current_loc(msg->pose.position.x, msg->pose.position.y);
         current_loc_ = current_loc;
-        double current_progress = wm_->routeTrackPos(current_loc).downtrack;
+        double current_progress = wml_->getEgoTrackState(current_loc, msg->header.stamp).route_track_pos.downtrack;
         
         RCLCPP_DEBUG_STREAM(get_logger(),"pose_cb : current_progress" << current_progress);
         
@@ -825,21 +812,7 @@ void setManeuverLaneletIds(carma_planning_msgs::msg::Maneuver& mvr, lanelet::Id
 
     double RouteFollowingPlugin::findSpeedLimit(const lanelet::ConstLanelet &llt)
     {
-        lanelet::Optional<carma_wm::TrafficRulesConstPtr> traffic_rules = wm_->getTrafficRules();
-        if (traffic_rules)
-        {
-            return (*traffic_rules)->speedLimit(llt).speedLimit.value();
-        }
-        else
-        {
-            throw std::invalid_argument("Valid traffic rules object could not be built");
-        }
-    }
-
-    void RouteFollowingPlugin::initializeBumperTransformLookup() 
-    {
-        tf2_listener_.reset(new tf2_ros::TransformListener(tf2_buffer_));
-        tf2_buffer_.setUsingDedicatedThread(true);
+        return wm_->getSpeedLimit(llt);
     }
 
     void RouteFollowingPlugin::returnToShortestPath(const lanelet::ConstLanelet &current_lanelet)
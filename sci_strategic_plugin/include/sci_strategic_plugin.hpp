@@ -35,6 +35,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <carma_guidance_plugins/strategic_plugin.hpp>
+#include <carma_guidance_plugins/guidance_state_gate.hpp>
 #include "sci_strategic_plugin_config.hpp"
 
 namespace sci_strategic_plugin
@@ -329,6 +330,9 @@ public:
   // timer to publish mobility operation message
   rclcpp::TimerBase::SharedPtr mob_op_pub_timer_;
 
+  // Suspends mob_op_pub_timer_ while guidance is not engaged
+  carma_guidance_plugins::GuidanceStateGate guidance_state_gate_;
+
   //! World Model pointer
   carma_wm::WorldModelConstPtr wm_;
 
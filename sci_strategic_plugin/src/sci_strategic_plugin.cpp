@@ -126,7 +126,7 @@ carma_ros2_utils::CallbackReturn SCIStrategicPlugin::on_configure_plugin()
     std::bind(&SCIStrategicPlugin::BSMCb,this,std_ph::_1));
 
   // Guidance State subscriber
-  guidance_state_sub_ = create_subscription<carma_planning_msgs::msg::GuidanceState>("guidance_state", 5, 
+  guidance_state_sub_ = create_subscription<carma_planning_msgs::msg::GuidanceState>("guidance_state", carma_guidance_plugins::GuidanceStateGate::qos(), 
     std::bind(&SCIStrategicPlugin::guidance_state_cb, this, std::placeholders::_1));
 
   // set world model point form wm listener
@@ -164,6 +164,9 @@ carma_ros2_utils::CallbackReturn SCIStrategicPlugin::on_activate_plugin()
     std::chrono::duration<double>(0.1),
     std::bind(&SCIStrategicPlugin::publishMobilityOperation, this));
 
+  guidance_state_gate_.clear_timers();
+  guidance_state_gate_.add_timer(mob_op_pub_timer_);
+
   return CallbackReturn::SUCCESS;
 }
 
@@ -226,6 +229,7 @@ void SCIStrategicPlugin::BSMCb(carma_v2x_msgs::msg::BSM::UniquePtr msg)
 void SCIStrategicPlugin::guidance_state_cb(const carma_planning_msgs::msg::GuidanceState::UniquePtr msg)
 {
   guidance_engaged_ = (msg->state == carma_planning_msgs::msg::GuidanceState::ENGAGED);
+  guidance_state_gate_.on_guidance_state(*msg, get_clock()->now());
 }
 
 void SCIStrategicPlugin::currentPoseCb(geometry_msgs::msg::PoseStamped::UniquePtr msg)
@@ -780,15 +784,7 @@ carma_planning_msgs::msg::Maneuver SCIStrategicPlugin::composeLaneFollowingManeu
 
 double SCIStrategicPlugin::findSpeedLimit(const lanelet::ConstLanelet& llt) const
 {
-  lanelet::Optional<carma_wm::TrafficRulesConstPtr> traffic_rules = wm_->getTrafficRules();
-  if (traffic_rules)
-  {
-    return (*traffic_rules)->speedLimit(llt).speedLimit.value();
-  }
-  else
-  {
-    throw std::invalid_argument("Valid traffic rules object could not be built");
-  }
+  return wm_->getSpeedLimit(llt);
 }
 
 carma_v2x_msgs::msg::MobilityOperation SCIStrategicPlugin::generateMobilityOperation()
@@ -372,15 +372,7 @@ return maneuver_msg;
 
 double StopAndDwellStrategicPlugin::findSpeedLimit(const lanelet::ConstLanelet& llt) const
 {
-  lanelet::Optional<carma_wm::TrafficRulesConstPtr> traffic_rules = wm_->getTrafficRules();
-  if (traffic_rules)
-  {
-    return (*traffic_rules)->speedLimit(llt).speedLimit.value();
-  }
-  else
-  {
-    throw std::invalid_argument("Valid traffic rules object could not be built");
-  }
+  return wm_->getSpeedLimit(llt);
 }
 
 carma_planning_msgs::msg::Maneuver StopAndDwellStrategicPlugin::composeStopAndWaitManeuverMessage(double current_dist, double end_dist,
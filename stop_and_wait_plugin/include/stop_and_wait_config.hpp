@@ -24,7 +24,6 @@
 struct StopandWaitConfig
 {
   double minimal_trajectory_duration = 6.0;  // Trajectory length in seconds
-  double stop_timestep = 0.1;                // Size of timesteps between stopped trajectory points
   double trajectory_step_size = 1.0;         // Downtrack distance between trajectory points
   double accel_limit_multiplier = 0.5;       // Multiplier to compine with actual accel limit for target planning
   double accel_limit = 2.0;                  // Longitudinal acceleration limit of the vehicle
@@ -39,7 +38,6 @@ struct StopandWaitConfig
   {
     output << "StopandWaitConfig { " << std::endl
            << "minimal_trajectory_duration: " << c.minimal_trajectory_duration << std::endl
-           << "stop_timestep: " << c.stop_timestep << std::endl
            << "trajectory_step_size: " << c.trajectory_step_size << std::endl
            << "accel_limit_multiplier: " << c.accel_limit_multiplier << std::endl
            << "accel_limit: " << c.accel_limit << std::endl
@@ -390,12 +390,13 @@ std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> StopandWait::compose_
 
   auto traj = trajectory_from_points_times_orientations(raw_points, times, yaws, start_time);
 
-  while (rclcpp::Time(traj.back().target_time) - rclcpp::Time(traj.front().target_time) < rclcpp::Duration(config_.minimal_trajectory_duration * 1e9))
+  // Hold at the final point until the trajectory spans the minimal duration.
+  // No hold is needed if it already does, and a zero length hold would repeat the final target_time.
+  double trajectory_duration = (rclcpp::Time(traj.back().target_time) - rclcpp::Time(traj.front().target_time)).seconds();
+  double hold_duration = config_.minimal_trajectory_duration - trajectory_duration;
+  if (hold_duration > 0.0)
   {
-    carma_planning_msgs::msg::TrajectoryPlanPoint new_point = traj.back();
-    new_point.target_time = rclcpp::Time(new_point.target_time) + rclcpp::Duration(config_.stop_timestep * 1e9);
-    new_point.planner_plugin_name = plugin_name_;
-    traj.push_back(new_point);
+    basic_autonomy::waypoint_generation::append_terminal_hold(traj, hold_duration, plugin_name_);
   }
 
   if (!filtered_speeds.empty())
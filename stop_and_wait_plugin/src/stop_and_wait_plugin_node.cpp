@@ -28,7 +28,6 @@ namespace stop_and_wait_plugin
 
     // Declare parameters
     config_.minimal_trajectory_duration = declare_parameter<double>("minimal_trajectory_duration", config_.minimal_trajectory_duration);
-    config_.stop_timestep = declare_parameter<double>("stop_timestep", config_.stop_timestep);
     config_.trajectory_step_size = declare_parameter<double>("trajectory_step_size", config_.trajectory_step_size);
     config_.accel_limit_multiplier = declare_parameter<double>("accel_limit_multiplier", config_.accel_limit_multiplier);
     config_.accel_limit = declare_parameter<double>("vehicle_acceleration_limit", config_.accel_limit);
@@ -45,7 +44,6 @@ namespace stop_and_wait_plugin
 
     auto error = update_params<double>({
       {"minimal_trajectory_duration", config_.minimal_trajectory_duration},
-      {"stop_timestep", config_.stop_timestep},
       {"trajectory_step_size", config_.trajectory_step_size},
       {"accel_limit_multiplier", config_.accel_limit_multiplier},
       {"crawl_speed", config_.crawl_speed},
@@ -64,7 +62,6 @@ namespace stop_and_wait_plugin
   {
 
     get_parameter<double>("minimal_trajectory_duration", config_.minimal_trajectory_duration);
-    get_parameter<double>("stop_timestep", config_.stop_timestep);
     get_parameter<double>("trajectory_step_size", config_.trajectory_step_size);
     get_parameter<double>("accel_limit_multiplier", config_.accel_limit_multiplier);
     get_parameter<double>("vehicle_acceleration_limit", config_.accel_limit);
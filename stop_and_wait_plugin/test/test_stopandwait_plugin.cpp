@@ -52,7 +52,6 @@ namespace stop_and_wait_plugin
 //   StopandWaitConfig config;
 
 //   config.minimal_trajectory_duration = 6.0;    // Trajectory length in seconds
-//   config.stop_timestep = 0.1;                  // Size of timesteps between stopped trajectory points
 //   config.trajectory_step_size = 1;                  // Amount to downsample input lanelet centerline data.
 //   config.accel_limit_multiplier = 0.5;         // Multiplier to compine with actual accel limit for target planning
 //   config.accel_limit = 2.0;                    // Longitudinal acceleration limit of the vehicle
@@ -131,6 +130,51 @@ namespace stop_and_wait_plugin
 //     prev_time = point.target_time;
 //   }
 // }
+
+TEST(StopandWait, compose_trajectory_terminal_hold)
+{
+  StopandWaitConfig config;
+  std::shared_ptr<carma_wm::CARMAWorldModel> wm = std::make_shared<carma_wm::CARMAWorldModel>();
+
+  // Straight path of 50 m with points every meter
+  std::vector<PointSpeedPair> points;
+  for (int i = 0; i <= 50; i++)
+  {
+    PointSpeedPair pair;
+    pair.point = lanelet::BasicPoint2d(i, 0.0);
+    pair.speed = 5.0;
+    points.push_back(pair);
+  }
+
+  double initial_speed = 0.0;
+
+  // A trajectory shorter than the minimal duration ends in a hold at the stop point
+  config.minimal_trajectory_duration = 100.0;
+  StopandWait long_plugin(nullptr, wm, config, "stop_and_wait_plugin", "v1.0");
+
+  auto traj = long_plugin.compose_trajectory_from_centerline(points, 0.0, 5.0, 50.0, 3.0, rclcpp::Time(0), 2.0, initial_speed);
+
+  auto hold = basic_autonomy::waypoint_generation::get_terminal_hold(traj);
+  ASSERT_TRUE(!!hold);
+  ASSERT_EQ(traj.size() - 2, hold->stop_index);
+  ASSERT_GT(hold->duration, 0.0);
+  ASSERT_NEAR(100.0, (rclcpp::Time(traj.back().target_time) - rclcpp::Time(traj.front().target_time)).seconds(), 0.001);
+  ASSERT_EQ("stop_and_wait_plugin", traj.back().planner_plugin_name);
+
+  // A trajectory which already spans the minimal duration gets no hold so target times stay strictly increasing
+  config.minimal_trajectory_duration = 1.0;
+  StopandWait short_plugin(nullptr, wm, config, "stop_and_wait_plugin", "v1.0");
+
+  traj = short_plugin.compose_trajectory_from_centerline(points, 0.0, 5.0, 50.0, 3.0, rclcpp::Time(0), 2.0, initial_speed);
+
+  ASSERT_FALSE(!!basic_autonomy::waypoint_generation::get_terminal_hold(traj));
+  ASSERT_EQ(points.size(), traj.size());
+  for (size_t i = 1; i < traj.size(); i++)
+  {
+    ASSERT_LT(rclcpp::Time(traj[i - 1].target_time), rclcpp::Time(traj[i].target_time));
+  }
+}
+
 }  // namespace stop_and_wait_plugin
 
 int main(int argc, char ** argv)
@@ -161,6 +161,8 @@ public:
 
   double epsilon_ = 0.001; //Small constant to compare (double) 0.0 with
 
+  basic_autonomy::waypoint_generation::TrajectoryWorkspace trajectory_workspace_; // Reused across trajectory requests
+
   // Unit Test Accessors
   FRIEND_TEST(StopControlledIntersectionTacticalPlugin, TestSCIPlanning_case_one);
   FRIEND_TEST(StopControlledIntersectionTacticalPlugin, TestSCIPlanning_case_two);
@@ -484,17 +484,21 @@ std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> StopControlledInterse
     
     int nearest_pt_index = basic_autonomy::waypoint_generation::get_nearest_point_index(points, state);
     RCLCPP_DEBUG_STREAM(rclcpp::get_logger("stop_controlled_intersection_tactical_plugin"), "Nearest pt index: "<<nearest_pt_index);
-    std::vector<PointSpeedPair> future_points(points.begin() + nearest_pt_index + 1, points.end()); //Points in front of current vehicle position
-    RCLCPP_DEBUG_STREAM(rclcpp::get_logger("stop_controlled_intersection_tactical_plugin"), "Future points size: "<<future_points.size());
-    auto time_bound_points = basic_autonomy::waypoint_generation::constrain_to_time_boundary(future_points, config_.trajectory_time_length);
+    auto& time_bound_points = trajectory_workspace_.time_bound_points;
+    time_bound_points.assign(points.begin() + nearest_pt_index + 1, points.end()); //Points in front of current vehicle position
+    RCLCPP_DEBUG_STREAM(rclcpp::get_logger("stop_controlled_intersection_tactical_plugin"), "Future points size: "<<time_bound_points.size());
+    basic_autonomy::waypoint_generation::constrain_to_time_boundary(&time_bound_points, config_.trajectory_time_length, trajectory_workspace_);
     RCLCPP_DEBUG_STREAM(rclcpp::get_logger("stop_controlled_intersection_tactical_plugin"), "Got time bound points with size:" << time_bound_points.size());
 
     //Attach past points
-    std::vector<PointSpeedPair> back_and_future = attach_past_points(points, time_bound_points, nearest_pt_index, config_.back_distance);
+    auto& back_and_future = trajectory_workspace_.back_and_future;
+    basic_autonomy::waypoint_generation::attach_past_points(points, time_bound_points, nearest_pt_index, config_.back_distance, &back_and_future);
     RCLCPP_DEBUG_STREAM(rclcpp::get_logger("stop_controlled_intersection_tactical_plugin"), "Got back_and_future points with size: "<<back_and_future.size());
 
-    std::vector<double> speed_limits;
-    std::vector<lanelet::BasicPoint2d> curve_points;
+    auto& speed_limits = trajectory_workspace_.speeds;
+    auto& curve_points = trajectory_workspace_.curve_points;
+    speed_limits.clear();
+    curve_points.clear();
     split_point_speed_pairs(time_bound_points, &curve_points, &speed_limits);
 
     std::unique_ptr<basic_autonomy::smoothing::SplineI> fit_curve = basic_autonomy::waypoint_generation::compute_fit(curve_points); //Compute splines based on curve points
@@ -506,15 +510,10 @@ std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> StopControlledInterse
     RCLCPP_DEBUG_STREAM(rclcpp::get_logger("stop_controlled_intersection_tactical_plugin"), "Got fit");
     RCLCPP_DEBUG_STREAM(rclcpp::get_logger("stop_controlled_intersection_tactical_plugin"), "Speed_limits.size(): "<<speed_limits.size());
 
-    std::vector<lanelet::BasicPoint2d> all_sampling_points;
-    all_sampling_points.reserve(1 + curve_points.size() * 2);
-
-    std::vector<double> distributed_speed_limits;
-    distributed_speed_limits.reserve(1+ curve_points.size() * 2);
-
     //Compute total length of the trajectory to get correct number of points
     // we expect using curve resample step size
-    std::vector<double> downtracks_raw = carma_wm::geometry::compute_arc_lengths(curve_points);
+    auto& downtracks_raw = trajectory_workspace_.downtracks;
+    basic_autonomy::waypoint_generation::compute_arc_lengths(curve_points, &downtracks_raw);
 
     auto total_step_along_curve = static_cast<int>(downtracks_raw.back() / config_.curve_resample_step_size);
 
@@ -523,8 +522,18 @@ std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> StopControlledInterse
 
     double step_threshold_for_next_speed = (double)total_step_along_curve / (double)total_point_size;
     double scaled_steps_along_curve = 0.0; // from 0 (start) to 1 (end) for the whole trajectory
-    std::vector<double> better_curvature;
-    better_curvature.reserve(1 + curve_points.size() * 2);
+
+    auto& all_sampling_points = trajectory_workspace_.sampling_points;
+    all_sampling_points.clear();
+    all_sampling_points.reserve(total_step_along_curve + 1);
+
+    auto& distributed_speed_limits = trajectory_workspace_.distributed_speed_limits;
+    distributed_speed_limits.clear();
+    distributed_speed_limits.reserve(total_step_along_curve + 1);
+
+    auto& better_curvature = trajectory_workspace_.raw_curvatures;
+    better_curvature.clear();
+    better_curvature.reserve(total_step_along_curve + 1);
 
     for (size_t steps_along_curve = 0; steps_along_curve < total_step_along_curve; steps_along_curve++) // Resample curve at tighter resolution
     {
@@ -546,13 +555,14 @@ std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> StopControlledInterse
 
     std::vector<double> final_yaw_values = carma_wm::geometry::compute_tangent_orientations(all_sampling_points);
 
-    std::vector<double> curvatures = basic_autonomy::smoothing::moving_average_filter(better_curvature, config_.curvature_moving_average_window_size, false);
+    auto& curvatures = trajectory_workspace_.curvatures;
+    basic_autonomy::smoothing::moving_average_filter(better_curvature, config_.curvature_moving_average_window_size, false, &curvatures);
     std::vector<double> ideal_speeds =
         trajectory_utils::constrained_speeds_for_curvatures(curvatures, config_.lateral_accel_limit);
 
-    std::vector<double> constrained_speed_limits = basic_autonomy::waypoint_generation::apply_speed_limits(ideal_speeds, distributed_speed_limits); //Speed min(ideal, calculated)
+    auto& constrained_speed_limits = trajectory_workspace_.constrained_speed_limits;
+    basic_autonomy::waypoint_generation::apply_speed_limits(ideal_speeds, distributed_speed_limits, &constrained_speed_limits); //Speed min(ideal, calculated)
     RCLCPP_DEBUG_STREAM(rclcpp::get_logger("stop_controlled_intersection_tactical_plugin"), "Processed all points in computed fit");
-    std::vector<double> final_actual_speeds = constrained_speed_limits;
 
     if (all_sampling_points.empty())
     {
@@ -561,26 +571,24 @@ std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> StopControlledInterse
     }
 
     //Drop Past points
+    // The point just behind the vehicle is kept and replaced by the current vehicle state so no elements have to be shifted to add it.
     nearest_pt_index = basic_autonomy::waypoint_generation::get_nearest_index_by_downtrack(all_sampling_points, wm_, state);
-    std::vector<lanelet::BasicPoint2d> future_basic_points(all_sampling_points.begin() + nearest_pt_index + 1,
-                                                            all_sampling_points.end());
-    std::vector<double> future_speeds(final_actual_speeds.begin() + nearest_pt_index + 1, 
-                                    final_actual_speeds.end());                                                            
-    std::vector<double> future_yaw(final_yaw_values.begin() + nearest_pt_index + 1,
-                                    final_yaw_values.end());
+    all_sampling_points.erase(all_sampling_points.begin(), all_sampling_points.begin() + nearest_pt_index);
+    constrained_speed_limits.erase(constrained_speed_limits.begin(), constrained_speed_limits.begin() + nearest_pt_index);
+    final_yaw_values.erase(final_yaw_values.begin(), final_yaw_values.begin() + nearest_pt_index);
 
     // Add current vehicle point to front of the trajectory
-    lanelet::BasicPoint2d cur_veh_point(state.x_pos_global, state.y_pos_global);
-
-    future_basic_points.insert(future_basic_points.begin(),
-                                cur_veh_point); // Add current vehicle position to front of sample points
-    future_speeds.insert(future_speeds.begin(), state.longitudinal_vel);
-    future_yaw.insert(future_yaw.begin(), state.orientation);
+    auto& future_basic_points = all_sampling_points;
+    future_basic_points.front() = lanelet::BasicPoint2d(state.x_pos_global, state.y_pos_global);
+    constrained_speed_limits.front() = state.longitudinal_vel;
+    final_yaw_values.front() = state.orientation;
 
     // Compute points to local downtracks
-    std::vector<double> downtracks = carma_wm::geometry::compute_arc_lengths(future_basic_points);
+    auto& downtracks = trajectory_workspace_.downtracks;
+    basic_autonomy::waypoint_generation::compute_arc_lengths(future_basic_points, &downtracks);
 
-    final_actual_speeds = basic_autonomy::smoothing::moving_average_filter(future_speeds, config_.speed_moving_average_window_size);
+    auto& final_actual_speeds = trajectory_workspace_.speeds;
+    basic_autonomy::smoothing::moving_average_filter(constrained_speed_limits, config_.speed_moving_average_window_size, true, &final_actual_speeds);
 
     // Convert speeds to times
     std::vector<double> times;
@@ -594,7 +602,7 @@ std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> StopControlledInterse
 
     // Build trajectory points
     std::vector<carma_planning_msgs::msg::TrajectoryPlanPoint> traj_points =
-        basic_autonomy::waypoint_generation::trajectory_from_points_times_orientations(future_basic_points, times, future_yaw, state_time, "default");
+        basic_autonomy::waypoint_generation::trajectory_from_points_times_orientations(future_basic_points, times, final_yaw_values, state_time, "default");
 
     return traj_points;
 }
@@ -19,12 +19,14 @@
 
 
 #include <memory>
+#include <vector>
 
 #include "carma_msgs/msg/system_alert.hpp"
 #include "ros2_lifecycle_manager/ros2_lifecycle_manager.hpp"
 #include "rclcpp/rclcpp.hpp"
 #include "carma_ros2_utils/carma_lifecycle_node.hpp"
 #include "subsystem_controllers/base_subsystem_controller/base_subsystem_controller_config.hpp"
+#include "subsystem_controllers/base_subsystem_controller/topic_health_monitor.hpp"
 
 namespace subsystem_controllers
 {
@@ -35,6 +37,9 @@ namespace subsystem_controllers
    *  - Takes in a list of required nodes and a namespace
    *  - Manages the lifecycle of all nodes which are the union of the required nodes and the namespace
    *  - Monitors the system_alert topic and if a node within its required node set crashes it notifies the larger system that the subsystem has failed  
+   *  - Monitors the rate and message age of the topics listed in the monitored_topics parameter while active. 
+   *    A topic which falls outside its bounds is reported with a SystemAlert::CAUTION, or a SystemAlert::WARNING if it is far outside its bounds.
+   *    Alerts are only published when the graded health of a topic changes.
    */ 
   class BaseSubsystemController : public carma_ros2_utils::CarmaLifecycleNode
   {
@@ -86,6 +91,19 @@ namespace subsystem_controllers
      */ 
     std::vector<std::string> get_non_intersecting_set(const std::vector<std::string>& set_a, const std::vector<std::string>& set_b) const;
 
+    /**
+     * \brief Create the trackers and subscriptions for the topics in base_config_.monitored_topics
+     * 
+     * \throw std::invalid_argument if an entry is malformed or has an unsupported message type
+     */ 
+    void create_topic_health_monitors();
+
+    /**
+     * \brief Evaluate the monitored topics and publish a SystemAlert for each topic whose graded health changed.
+     *        Does nothing unless this node is active.
+     */ 
+    void on_topic_health_timer();
+
     //! Lifecycle Manager which will track the managed nodes and call their lifecycle services on request
     ros2_lifecycle_manager::Ros2LifecycleManager lifecycle_mgr_;
 
@@ -95,6 +113,15 @@ namespace subsystem_controllers
     //! The configuration struct
     BaseSubSystemControllerConfig base_config_;
 
+    //! Trackers for the monitored topics. Indexed in the same order as base_config_.monitored_topics
+    std::vector<TopicHealthTracker> topic_health_trackers_;
+
+    //! Subscriptions used to sample the monitored topics
+    std::vector<rclcpp::SubscriptionBase::SharedPtr> topic_health_subs_;
+
+    //! Timer which periodically evaluates the monitored topics
+    rclcpp::TimerBase::SharedPtr topic_health_timer_;
+
     //! Collection of flags which, if true, will cause the base class to make lifecycle service calls to managed nodes
     //  when ever the respective handle_on_<event> methods (ie. handle_on_configure) are called. 
     //  by setting these flags to false an extending class chooses to implement that call itself. 
@@ -105,6 +132,14 @@ namespace subsystem_controllers
     bool trigger_managed_nodes_activate_from_base_class_ = true;
     bool trigger_managed_nodes_deactivate_from_base_class_ = true;
     bool trigger_managed_nodes_cleanup_from_base_class_ = true;
+
+  private:
+
+    /**
+     * \brief Subscribe to the monitored topic at the provided index of topic_health_trackers_ with message type MsgT
+     */ 
+    template <class MsgT>
+    void add_topic_health_subscription(size_t index);
   };
 
 } // namespace subsystem_controllers
@@ -45,6 +45,13 @@ namespace subsystem_controllers
     //! If this flag is true then all nodes under subsystem_namespace are treated as required in addition to any nodes in required_subsystem_nodes
     bool full_subsystem_required = false;
 
+    //! List of topics critical to the subsystem whose rate and message age will be monitored.
+    //  Each entry has the form "<topic>, <type>, <min_rate_hz>, <max_age_ms>"
+    std::vector<std::string> monitored_topics;
+
+    //! Period in ms over which the monitored topics are evaluated
+    int topic_health_check_period_ms = 1000;
+
     // Stream operator for this config
     friend std::ostream &operator<<(std::ostream &output, const BaseSubSystemControllerConfig &c)
     {
@@ -54,6 +61,7 @@ namespace subsystem_controllers
              << "call_timeout_ms: " << c.call_timeout_ms << std::endl
              << "subsystem_namespace: " << c.subsystem_namespace << std::endl
              << "full_subsystem_required: " << c.full_subsystem_required << std::endl
+             << "topic_health_check_period_ms: " << c.topic_health_check_period_ms << std::endl
              << "unmanaged_required_nodes: [ " << std::endl;
             
             for (auto node : c.unmanaged_required_nodes)
@@ -64,6 +72,11 @@ namespace subsystem_controllers
       for (auto node : c.required_subsystem_nodes)
         output << node << " ";
 
+      output << "] " << std::endl << "monitored_topics: [ ";
+
+      for (auto topic : c.monitored_topics)
+        output << topic << " | ";
+
       output << "] " << std::endl
              << "}" << std::endl;
       return output;
@@ -0,0 +1,151 @@
+#pragma once
+
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <rclcpp/time.hpp>
+
+namespace subsystem_controllers
+{
+  /**
+   * \brief Expected timing of a single topic which is critical to a subsystem
+   */
+  struct TopicHealthSpec
+  {
+    //! Fully qualified name of the topic
+    std::string topic;
+
+    //! Message type of the topic. For example geometry_msgs/msg/PoseStamped
+    std::string type;
+
+    //! Minimum acceptable receive rate in Hz. A value <= 0 disables the rate check
+    double min_rate_hz = 0.0;
+
+    //! Maximum acceptable age of a message on receipt, measured from its header stamp, in ms.
+    //  A value <= 0 disables the age check. Ignored for message types without a header.
+    double max_age_ms = 0.0;
+  };
+
+  /**
+   * \brief Parse a topic health spec from the monitored_topics parameter format
+   *
+   * \param entry A string of the form "<topic>, <type>, <min_rate_hz>, <max_age_ms>"
+   *
+   * \throw std::invalid_argument if the entry is malformed
+   *
+   * \return The parsed spec
+   */
+  TopicHealthSpec parse_topic_health_spec(const std::string& entry);
+
+  /**
+   * \brief Graded health of a monitored topic. Ordered from best to worst.
+   */
+  enum class TopicHealthLevel
+  {
+    NOMINAL = 0,  // Within the spec
+    DEGRADED = 1, // Slower than min_rate_hz or older than max_age_ms. Reported as a SystemAlert::CAUTION
+    CRITICAL = 2  // Slower than half of min_rate_hz or older than twice max_age_ms. Reported as a SystemAlert::WARNING
+  };
+
+  /**
+   * \brief Result of evaluating a monitored topic over one check period
+   */
+  struct TopicHealthReport
+  {
+    TopicHealthLevel level = TopicHealthLevel::NOMINAL;
+
+    //! Receive rate over the check period in Hz
+    double rate_hz = 0.0;
+
+    //! Largest message age observed over the check period in ms. 0 if no stamped messages were received
+    double max_age_ms = 0.0;
+
+    //! Human readable summary of the violated bounds. Empty if the level is NOMINAL
+    std::string description;
+  };
+
+  /**
+   * \brief Tracks the receive rate and message age of a single topic.
+   *
+   * Samples are accumulated with constant cost per message and reduced once per check period by evaluate(),
+   * which starts a new period. The tracker performs no ROS communication so it can be driven directly in tests.
+   */
+  class TopicHealthTracker
+  {
+  public:
+    /**
+     * \brief Constructor
+     *
+     * \param spec The expected timing of the topic
+     */
+    explicit TopicHealthTracker(TopicHealthSpec spec);
+
+    /**
+     * \brief Discard all samples and start a new check period at the provided time
+     */
+    void reset(const rclcpp::Time& now);
+
+    /**
+     * \brief Record the receipt of a message without a header stamp
+     */
+    void on_message(const rclcpp::Time& receive_time);
+
+    /**
+     * \brief Record the receipt of a message with the provided header stamp
+     */
+    void on_message(const rclcpp::Time& receive_time, const rclcpp::Time& stamp);
+
+    /**
+     * \brief Grade the samples received since the last call to evaluate() or reset() and start a new check period
+     *
+     * \param now The current time
+     *
+     * \return The health of the topic over the completed period
+     */
+    TopicHealthReport evaluate(const rclcpp::Time& now);
+
+    /**
+     * \brief Returns the level reported by the most recent call to evaluate()
+     */
+    TopicHealthLevel get_level() const;
+
+    const TopicHealthSpec& get_spec() const;
+
+  private:
+    TopicHealthSpec spec_;
+
+    rclcpp::Time period_start_;
+    size_t message_count_ = 0;
+    double max_age_ms_ = 0.0;
+    TopicHealthLevel level_ = TopicHealthLevel::NOMINAL;
+  };
+
+  /**
+   * \brief Trait which is true if MsgT has a std_msgs/Header member named header
+   */
+  template <class MsgT, class = void>
+  struct has_header : std::false_type {};
+
+  template <class MsgT>
+  struct has_header<MsgT, std::void_t<decltype(std::declval<MsgT>().header.stamp)>> : std::true_type {};
+
+  std::ostream &operator<<(std::ostream &output, const TopicHealthSpec &spec);
+
+} // namespace subsystem_controllers
@@ -22,9 +22,15 @@
 
 #include <carma_msgs/msg/system_alert.hpp>
 #include <carma_planning_msgs/msg/plugin.hpp>
+#include <carma_planning_msgs/msg/maneuver_plan.hpp>
 #include <carma_planning_msgs/srv/get_plugin_api.hpp>
 #include <carma_planning_msgs/srv/plugin_list.hpp>
 #include <carma_planning_msgs/srv/plugin_activation.hpp>
+#include <carma_v2x_msgs/msg/mobility_request.hpp>
+#include <carma_v2x_msgs/msg/mobility_operation.hpp>
+#include <carma_v2x_msgs/msg/spat.hpp>
+#include <carma_v2x_msgs/msg/bsm.hpp>
+#include <carma_wm/WMListener.hpp>
 #include <ros2_lifecycle_manager/ros2_lifecycle_manager.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include "subsystem_controllers/base_subsystem_controller/base_subsystem_controller.hpp"
@@ -61,6 +67,32 @@ namespace subsystem_controllers
     cr2::CallbackReturn handle_on_shutdown(const rclcpp_lifecycle::State &);
 
   private:
+
+    /**
+     * \brief Create the world model listener and V2X subscriptions needed to observe the configured activation triggers
+     */
+    void create_activation_trigger_sources();
+
+    /**
+     * \brief Callback for the context activation timer. Observes route triggers then updates the context activated plugins
+     */
+    void on_context_activation_timer();
+
+    /**
+     * \brief Callback for the arbitrator's final maneuver plan. Observes the capability triggers of the plugins selected to plan it
+     */
+    void on_final_maneuver_plan(carma_planning_msgs::msg::ManeuverPlan::UniquePtr msg);
+
+    /**
+     * \brief Helper to subscribe to a V2X message which observes the provided trigger on each message
+     *
+     * \tparam MsgT The type of V2X message
+     * \param topic The topic to subscribe to
+     * \param trigger The trigger observed on each message
+     */
+    template <typename MsgT>
+    void add_v2x_trigger_subscription(const std::string& topic, const std::string& trigger);
+
     //! Plugin manager to handle all the plugin specific discovery and reporting
     std::shared_ptr<PluginManager> plugin_manager_; 
 
@@ -83,6 +115,18 @@ namespace subsystem_controllers
 
     cr2::ServicePtr<carma_planning_msgs::srv::GetPluginApi> get_control_plugins_by_capability_server_;
 
+    //! Subscriptions observing v2x: activation triggers
+    std::vector<rclcpp::SubscriptionBase::SharedPtr> v2x_trigger_subs_;
+
+    //! Subscription to the final maneuver plan used to observe capability: activation triggers. Only created if such a trigger is configured
+    rclcpp::Subscription<carma_planning_msgs::msg::ManeuverPlan>::SharedPtr final_maneuver_plan_sub_;
+
+    //! World model listener used to observe regulatory: activation triggers. Only created if such a trigger is configured
+    std::shared_ptr<carma_wm::WMListener> wm_listener_;
+
+    //! Timer which updates the context activated plugins
+    rclcpp::TimerBase::SharedPtr context_activation_timer_;
+
   };
 
 } // namespace v2x_controller
@@ -40,6 +40,16 @@ namespace subsystem_controllers
     //! List of guidance plugins that are ROS2. If it is not in the list, it is assumed to be ROS1 and not managed
     std::vector<std::string> ros2_initial_plugins;
 
+    //! List of guidance plugins which are kept dormant until the driving context requires them.
+    //  Each entry has the form "<plugin>, <trigger>[, <trigger>...]". See plugin_activation_policy.hpp for the trigger types
+    std::vector<std::string> context_activated_plugins;
+
+    //! How long a context activated plugin stays active after its triggers were last observed in milliseconds
+    int context_activation_hold_ms = 10000;
+
+    //! Period at which the context activated plugins are evaluated in milliseconds
+    int context_activation_check_period_ms = 1000;
+
     // Stream operator for this config
     friend std::ostream &operator<<(std::ostream &output, const GuidanceControllerConfig &c)
     {
@@ -59,8 +69,15 @@ namespace subsystem_controllers
 
        for (auto node : c.ros2_initial_plugins)
         output << node << " ";
+
+      output << "] " << std::endl << "context_activated_plugins: [ ";
+
+      for (auto entry : c.context_activated_plugins)
+        output << "{" << entry << "} ";
       
       output << "] " << std::endl 
+        << "context_activation_hold_ms: " << c.context_activation_hold_ms << std::endl
+        << "context_activation_check_period_ms: " << c.context_activation_check_period_ms << std::endl
         << "}" << std::endl;
       return output;
     }
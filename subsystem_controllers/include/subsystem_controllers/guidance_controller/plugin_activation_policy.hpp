@@ -0,0 +1,58 @@
+#pragma once
+
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <string>
+#include <vector>
+
+namespace subsystem_controllers
+{
+    //! Trigger prefix for regulatory elements along the route. Followed by the regulatory element subtype. For example regulatory:carma_traffic_signal
+    const std::string REGULATORY_TRIGGER_PREFIX = "regulatory:";
+
+    //! Trigger prefix for recently received V2X messages. Followed by the message kind. For example v2x:mobility_request
+    const std::string V2X_TRIGGER_PREFIX = "v2x:";
+
+    //! Trigger prefix for capabilities of the plugins selected to plan the current maneuver plan. Followed by the capability. For example capability:tactical_plan/plan_trajectory
+    const std::string CAPABILITY_TRIGGER_PREFIX = "capability:";
+
+    /**
+     * \brief Describes when a context activated plugin is needed.
+     *        The plugin stays dormant (inactive) until at least one of its triggers is observed
+     *        and returns to dormant once none of them have been observed for a hold period.
+     */
+    struct PluginActivationPolicy
+    {
+        //! Fully specified node name of the plugin
+        std::string plugin;
+
+        //! Triggers which each independently require the plugin. Each trigger starts with one of the trigger prefixes
+        std::vector<std::string> triggers;
+    };
+
+    /**
+     * \brief Parse a policy from the context_activated_plugins parameter format
+     *
+     * \param entry A string of the form "<plugin>, <trigger>[, <trigger>...]"
+     *
+     * \throw std::invalid_argument if the entry is malformed or contains an unknown trigger type
+     *
+     * \return The parsed policy
+     */
+    PluginActivationPolicy parse_plugin_activation_policy(const std::string& entry);
+
+}
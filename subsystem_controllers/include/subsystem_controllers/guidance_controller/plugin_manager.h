@@ -22,14 +22,17 @@
 #include <carma_planning_msgs/srv/plugin_activation.hpp>
 #include <ros2_lifecycle_manager/lifecycle_manager_interface.hpp>
 #include <unordered_set>
+#include <unordered_map>
 #include <functional>
 #include <vector>
 #include <memory>
 #include <chrono>
 #include <rmw/types.h>
 #include <map>
+#include <rclcpp/time.hpp>
 #include "entry_manager.h"
 #include "entry.h"
+#include "plugin_activation_policy.hpp"
 
 
 namespace subsystem_controllers
@@ -41,6 +44,10 @@ namespace subsystem_controllers
      * \brief Function which will return a map of service names and their message types based on the provided base node name and namespace
      */ 
     using ServiceNamesAndTypesFunc = std::function<std::map<std::string, std::vector<std::string, std::allocator<std::string>>>(const std::string &,const std::string &)>;
+    /**
+     * \brief Function which will return the current time
+     */ 
+    using GetTimeFunc = std::function<rclcpp::Time()>;
 
     /**
      * \brief The PluginManager serves as a component to manage CARMA Guidance Plugins via their ros2 lifecycle interfaces
@@ -71,6 +78,50 @@ namespace subsystem_controllers
                           ServiceNamesAndTypesFunc get_service_names_and_types_func,
                           std::chrono::nanoseconds service_timeout, std::chrono::nanoseconds call_timeout);
 
+            /**
+             * \brief Set the plugins which are activated based on the driving context instead of at system activation.
+             *        These plugins are kept dormant (inactive) until one of their triggers is observed and are returned to dormant
+             *        once none of their triggers have been observed for hold_duration. A plugin manually activated or deactivated by
+             *        the user is no longer managed by its policy. A policy overrides auto activation of the same plugin.
+             * 
+             * \param policies The policies of the context activated plugins
+             * \param hold_duration How long a plugin stays active after its triggers were last observed
+             * \param get_time_func A callback which returns the current time
+             * 
+             * \throw std::invalid_argument If a policy names a required plugin
+             */
+            void set_activation_policies(const std::vector<PluginActivationPolicy>& policies, std::chrono::nanoseconds hold_duration, GetTimeFunc get_time_func);
+
+            /**
+             * \brief Returns the set of all triggers used by the activation policies
+             */
+            std::unordered_set<std::string> get_activation_triggers() const;
+
+            /**
+             * \brief Record that the provided trigger was observed now. Triggers not used by any policy are ignored.
+             * 
+             * \param trigger The observed trigger. For example regulatory:carma_traffic_signal
+             */
+            void observe_activation_trigger(const std::string& trigger);
+
+            /**
+             * \brief Record that the provided plugin was selected to plan part of the current maneuver plan. This observes
+             *        every capability trigger which is the same as or more general than the plugin's capability.
+             *        Listing or requesting plugins by capability does not observe capability triggers.
+             * 
+             * \param plugin_name The name of the selected plugin, with or without its namespace. For example inlanecruising_plugin
+             */
+            void observe_plugin_selection(const std::string& plugin_name);
+
+            /**
+             * \brief Activate dormant plugins whose triggers were observed within the hold duration and return context
+             *        activated plugins whose triggers have lapsed to dormant. Has no effect unless the parent node is active.
+             * 
+             * \throw std::runtime_error If a required node could not transition successfully
+             * \return True if all plugins transitioned successfully
+             */
+            bool update_context_activation();
+
             /**
              * Below are the state transition methods which will cause this manager to trigger the corresponding 
              * state transitions in the managed plugins. 
@@ -217,6 +268,24 @@ namespace subsystem_controllers
             //! The timeout for service calls to return
             std::chrono::nanoseconds call_timeout_;
 
+            //! Activation policies of the context activated plugins keyed by plugin name
+            std::unordered_map<std::string, PluginActivationPolicy> activation_policies_;
+
+            //! Time each trigger used by an activation policy was last observed
+            std::unordered_map<std::string, rclcpp::Time> trigger_last_observed_;
+
+            //! Context activated plugins which are currently active because of their policy
+            std::unordered_set<std::string> context_active_plugins_;
+
+            //! Context activated plugins which the user activated or deactivated manually and are no longer managed by their policy
+            std::unordered_set<std::string> user_overridden_plugins_;
+
+            //! How long a context activated plugin stays active after its triggers were last observed
+            std::chrono::nanoseconds activation_hold_duration_{0};
+
+            //! Callback to retrieve the current time for activation triggers
+            GetTimeFunc get_time_func_;
+
             //! Base service name of plan_trajectory service
             const std::string plan_maneuvers_suffix_ = "/plan_maneuvers"; 
 
@@ -19,6 +19,12 @@
 #include "subsystem_controllers/base_subsystem_controller/base_subsystem_controller_config.hpp"
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/join.hpp>
+#include <lifecycle_msgs/msg/state.hpp>
+#include <geometry_msgs/msg/pose_stamped.hpp>
+#include <geometry_msgs/msg/twist_stamped.hpp>
+#include <carma_perception_msgs/msg/external_object_list.hpp>
+#include <carma_planning_msgs/msg/maneuver_plan.hpp>
+#include <carma_planning_msgs/msg/trajectory_plan.hpp>
 
 using std_msec = std::chrono::milliseconds;
 
@@ -35,6 +41,8 @@ namespace subsystem_controllers
     base_config_.subsystem_namespace = this->declare_parameter<std::string>("subsystem_namespace", base_config_.subsystem_namespace);
     base_config_.full_subsystem_required = this->declare_parameter<bool>("full_subsystem_required", base_config_.full_subsystem_required);
     base_config_.unmanaged_required_nodes = this->declare_parameter<std::vector<std::string>>("unmanaged_required_nodes", base_config_.unmanaged_required_nodes);
+    base_config_.monitored_topics = this->declare_parameter<std::vector<std::string>>("monitored_topics", base_config_.monitored_topics);
+    base_config_.topic_health_check_period_ms = this->declare_parameter<int>("topic_health_check_period_ms", base_config_.topic_health_check_period_ms);
 
     // Handle fact that parameter vectors cannot be empty
     if (base_config_.required_subsystem_nodes.size() == 1 && base_config_.required_subsystem_nodes[0].empty()) {
@@ -45,6 +53,10 @@ namespace subsystem_controllers
       base_config_.unmanaged_required_nodes.clear();
     }
 
+    if (base_config_.monitored_topics.size() == 1 && base_config_.monitored_topics[0].empty()) {
+      base_config_.monitored_topics.clear();
+    }
+
   }
 
   void BaseSubsystemController::set_config(BaseSubSystemControllerConfig config)
@@ -103,6 +115,8 @@ namespace subsystem_controllers
     get_parameter<std::string>("subsystem_namespace", base_config_.subsystem_namespace);
     get_parameter<bool>("full_subsystem_required", base_config_.full_subsystem_required);
     get_parameter<std::vector<std::string>>("unmanaged_required_nodes", base_config_.unmanaged_required_nodes);
+    get_parameter<std::vector<std::string>>("monitored_topics", base_config_.monitored_topics);
+    get_parameter<int>("topic_health_check_period_ms", base_config_.topic_health_check_period_ms);
 
     // Handle fact that parameter vectors cannot be empty
     if (base_config_.required_subsystem_nodes.size() == 1 && base_config_.required_subsystem_nodes[0].empty()) {
@@ -113,6 +127,10 @@ namespace subsystem_controllers
       base_config_.unmanaged_required_nodes.clear();
     }
 
+    if (base_config_.monitored_topics.size() == 1 && base_config_.monitored_topics[0].empty()) {
+      base_config_.monitored_topics.clear();
+    }
+
     RCLCPP_INFO_STREAM(get_logger(), "Loaded config: " << base_config_);
 
     // Create subscriptions
@@ -120,6 +138,8 @@ namespace subsystem_controllers
         system_alert_topic_, 100,
         std::bind(&BaseSubsystemController::on_system_alert, this, std::placeholders::_1));
 
+    create_topic_health_monitors();
+
     // Initialize lifecycle manager
     auto nodes_in_namespace = get_nodes_in_namespace(base_config_.subsystem_namespace);
 
@@ -168,6 +188,12 @@ namespace subsystem_controllers
   {
     RCLCPP_INFO_STREAM(get_logger(), "Subsystem trying to activate");
 
+    // Start a new check period so samples from before activation are not graded
+    auto now = this->now();
+    for (auto& tracker : topic_health_trackers_) {
+      tracker.reset(now);
+    }
+
     if (!trigger_managed_nodes_activate_from_base_class_) {
       return CallbackReturn::SUCCESS;
     }
@@ -375,4 +401,102 @@ namespace subsystem_controllers
     return non_intersecting_set;
   }
 
+  template <class MsgT>
+  void BaseSubsystemController::add_topic_health_subscription(size_t index)
+  {
+    // Depth of 1 and best effort keep the sampling overhead low and match both reliable and best effort publishers
+    auto sub = create_subscription<MsgT>(topic_health_trackers_[index].get_spec().topic, rclcpp::QoS(1).best_effort(),
+      [this, index](typename MsgT::UniquePtr msg)
+      {
+        if constexpr (has_header<MsgT>::value) {
+          topic_health_trackers_[index].on_message(this->now(), rclcpp::Time(msg->header.stamp, get_clock()->get_clock_type()));
+        } else {
+          topic_health_trackers_[index].on_message(this->now());
+        }
+      });
+
+    topic_health_subs_.push_back(sub);
+  }
+
+  void BaseSubsystemController::create_topic_health_monitors()
+  {
+    topic_health_subs_.clear();
+    topic_health_trackers_.clear();
+    topic_health_trackers_.reserve(base_config_.monitored_topics.size());
+
+    for (const auto& entry : base_config_.monitored_topics)
+    {
+      topic_health_trackers_.emplace_back(parse_topic_health_spec(entry));
+    }
+
+    for (size_t i = 0; i < topic_health_trackers_.size(); ++i)
+    {
+      const auto& spec = topic_health_trackers_[i].get_spec();
+
+      if (spec.type == "geometry_msgs/msg/PoseStamped") {
+        add_topic_health_subscription<geometry_msgs::msg::PoseStamped>(i);
+      } else if (spec.type == "geometry_msgs/msg/TwistStamped") {
+        add_topic_health_subscription<geometry_msgs::msg::TwistStamped>(i);
+      } else if (spec.type == "carma_perception_msgs/msg/ExternalObjectList") {
+        add_topic_health_subscription<carma_perception_msgs::msg::ExternalObjectList>(i);
+      } else if (spec.type == "carma_planning_msgs/msg/ManeuverPlan") {
+        add_topic_health_subscription<carma_planning_msgs::msg::ManeuverPlan>(i);
+      } else if (spec.type == "carma_planning_msgs/msg/TrajectoryPlan") {
+        add_topic_health_subscription<carma_planning_msgs::msg::TrajectoryPlan>(i);
+      } else {
+        throw std::invalid_argument("Monitored topic: " + spec.topic + " has unsupported type: " + spec.type);
+      }
+
+      RCLCPP_INFO_STREAM(get_logger(), "Monitoring topic: " << spec);
+    }
+
+    if (topic_health_trackers_.empty()) {
+      topic_health_timer_.reset();
+      return;
+    }
+
+    topic_health_timer_ = create_timer(get_clock(), std_msec(base_config_.topic_health_check_period_ms),
+      std::bind(&BaseSubsystemController::on_topic_health_timer, this));
+  }
+
+  void BaseSubsystemController::on_topic_health_timer()
+  {
+    if (get_current_state().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE) {
+      return;
+    }
+
+    auto now = this->now();
+
+    for (auto& tracker : topic_health_trackers_)
+    {
+      auto previous_level = tracker.get_level();
+      auto report = tracker.evaluate(now);
+
+      if (report.level == previous_level) {
+        continue; // Only changes in health are reported
+      }
+
+      const auto& topic = tracker.get_spec().topic;
+
+      if (report.level == TopicHealthLevel::NOMINAL) {
+        RCLCPP_INFO_STREAM(get_logger(), "Monitored topic: " << topic << " recovered. rate: " << report.rate_hz << " Hz max age: " << report.max_age_ms << " ms");
+        continue;
+      }
+
+      carma_msgs::msg::SystemAlert alert;
+      alert.source_node = get_node_base_interface()->get_fully_qualified_name();
+
+      if (report.level == TopicHealthLevel::CRITICAL) {
+        alert.type = carma_msgs::msg::SystemAlert::WARNING;
+        alert.description = "Monitored topic " + topic + " is critically degraded: " + report.description;
+      } else {
+        alert.type = carma_msgs::msg::SystemAlert::CAUTION;
+        alert.description = "Monitored topic " + topic + " is degraded: " + report.description;
+      }
+
+      RCLCPP_WARN_STREAM(get_logger(), alert.description);
+      publish_system_alert(alert);
+    }
+  }
+
 } // namespace subsystem_controllers
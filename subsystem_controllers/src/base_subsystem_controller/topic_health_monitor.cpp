@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/algorithm/string.hpp>
+#include "subsystem_controllers/base_subsystem_controller/topic_health_monitor.hpp"
+
+namespace subsystem_controllers
+{
+  TopicHealthSpec parse_topic_health_spec(const std::string& entry)
+  {
+    std::vector<std::string> fields;
+    boost::split(fields, entry, boost::is_any_of(","));
+
+    if (fields.size() != 4)
+    {
+      throw std::invalid_argument("Monitored topic entry: '" + entry + "' must have the form '<topic>, <type>, <min_rate_hz>, <max_age_ms>'");
+    }
+
+    for (auto& field : fields)
+    {
+      boost::trim(field);
+    }
+
+    if (fields[0].empty() || fields[1].empty())
+    {
+      throw std::invalid_argument("Monitored topic entry: '" + entry + "' is missing a topic or type");
+    }
+
+    TopicHealthSpec spec;
+    spec.topic = fields[0];
+    spec.type = fields[1];
+
+    try
+    {
+      spec.min_rate_hz = std::stod(fields[2]);
+      spec.max_age_ms = std::stod(fields[3]);
+    }
+    catch (const std::logic_error&)
+    {
+      throw std::invalid_argument("Monitored topic entry: '" + entry + "' has a non numeric rate or age");
+    }
+
+    return spec;
+  }
+
+  TopicHealthTracker::TopicHealthTracker(TopicHealthSpec spec)
+    : spec_(std::move(spec))
+  {}
+
+  void TopicHealthTracker::reset(const rclcpp::Time& now)
+  {
+    period_start_ = now;
+    message_count_ = 0;
+    max_age_ms_ = 0.0;
+    level_ = TopicHealthLevel::NOMINAL;
+  }
+
+  void TopicHealthTracker::on_message(const rclcpp::Time& receive_time)
+  {
+    (void)receive_time;
+    message_count_++;
+  }
+
+  void TopicHealthTracker::on_message(const rclcpp::Time& receive_time, const rclcpp::Time& stamp)
+  {
+    message_count_++;
+
+    if (stamp.nanoseconds() == 0)
+    {
+      return; // Unstamped message so the age is unknown
+    }
+
+    max_age_ms_ = std::max(max_age_ms_, (receive_time - stamp).seconds() * 1000.0);
+  }
+
+  TopicHealthReport TopicHealthTracker::evaluate(const rclcpp::Time& now)
+  {
+    TopicHealthReport report;
+    report.max_age_ms = max_age_ms_;
+
+    double period = (now - period_start_).seconds();
+    if (period <= 0.0)
+    {
+      report.level = level_;
+      return report;
+    }
+
+    report.rate_hz = message_count_ / period;
+
+    std::ostringstream description;
+
+    if (spec_.min_rate_hz > 0.0 && report.rate_hz < spec_.min_rate_hz)
+    {
+      report.level = report.rate_hz < 0.5 * spec_.min_rate_hz ? TopicHealthLevel::CRITICAL : TopicHealthLevel::DEGRADED;
+      description << "rate " << report.rate_hz << " Hz is below " << spec_.min_rate_hz << " Hz";
+    }
+
+    if (spec_.max_age_ms > 0.0 && report.max_age_ms > spec_.max_age_ms)
+    {
+      auto age_level = report.max_age_ms > 2.0 * spec_.max_age_ms ? TopicHealthLevel::CRITICAL : TopicHealthLevel::DEGRADED;
+      report.level = std::max(report.level, age_level);
+
+      if (description.tellp() > 0)
+        description << "; ";
+
+      description << "message age " << report.max_age_ms << " ms is above " << spec_.max_age_ms << " ms";
+    }
+
+    report.description = description.str();
+
+    level_ = report.level;
+    period_start_ = now;
+    message_count_ = 0;
+    max_age_ms_ = 0.0;
+
+    return report;
+  }
+
+  TopicHealthLevel TopicHealthTracker::get_level() const
+  {
+    return level_;
+  }
+
+  const TopicHealthSpec& TopicHealthTracker::get_spec() const
+  {
+    return spec_;
+  }
+
+  std::ostream &operator<<(std::ostream &output, const TopicHealthSpec &spec)
+  {
+    output << spec.topic << " (" << spec.type << ") min_rate_hz: " << spec.min_rate_hz << " max_age_ms: " << spec.max_age_ms;
+    return output;
+  }
+
+} // namespace subsystem_controllers
@@ -16,6 +16,8 @@
  */
 
 #include <chrono>
+#include <lanelet2_core/Attribute.h>
+#include <lifecycle_msgs/msg/state.hpp>
 #include "subsystem_controllers/guidance_controller/guidance_controller.hpp"
 
 using std_msec = std::chrono::milliseconds;
@@ -31,6 +33,9 @@ namespace subsystem_controllers
       config_.required_plugins = declare_parameter<std::vector<std::string>>("required_plugins", config_.required_plugins); 
       config_.auto_activated_plugins = declare_parameter<std::vector<std::string>>("auto_activated_plugins", config_.auto_activated_plugins); 
       config_.ros2_initial_plugins = declare_parameter<std::vector<std::string>>("ros2_initial_plugins", config_.ros2_initial_plugins); 
+      config_.context_activated_plugins = declare_parameter<std::vector<std::string>>("context_activated_plugins", config_.context_activated_plugins); 
+      config_.context_activation_hold_ms = declare_parameter<int>("context_activation_hold_ms", config_.context_activation_hold_ms); 
+      config_.context_activation_check_period_ms = declare_parameter<int>("context_activation_check_period_ms", config_.context_activation_check_period_ms); 
   }
 
   cr2::CallbackReturn GuidanceControllerNode::handle_on_configure(const rclcpp_lifecycle::State &prev_state) {
@@ -62,9 +67,27 @@ namespace subsystem_controllers
     get_parameter<std::vector<std::string>>("required_plugins", config_.required_plugins); 
     get_parameter<std::vector<std::string>>("auto_activated_plugins", config_.auto_activated_plugins); 
     get_parameter<std::vector<std::string>>("ros2_initial_plugins", config_.ros2_initial_plugins); 
+    get_parameter<std::vector<std::string>>("context_activated_plugins", config_.context_activated_plugins); 
+    get_parameter<int>("context_activation_hold_ms", config_.context_activation_hold_ms); 
+    get_parameter<int>("context_activation_check_period_ms", config_.context_activation_check_period_ms); 
+
+    // Handle fact that parameter vectors cannot be empty
+    if (config_.context_activated_plugins.size() == 1 && config_.context_activated_plugins[0].empty()) {
+      config_.context_activated_plugins.clear();
+    }
 
     RCLCPP_INFO_STREAM(get_logger(), "Config: " << config_);
 
+    std::vector<PluginActivationPolicy> activation_policies;
+    try {
+      for (const auto& entry : config_.context_activated_plugins) {
+        activation_policies.push_back(parse_plugin_activation_policy(entry));
+      }
+    } catch(const std::invalid_argument& e) {
+      RCLCPP_ERROR_STREAM(get_logger(), "Invalid context_activated_plugins parameter: " << e.what());
+      return CallbackReturn::FAILURE;
+    }
+
     // The core need is that plugins need to be managed separately from guidance nodes
     auto plugin_lifecycle_manager = std::make_shared<ros2_lifecycle_manager::Ros2LifecycleManager>(
       get_node_base_interface(), get_node_graph_interface(), get_node_logging_interface(), get_node_services_interface());
@@ -79,6 +102,15 @@ namespace subsystem_controllers
       std_msec(base_config_.service_timeout_ms), std_msec(base_config_.call_timeout_ms)
     );
 
+    try {
+      plugin_manager_->set_activation_policies(activation_policies, std_msec(config_.context_activation_hold_ms), [this](){ return now(); });
+    } catch(const std::invalid_argument& e) {
+      RCLCPP_ERROR_STREAM(get_logger(), "Invalid context_activated_plugins parameter: " << e.what());
+      return CallbackReturn::FAILURE;
+    }
+
+    create_activation_trigger_sources();
+
     plugin_discovery_sub_ = create_subscription<carma_planning_msgs::msg::Plugin>(
       "plugin_discovery", 50,
       std::bind(&PluginManager::update_plugin_status, plugin_manager_, std::placeholders::_1));
@@ -136,6 +168,142 @@ namespace subsystem_controllers
     }
 
   }
+  void GuidanceControllerNode::create_activation_trigger_sources()
+  {
+    v2x_trigger_subs_.clear();
+    final_maneuver_plan_sub_.reset();
+    wm_listener_.reset();
+    context_activation_timer_.reset();
+
+    auto triggers = plugin_manager_->get_activation_triggers();
+
+    if (triggers.empty()) {
+      return;
+    }
+
+    bool uses_route_triggers = false;
+    bool uses_capability_triggers = false;
+
+    for (const auto& trigger : triggers)
+    {
+      if (trigger.rfind(REGULATORY_TRIGGER_PREFIX, 0) == 0) {
+        uses_route_triggers = true;
+        continue;
+      }
+
+      if (trigger.rfind(CAPABILITY_TRIGGER_PREFIX, 0) == 0) {
+        uses_capability_triggers = true;
+        continue;
+      }
+
+      std::string kind = trigger.substr(V2X_TRIGGER_PREFIX.size());
+
+      if (kind == "mobility_request") {
+        add_v2x_trigger_subscription<carma_v2x_msgs::msg::MobilityRequest>("incoming_mobility_request", trigger);
+      } else if (kind == "mobility_operation") {
+        add_v2x_trigger_subscription<carma_v2x_msgs::msg::MobilityOperation>("incoming_mobility_operation", trigger);
+      } else if (kind == "spat") {
+        add_v2x_trigger_subscription<carma_v2x_msgs::msg::SPAT>("incoming_spat", trigger);
+      } else if (kind == "bsm") {
+        add_v2x_trigger_subscription<carma_v2x_msgs::msg::BSM>("incoming_bsm", trigger);
+      } else {
+        RCLCPP_WARN_STREAM(get_logger(), "Unsupported V2X activation trigger " << trigger << " will never be observed. "
+          << "Supported kinds: mobility_request, mobility_operation, spat, bsm");
+      }
+    }
+
+    // The world model is only maintained if a plugin is activated by the regulatory elements along the route
+    if (uses_route_triggers) {
+      wm_listener_ = std::make_shared<carma_wm::WMListener>(
+        get_node_base_interface(), get_node_logging_interface(),
+        get_node_topics_interface(), get_node_parameters_interface()
+      );
+    }
+
+    // Capability triggers follow the plugins the arbitrator actually selected, not every capability query
+    if (uses_capability_triggers) {
+      final_maneuver_plan_sub_ = create_subscription<carma_planning_msgs::msg::ManeuverPlan>("final_maneuver_plan", 5,
+        std::bind(&GuidanceControllerNode::on_final_maneuver_plan, this, std::placeholders::_1));
+    }
+
+    context_activation_timer_ = create_timer(get_clock(), std_msec(config_.context_activation_check_period_ms),
+      std::bind(&GuidanceControllerNode::on_context_activation_timer, this));
+  }
+
+  template <typename MsgT>
+  void GuidanceControllerNode::add_v2x_trigger_subscription(const std::string& topic, const std::string& trigger)
+  {
+    auto sub = create_subscription<MsgT>(topic, rclcpp::QoS(1).best_effort(),
+      [this, trigger](typename MsgT::UniquePtr) {
+        plugin_manager_->observe_activation_trigger(trigger);
+      });
+
+    v2x_trigger_subs_.push_back(sub);
+  }
+
+  void GuidanceControllerNode::on_final_maneuver_plan(carma_planning_msgs::msg::ManeuverPlan::UniquePtr msg)
+  {
+    for (const auto& maneuver : msg->maneuvers)
+    {
+      const carma_planning_msgs::msg::ManeuverParameters* parameters = nullptr;
+
+      switch (maneuver.type)
+      {
+        case carma_planning_msgs::msg::Maneuver::LANE_FOLLOWING:
+          parameters = &maneuver.lane_following_maneuver.parameters;
+          break;
+        case carma_planning_msgs::msg::Maneuver::LANE_CHANGE:
+          parameters = &maneuver.lane_change_maneuver.parameters;
+          break;
+        case carma_planning_msgs::msg::Maneuver::INTERSECTION_TRANSIT_STRAIGHT:
+          parameters = &maneuver.intersection_transit_straight_maneuver.parameters;
+          break;
+        case carma_planning_msgs::msg::Maneuver::INTERSECTION_TRANSIT_LEFT_TURN:
+          parameters = &maneuver.intersection_transit_left_turn_maneuver.parameters;
+          break;
+        case carma_planning_msgs::msg::Maneuver::INTERSECTION_TRANSIT_RIGHT_TURN:
+          parameters = &maneuver.intersection_transit_right_turn_maneuver.parameters;
+          break;
+        case carma_planning_msgs::msg::Maneuver::STOP_AND_WAIT:
+          parameters = &maneuver.stop_and_wait_maneuver.parameters;
+          break;
+        default:
+          continue;
+      }
+
+      plugin_manager_->observe_plugin_selection(parameters->planning_strategic_plugin);
+      plugin_manager_->observe_plugin_selection(parameters->planning_tactical_plugin);
+    }
+  }
+
+  void GuidanceControllerNode::on_context_activation_timer()
+  {
+    if (get_current_state().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE) {
+      return;
+    }
+
+    if (wm_listener_) {
+      auto route = wm_listener_->getWorldModel()->getRoute();
+
+      if (route) {
+        for (const auto& llt : route->shortestPath())
+        {
+          for (const auto& regem : llt.regulatoryElements())
+          {
+            if (regem->hasAttribute(lanelet::AttributeName::Subtype)) {
+              plugin_manager_->observe_activation_trigger(REGULATORY_TRIGGER_PREFIX + regem->attribute(lanelet::AttributeName::Subtype).value());
+            }
+          }
+        }
+      }
+    }
+
+    try {
+      plugin_manager_->update_context_activation();
+    } catch(const std::runtime_error& e) {
+      RCLCPP_ERROR_STREAM(get_logger(), "Error updating context activated plugins " << e.what());
+    }
+  }
 
   cr2::CallbackReturn GuidanceControllerNode::handle_on_activate(const rclcpp_lifecycle::State &prev_state)
   {
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <stdexcept>
+#include <boost/algorithm/string.hpp>
+#include "subsystem_controllers/guidance_controller/plugin_activation_policy.hpp"
+
+namespace subsystem_controllers
+{
+    PluginActivationPolicy parse_plugin_activation_policy(const std::string& entry)
+    {
+        std::vector<std::string> fields;
+        boost::split(fields, entry, boost::is_any_of(","));
+
+        for (auto& field : fields) {
+            boost::trim(field);
+        }
+
+        if (fields.size() < 2 || fields[0].empty()) {
+            throw std::invalid_argument("Context activated plugin entry: '" + entry + "' must have the form '<plugin>, <trigger>[, <trigger>...]'");
+        }
+
+        PluginActivationPolicy policy;
+        policy.plugin = fields[0];
+
+        for (size_t i = 1; i < fields.size(); i++) {
+
+            const auto& trigger = fields[i];
+
+            bool known_prefix = false;
+            for (const auto& prefix : { REGULATORY_TRIGGER_PREFIX, V2X_TRIGGER_PREFIX, CAPABILITY_TRIGGER_PREFIX }) {
+                if (trigger.rfind(prefix, 0) == 0 && trigger.size() > prefix.size()) {
+                    known_prefix = true;
+                    break;
+                }
+            }
+
+            if (!known_prefix) {
+                throw std::invalid_argument("Context activated plugin entry: '" + entry + "' has invalid trigger '" + trigger
+                    + "'. Triggers must start with " + REGULATORY_TRIGGER_PREFIX + ", " + V2X_TRIGGER_PREFIX + " or " + CAPABILITY_TRIGGER_PREFIX);
+            }
+
+            policy.triggers.push_back(trigger);
+        }
+
+        return policy;
+    }
+
+}
@@ -14,6 +14,7 @@
  * the License.
  */
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <lifecycle_msgs/msg/state.hpp>
 #include <rclcpp/logger.hpp>
@@ -67,6 +68,177 @@ namespace subsystem_controllers
         }
     }
 
+    void PluginManager::set_activation_policies(const std::vector<PluginActivationPolicy>& policies, std::chrono::nanoseconds hold_duration, GetTimeFunc get_time_func)
+    {
+        activation_hold_duration_ = hold_duration;
+        get_time_func_ = get_time_func;
+
+        for (const auto& policy : policies) {
+
+            if (required_plugins_.find(policy.plugin) != required_plugins_.end())
+                throw std::invalid_argument("Required plugin " + policy.plugin + " cannot be context activated");
+
+            bool is_ros1 = ros2_initial_plugins_.find(policy.plugin) == ros2_initial_plugins_.end();
+            if (is_ros1) {
+                RCLCPP_WARN_STREAM(rclcpp::get_logger("subsystem_controllers"), "Ignoring activation policy of " << policy.plugin << " as its lifecycle is not managed");
+                continue;
+            }
+
+            if (auto_activated_plugins_.erase(policy.plugin) > 0) {
+                RCLCPP_INFO_STREAM(rclcpp::get_logger("subsystem_controllers"), "Plugin " << policy.plugin << " will be context activated instead of auto activated");
+            }
+
+            RCLCPP_INFO_STREAM(rclcpp::get_logger("subsystem_controllers"), "Added: " << policy.plugin << ", as context activated with "
+                << policy.triggers.size() << " triggers");
+
+            // Context activated plugins are configured with the rest but are not slated for activation
+            Entry e(false, false, policy.plugin, carma_planning_msgs::msg::Plugin::UNKNOWN, "", false, false);
+            auto existing = em_.get_entry_by_name(policy.plugin);
+            if (existing) {
+                e = existing.get();
+                e.user_requested_activation_ = false;
+            }
+            em_.update_entry(e);
+            plugin_lifecycle_mgr_->add_managed_node(policy.plugin);
+
+            activation_policies_[policy.plugin] = policy;
+        }
+    }
+
+    std::unordered_set<std::string> PluginManager::get_activation_triggers() const
+    {
+        std::unordered_set<std::string> triggers;
+        for (const auto& policy : activation_policies_) {
+            triggers.insert(policy.second.triggers.begin(), policy.second.triggers.end());
+        }
+        return triggers;
+    }
+
+    void PluginManager::observe_activation_trigger(const std::string& trigger)
+    {
+        if (activation_policies_.empty() || !get_time_func_)
+            return;
+
+        for (const auto& policy : activation_policies_) {
+            if (std::find(policy.second.triggers.begin(), policy.second.triggers.end(), trigger) != policy.second.triggers.end()) {
+                trigger_last_observed_[trigger] = get_time_func_();
+                return;
+            }
+        }
+    }
+
+    void PluginManager::observe_plugin_selection(const std::string& plugin_name)
+    {
+        if (activation_policies_.empty() || !get_time_func_ || plugin_name.empty())
+            return;
+
+        std::vector<std::vector<std::string>> capability_triggers;
+        std::vector<std::string> capability_trigger_names;
+        for (const auto& trigger : get_activation_triggers()) {
+            if (trigger.rfind(CAPABILITY_TRIGGER_PREFIX, 0) != 0)
+                continue;
+
+            std::vector<std::string> trigger_capability_levels;
+            boost::split(trigger_capability_levels, trigger.substr(CAPABILITY_TRIGGER_PREFIX.size()), boost::is_any_of("/"));
+            capability_triggers.push_back(trigger_capability_levels);
+            capability_trigger_names.push_back(trigger);
+        }
+
+        for (const auto& plugin : em_.get_entries())
+        {
+            // Maneuvers name plugins without their namespace
+            if (plugin.name_ != plugin_name && !boost::ends_with(plugin.name_, "/" + plugin_name))
+                continue;
+
+            std::vector<std::string> plugin_capability_levels;
+            boost::split(plugin_capability_levels, plugin.capability_, boost::is_any_of("/"));
+
+            for (size_t i = 0; i < capability_triggers.size(); i++) {
+                if (capability_triggers[i].size() <= plugin_capability_levels.size() && matching_capability(plugin_capability_levels, capability_triggers[i])) {
+                    trigger_last_observed_[capability_trigger_names[i]] = get_time_func_();
+                }
+            }
+        }
+    }
+
+    bool PluginManager::update_context_activation()
+    {
+        if (activation_policies_.empty() || get_parent_state_func_() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+            return true;
+
+        bool full_success = true;
+        rclcpp::Time now = get_time_func_();
+
+        for (const auto& name_policy : activation_policies_) {
+
+            const auto& plugin_name = name_policy.first;
+
+            if (user_overridden_plugins_.find(plugin_name) != user_overridden_plugins_.end())
+                continue;
+
+            boost::optional<Entry> plugin = em_.get_entry_by_name(plugin_name);
+            if (!plugin || plugin->is_ros1_)
+                continue;
+
+            std::string active_trigger;
+            for (const auto& trigger : name_policy.second.triggers) {
+                auto it = trigger_last_observed_.find(trigger);
+                if (it != trigger_last_observed_.end() && (now - it->second).nanoseconds() <= activation_hold_duration_.count()) {
+                    active_trigger = trigger;
+                    break;
+                }
+            }
+
+            bool is_context_active = context_active_plugins_.find(plugin_name) != context_active_plugins_.end();
+
+            if (!active_trigger.empty() && !is_context_active) {
+
+                RCLCPP_INFO_STREAM(rclcpp::get_logger("subsystem_controllers"), "Activating dormant plugin " << plugin_name << " for trigger " << active_trigger);
+
+                auto result_state = plugin_lifecycle_mgr_->transition_node_to_state(lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, plugin_name, service_timeout_, call_timeout_);
+
+                Entry updated_entry = plugin.get();
+
+                if (result_state != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE) {
+                    RCLCPP_ERROR_STREAM(rclcpp::get_logger("subsystem_controllers"), "Failed to activate context activated plugin: " 
+                        << plugin_name << " Marking as deactivated and unavailable!"); 
+
+                    updated_entry.active_ = false;
+                    updated_entry.available_ = false;
+                    user_overridden_plugins_.insert(plugin_name); // Do not retry a failed plugin on every update
+                    full_success = false;
+                } else {
+                    updated_entry.active_ = true;
+                    context_active_plugins_.insert(plugin_name);
+                }
+
+                em_.update_entry(updated_entry);
+
+            } else if (active_trigger.empty() && is_context_active) {
+
+                RCLCPP_INFO_STREAM(rclcpp::get_logger("subsystem_controllers"), "Returning plugin " << plugin_name << " to dormant as none of its triggers were observed recently");
+
+                auto result_state = plugin_lifecycle_mgr_->transition_node_to_state(lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, plugin_name, service_timeout_, call_timeout_);
+
+                Entry updated_entry = plugin.get();
+                updated_entry.active_ = false;
+
+                if (result_state != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE) {
+                    RCLCPP_ERROR_STREAM(rclcpp::get_logger("subsystem_controllers"), "Failed to deactivate context activated plugin: " 
+                        << plugin_name << " Marking as deactivated and unavailable!"); 
+
+                    updated_entry.available_ = false;
+                    full_success = false;
+                }
+
+                context_active_plugins_.erase(plugin_name);
+                em_.update_entry(updated_entry);
+            }
+        }
+
+        return full_success;
+    }
+
     bool PluginManager::is_ros2_lifecycle_node(const std::string& node)
     {
         // Determine if this plugin is a ROS1 or ROS2 plugin
@@ -316,6 +488,9 @@ namespace subsystem_controllers
 
         }
 
+        // Context activated plugins will be reactivated by their policies once this node is active again
+        context_active_plugins_.clear();
+
         return full_success;
     }
     
@@ -419,6 +594,14 @@ namespace subsystem_controllers
             return;
         }
 
+        if (activation_policies_.find(requested_plugin->name_) != activation_policies_.end())
+        {
+            // The user's choice takes precedence over the activation policy from now on
+            RCLCPP_INFO_STREAM(rclcpp::get_logger("subsystem_controllers"), "Plugin " << requested_plugin->name_ << " was manually set by the user and is no longer context activated");
+            user_overridden_plugins_.insert(requested_plugin->name_);
+            context_active_plugins_.erase(requested_plugin->name_);
+        }
+
         bool activated = false;
         if (req->activated)
         {
@@ -382,4 +382,140 @@ namespace subsystem_controllers
 
     // }
 
+    TEST(PluginActivationPolicy, parse)
+    {
+        auto policy = parse_plugin_activation_policy(" /guidance/plugins/plg_1, regulatory:stop_rule ,v2x:bsm, capability:strategic_plan/plan_maneuvers");
+
+        ASSERT_EQ(policy.plugin, "/guidance/plugins/plg_1");
+        ASSERT_EQ(policy.triggers.size(), 3u);
+        ASSERT_EQ(policy.triggers[0], "regulatory:stop_rule");
+        ASSERT_EQ(policy.triggers[1], "v2x:bsm");
+        ASSERT_EQ(policy.triggers[2], "capability:strategic_plan/plan_maneuvers");
+
+        ASSERT_THROW(parse_plugin_activation_policy("/guidance/plugins/plg_1"), std::invalid_argument);
+        ASSERT_THROW(parse_plugin_activation_policy(", v2x:bsm"), std::invalid_argument);
+        ASSERT_THROW(parse_plugin_activation_policy("/guidance/plugins/plg_1, bsm"), std::invalid_argument);
+        ASSERT_THROW(parse_plugin_activation_policy("/guidance/plugins/plg_1, v2x:"), std::invalid_argument);
+    }
+
+    TEST(PluginManager, context_activation)
+    {
+        auto mock_lifecycle = std::make_shared<MockLifecycleManager>();
+        uint8_t parent_state = UNCONFIGURED;
+        rclcpp::Time now(10, 0);
+
+        PluginManager pm(
+            {"plg_1"},
+            {"plg_2"},
+            {"plg_1", "plg_2", "plg_3"},
+            mock_lifecycle,
+            [&parent_state](){ return parent_state; },
+            [](auto, auto){ return std::map<std::string, std::vector<std::string, std::allocator<std::string>>>(); },
+            std_msec(10), std_msec(10)
+        );
+
+        // Required plugins cannot be context activated
+        ASSERT_THROW(pm.set_activation_policies({ parse_plugin_activation_policy("plg_1, v2x:bsm") }, std_msec(1000), [&now](){ return now; }), std::invalid_argument);
+
+        pm.set_activation_policies({
+                parse_plugin_activation_policy("plg_2, capability:strategic_plan/plan_maneuvers"),
+                parse_plugin_activation_policy("plg_3, v2x:bsm, regulatory:stop_rule")
+            },
+            std_msec(1000), [&now](){ return now; });
+
+        auto triggers = pm.get_activation_triggers();
+        ASSERT_EQ(triggers.size(), 3u);
+        ASSERT_EQ(triggers.count("v2x:bsm"), 1u);
+
+        parent_state = INACTIVE;
+        ASSERT_TRUE(pm.configure());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_3"], INACTIVE);
+
+        // Observations while inactive are remembered but nothing is activated
+        pm.observe_activation_trigger("v2x:bsm");
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_3"], INACTIVE);
+
+        parent_state = ACTIVE;
+        now = rclcpp::Time(20, 0);
+        ASSERT_TRUE(pm.activate());
+
+        // plg_2 is no longer auto activated as it has an activation policy
+        ASSERT_EQ(mock_lifecycle->node_states["plg_1"], ACTIVE);
+        ASSERT_EQ(mock_lifecycle->node_states["plg_2"], INACTIVE);
+        ASSERT_EQ(mock_lifecycle->node_states["plg_3"], INACTIVE);
+
+        // Stale observation does not activate
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_3"], INACTIVE);
+
+        // Unused triggers are ignored
+        pm.observe_activation_trigger("v2x:spat");
+        pm.observe_activation_trigger("regulatory:stop_rule");
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_3"], ACTIVE);
+
+        // Requesting plugins by capability does not observe capability triggers
+        auto hdr = std::make_shared<rmw_request_id_t>();
+        auto cap_req = std::make_shared<carma_planning_msgs::srv::GetPluginApi::Request>();
+        auto cap_res = std::make_shared<carma_planning_msgs::srv::GetPluginApi::Response>();
+        cap_req->capability = "strategic_plan/plan_maneuvers";
+        pm.get_strategic_plugins_by_capability(hdr, cap_req, cap_res);
+
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_2"], INACTIVE);
+
+        // Selecting a plugin with a more general capability than the trigger does not observe it
+        auto plg_1_status = std::make_unique<carma_planning_msgs::msg::Plugin>();
+        plg_1_status->name = "/guidance/plugins/plg_1";
+        plg_1_status->available = true;
+        plg_1_status->activated = true;
+        plg_1_status->type = carma_planning_msgs::msg::Plugin::STRATEGIC;
+        plg_1_status->capability = "strategic_plan";
+        pm.update_plugin_status(std::move(plg_1_status));
+
+        pm.observe_plugin_selection("plg_1");
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_2"], INACTIVE);
+
+        // Selecting a plugin with the triggering or a more specific capability does
+        plg_1_status = std::make_unique<carma_planning_msgs::msg::Plugin>();
+        plg_1_status->name = "/guidance/plugins/plg_1";
+        plg_1_status->available = true;
+        plg_1_status->activated = true;
+        plg_1_status->type = carma_planning_msgs::msg::Plugin::STRATEGIC;
+        plg_1_status->capability = "strategic_plan/plan_maneuvers/route_following";
+        pm.update_plugin_status(std::move(plg_1_status));
+
+        pm.observe_plugin_selection("plg_1");
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_2"], ACTIVE);
+
+        // Within the hold duration plugins stay active
+        now = rclcpp::Time(20, 900000000);
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_2"], ACTIVE);
+        ASSERT_EQ(mock_lifecycle->node_states["plg_3"], ACTIVE);
+
+        pm.observe_activation_trigger("v2x:bsm");
+
+        now = rclcpp::Time(21, 500000000);
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_2"], INACTIVE);
+        ASSERT_EQ(mock_lifecycle->node_states["plg_3"], ACTIVE);
+
+        // Once the user sets the plugin its policy no longer applies
+        auto activate_req = std::make_shared<carma_planning_msgs::srv::PluginActivation::Request>();
+        auto activate_res = std::make_shared<carma_planning_msgs::srv::PluginActivation::Response>();
+        activate_req->plugin_name = "plg_2";
+        activate_req->activated = true;
+        pm.activate_plugin(hdr, activate_req, activate_res);
+        ASSERT_TRUE(activate_res->newstate);
+
+        now = rclcpp::Time(30, 0);
+        ASSERT_TRUE(pm.update_context_activation());
+        ASSERT_EQ(mock_lifecycle->node_states["plg_2"], ACTIVE);
+        ASSERT_EQ(mock_lifecycle->node_states["plg_3"], INACTIVE);
+    }
+
 }
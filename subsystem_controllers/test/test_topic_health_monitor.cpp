@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <geometry_msgs/msg/pose_stamped.hpp>
+#include <carma_planning_msgs/msg/trajectory_plan_point.hpp>
+
+#include "subsystem_controllers/base_subsystem_controller/topic_health_monitor.hpp"
+
+namespace subsystem_controllers
+{
+    TEST(TopicHealthMonitorTest, parse_topic_health_spec)
+    {
+        auto spec = parse_topic_health_spec("/localization/current_pose, geometry_msgs/msg/PoseStamped, 8.0, 200");
+
+        EXPECT_EQ("/localization/current_pose", spec.topic);
+        EXPECT_EQ("geometry_msgs/msg/PoseStamped", spec.type);
+        EXPECT_NEAR(8.0, spec.min_rate_hz, 0.0001);
+        EXPECT_NEAR(200.0, spec.max_age_ms, 0.0001);
+
+        EXPECT_THROW(parse_topic_health_spec("/localization/current_pose, geometry_msgs/msg/PoseStamped, 8.0"), std::invalid_argument);
+        EXPECT_THROW(parse_topic_health_spec(", geometry_msgs/msg/PoseStamped, 8.0, 200"), std::invalid_argument);
+        EXPECT_THROW(parse_topic_health_spec("/localization/current_pose, geometry_msgs/msg/PoseStamped, fast, 200"), std::invalid_argument);
+
+        EXPECT_TRUE(has_header<geometry_msgs::msg::PoseStamped>::value);
+        EXPECT_FALSE(has_header<carma_planning_msgs::msg::TrajectoryPlanPoint>::value);
+    }
+
+    TEST(TopicHealthMonitorTest, rate_grading)
+    {
+        TopicHealthSpec spec;
+        spec.topic = "/test";
+        spec.min_rate_hz = 10.0;
+
+        TopicHealthTracker tracker(spec);
+
+        rclcpp::Time now(1, 0, RCL_ROS_TIME);
+        tracker.reset(now);
+
+        // 10 Hz over 1 s
+        for (int i = 0; i < 10; i++)
+        {
+            tracker.on_message(now + rclcpp::Duration::from_seconds(0.1 * i));
+        }
+        now = now + rclcpp::Duration::from_seconds(1.0);
+
+        auto report = tracker.evaluate(now);
+        EXPECT_EQ(TopicHealthLevel::NOMINAL, report.level);
+        EXPECT_NEAR(10.0, report.rate_hz, 0.0001);
+        EXPECT_TRUE(report.description.empty());
+
+        // 7 Hz over 1 s
+        for (int i = 0; i < 7; i++)
+        {
+            tracker.on_message(now);
+        }
+        now = now + rclcpp::Duration::from_seconds(1.0);
+
+        report = tracker.evaluate(now);
+        EXPECT_EQ(TopicHealthLevel::DEGRADED, report.level);
+        EXPECT_EQ(TopicHealthLevel::DEGRADED, tracker.get_level());
+        EXPECT_NEAR(7.0, report.rate_hz, 0.0001);
+        EXPECT_FALSE(report.description.empty());
+
+        // No messages
+        now = now + rclcpp::Duration::from_seconds(1.0);
+
+        report = tracker.evaluate(now);
+        EXPECT_EQ(TopicHealthLevel::CRITICAL, report.level);
+        EXPECT_NEAR(0.0, report.rate_hz, 0.0001);
+
+        // Reset returns to nominal
+        tracker.reset(now);
+        EXPECT_EQ(TopicHealthLevel::NOMINAL, tracker.get_level());
+    }
+
+    TEST(TopicHealthMonitorTest, age_grading)
+    {
+        TopicHealthSpec spec;
+        spec.topic = "/test";
+        spec.max_age_ms = 200.0;
+
+        TopicHealthTracker tracker(spec);
+
+        rclcpp::Time now(1, 0, RCL_ROS_TIME);
+        tracker.reset(now);
+
+        tracker.on_message(now + rclcpp::Duration::from_seconds(0.5), now + rclcpp::Duration::from_seconds(0.4));
+        now = now + rclcpp::Duration::from_seconds(1.0);
+
+        auto report = tracker.evaluate(now);
+        EXPECT_EQ(TopicHealthLevel::NOMINAL, report.level);
+        EXPECT_NEAR(100.0, report.max_age_ms, 0.001);
+
+        tracker.on_message(now + rclcpp::Duration::from_seconds(0.5), now + rclcpp::Duration::from_seconds(0.25));
+        tracker.on_message(now + rclcpp::Duration::from_seconds(0.6), now + rclcpp::Duration::from_seconds(0.55));
+        now = now + rclcpp::Duration::from_seconds(1.0);
+
+        report = tracker.evaluate(now);
+        EXPECT_EQ(TopicHealthLevel::DEGRADED, report.level);
+        EXPECT_NEAR(250.0, report.max_age_ms, 0.001);
+
+        tracker.on_message(now + rclcpp::Duration::from_seconds(0.5), now);
+        now = now + rclcpp::Duration::from_seconds(1.0);
+
+        report = tracker.evaluate(now);
+        EXPECT_EQ(TopicHealthLevel::CRITICAL, report.level);
+
+        // Unstamped messages do not contribute to the age
+        tracker.on_message(now + rclcpp::Duration::from_seconds(0.5), rclcpp::Time(0, 0, RCL_ROS_TIME));
+        now = now + rclcpp::Duration::from_seconds(1.0);
+
+        report = tracker.evaluate(now);
+        EXPECT_EQ(TopicHealthLevel::NOMINAL, report.level);
+        EXPECT_NEAR(0.0, report.max_age_ms, 0.001);
+    }
+
+} // namespace subsystem_controllers
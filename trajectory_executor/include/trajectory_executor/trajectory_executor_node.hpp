@@ -23,6 +23,8 @@
 #include <gtest/gtest_prod.h>
 
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
+#include <carma_guidance_plugins/realtime_profile.hpp>
+#include <carma_guidance_plugins/guidance_state_gate.hpp>
 #include "trajectory_executor/trajectory_executor_config.hpp"
 
 namespace trajectory_executor
@@ -47,6 +49,7 @@ namespace trajectory_executor
 
     // Timers
     rclcpp::TimerBase::SharedPtr timer_; // Timer for publishing outbound trajectories to the control plugins
+    carma_guidance_plugins::GuidanceStateGate guidance_state_gate_; // Suspends timer_ while guidance is not engaged
 
     // Node configuration
     Config config_;
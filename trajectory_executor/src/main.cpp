@@ -23,9 +23,8 @@ int main(int argc, char **argv)
 
   auto node = std::make_shared<trajectory_executor::TrajectoryExecutor>(rclcpp::NodeOptions());
   
-  rclcpp::executors::MultiThreadedExecutor executor;
-  executor.add_node(node->get_node_base_interface());
-  executor.spin();
+  carma_guidance_plugins::spin_with_realtime_profile(node->get_node_base_interface(),
+    carma_guidance_plugins::get_realtime_profile_parameters(node->get_node_parameters_interface()), node->get_logger());
 
   rclcpp::shutdown();
 
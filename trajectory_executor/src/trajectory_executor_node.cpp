@@ -29,6 +29,9 @@ namespace trajectory_executor
     config_.trajectory_publish_rate = declare_parameter<double>("trajectory_publish_rate", config_.trajectory_publish_rate);
     config_.default_control_plugin = declare_parameter<std::string>("default_control_plugin", config_.default_control_plugin);
     config_.default_control_plugin_topic = declare_parameter<std::string>("default_control_plugin_topic", config_.default_control_plugin_topic);
+
+    // Used by spin_with_realtime_profile() when the node is run from its own executable
+    carma_guidance_plugins::declare_realtime_profile_parameters(get_node_parameters_interface());
   }
 
   rcl_interfaces::msg::SetParametersResult TrajectoryExecutor::parameter_update_callback(const std::vector<rclcpp::Parameter> &parameters)
@@ -82,7 +85,7 @@ namespace trajectory_executor
     // Setup subscribers
     plan_sub_ = create_subscription<carma_planning_msgs::msg::TrajectoryPlan>("trajectory", 5,
                                                               std::bind(&TrajectoryExecutor::onNewTrajectoryPlan, this, std_ph::_1));
-    state_sub_ = create_subscription<carma_planning_msgs::msg::GuidanceState>("state", 5,
+    state_sub_ = create_subscription<carma_planning_msgs::msg::GuidanceState>("state", carma_guidance_plugins::GuidanceStateGate::qos(),
                                                               std::bind(&TrajectoryExecutor::guidanceStateMonitor, this, std_ph::_1));
 
     cur_traj_ = std::unique_ptr<carma_planning_msgs::msg::TrajectoryPlan>();
@@ -115,6 +118,9 @@ namespace trajectory_executor
         std::chrono::milliseconds(timer_period_ms), 
         std::bind(&TrajectoryExecutor::onTrajEmitTick, this));
 
+    guidance_state_gate_.clear_timers();
+    guidance_state_gate_.add_timer(timer_);
+
     return CallbackReturn::SUCCESS;
   }
 
@@ -124,11 +130,13 @@ namespace trajectory_executor
 
     if (cur_traj_ != nullptr) {
       // Determine the relevant control plugin for the current timestep
-      std::string control_plugin = cur_traj_->trajectory_points[0].controller_plugin_name;
+      // Referenced rather than copied to avoid an allocation on every tick
+      const std::string* control_plugin_ptr = &cur_traj_->trajectory_points[0].controller_plugin_name;
       // if it instructed to use default control_plugin
-      if (control_plugin == "default" || control_plugin =="") {
-        control_plugin = config_.default_control_plugin;
+      if (*control_plugin_ptr == "default" || control_plugin_ptr->empty()) {
+        control_plugin_ptr = &config_.default_control_plugin;
       }
+      const std::string& control_plugin = *control_plugin_ptr;
 
       std::map<std::string, carma_ros2_utils::PubPtr<carma_planning_msgs::msg::TrajectoryPlan>>::iterator it = traj_publisher_map_.find(control_plugin);
       if (it != traj_publisher_map_.end()) {
@@ -164,6 +172,8 @@ namespace trajectory_executor
 
   void TrajectoryExecutor::guidanceStateMonitor(carma_planning_msgs::msg::GuidanceState::UniquePtr msg)
   {
+    guidance_state_gate_.on_guidance_state(*msg, now());
+
     // TODO need to handle control handover once alernative planner system is finished
     if(msg->state != carma_planning_msgs::msg::GuidanceState::ENGAGED)
     {
@@ -17,6 +17,7 @@
 #include <rclcpp/rclcpp.hpp>
 #include <limits>
 #include <math.h>
+#include <basic_autonomy/basic_autonomy.hpp>
 #include "trajectory_visualizer.hpp"
 
 namespace trajectory_visualizer {
@@ -76,6 +77,8 @@ namespace trajectory_visualizer {
 
         size_t count = std::max(prev_marker_list_size_, msg->trajectory_points.size());
 
+        auto terminal_hold = basic_autonomy::waypoint_generation::get_terminal_hold(msg->trajectory_points);
+
         for (size_t i = 1; i < count; i++)
         {
             marker.id = i;
@@ -148,6 +151,29 @@ namespace trajectory_visualizer {
                 marker.color.b = 0.5f;
             }
 
+            marker.type = visualization_msgs::msg::Marker::ARROW;
+            marker.pose = geometry_msgs::msg::Pose();
+            marker.scale.x = 2;
+            marker.scale.y = 2;
+            marker.scale.z = 1;
+
+            // Draw the stop of a terminal hold instead of a zero length arrow
+            if (terminal_hold && i == terminal_hold->stop_index + 1)
+            {
+                marker.type = visualization_msgs::msg::Marker::CYLINDER;
+                marker.points = {};
+                marker.pose.position.x = msg->trajectory_points[i].x;
+                marker.pose.position.y = msg->trajectory_points[i].y;
+                marker.pose.orientation.w = 1.0;
+                marker.scale.z = 0.2;
+                marker.color.r = 0.5f;
+                marker.color.g = 0.5f;
+                marker.color.b = 0.5f;
+
+                tmp_marker_array.markers.push_back(marker);
+                continue;
+            }
+
             marker.points = {};
             geometry_msgs::msg::Point start;
             start.x = msg->trajectory_points[i-1].x;
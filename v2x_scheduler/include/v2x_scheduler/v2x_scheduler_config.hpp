@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace v2x_scheduler
+{
+
+  /**
+   * \brief Scheduling behavior of one class of outbound message
+   */
+  struct MessageClassConfig
+  {
+    //! The message_type of the outbound ByteArray messages in this class. For example MobilityRequest
+    std::string message_type;
+
+    //! Classes with a higher priority are always sent first
+    int priority = 0;
+
+    //! Messages which have been queued longer than this are dropped instead of sent. A value <= 0 disables the limit
+    double max_age_ms = 1000.0;
+
+    //! If true a newly queued message replaces any queued message of the same class which has not been sent yet.
+    //  Should only be set for periodic messages where a newer message supersedes an older one.
+    bool coalesce = false;
+  };
+
+  /**
+   * \brief Stuct containing the algorithm configuration values for v2x_scheduler
+   */
+  struct Config
+  {
+    double max_messages_per_second = 50.0; // Sustained number of messages which may be sent each second
+    int burst_size = 10; // Maximum number of messages which may be sent back to back after an idle period
+    int max_queue_size = 100; // Maximum number of messages waiting to be sent. The lowest priority messages are dropped first when exceeded
+    int service_period_ms = 10; // Period (in ms) at which queued messages are checked for sending
+    int statistics_period_ms = 1000; // Period (in ms) at which the per class statistics are published
+    int default_priority = 0; // Priority of messages whose type is not in message_classes
+    double default_max_age_ms = 1000.0; // Max age (in ms) of messages whose type is not in message_classes
+
+    //! Per message type scheduling behavior. Parsed from the message_classes parameter
+    std::vector<MessageClassConfig> message_classes;
+
+    // Stream operator for this config
+    friend std::ostream &operator<<(std::ostream &output, const Config &c)
+    {
+      output << "v2x_scheduler::Config { " << std::endl
+             << "max_messages_per_second: " << c.max_messages_per_second << std::endl
+             << "burst_size: " << c.burst_size << std::endl
+             << "max_queue_size: " << c.max_queue_size << std::endl
+             << "service_period_ms: " << c.service_period_ms << std::endl
+             << "statistics_period_ms: " << c.statistics_period_ms << std::endl
+             << "default_priority: " << c.default_priority << std::endl
+             << "default_max_age_ms: " << c.default_max_age_ms << std::endl
+             << "message_classes: [ " << std::endl;
+
+      for (const auto& mc : c.message_classes)
+      {
+        output << "  { message_type: " << mc.message_type << " priority: " << mc.priority
+               << " max_age_ms: " << mc.max_age_ms << " coalesce: " << mc.coalesce << " }" << std::endl;
+      }
+
+      output << "] " << std::endl
+             << "}" << std::endl;
+      return output;
+    }
+  };
+
+} // v2x_scheduler
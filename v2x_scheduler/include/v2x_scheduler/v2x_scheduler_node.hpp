@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#pragma once
+
+#include <rclcpp/rclcpp.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <carma_driver_msgs/msg/byte_array.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+
+#include <carma_ros2_utils/carma_lifecycle_node.hpp>
+#include "v2x_scheduler/v2x_scheduler_worker.hpp"
+#include "v2x_scheduler/v2x_scheduler_config.hpp"
+
+namespace v2x_scheduler
+{
+
+  /**
+   * \class V2XScheduler
+   * \brief Node which sits between the message encoder and the radio driver and limits outbound V2X traffic to a
+   *        configurable budget. Encoded messages are queued by class and released in priority order.
+   *        See V2XSchedulerWorker for the scheduling rules.
+   */
+  class V2XScheduler : public carma_ros2_utils::CarmaLifecycleNode
+  {
+
+  private:
+    // Subscribers
+    carma_ros2_utils::SubPtr<carma_driver_msgs::msg::ByteArray> unscheduled_sub_;
+
+    // Publishers
+    carma_ros2_utils::PubPtr<carma_driver_msgs::msg::ByteArray> outbound_pub_;
+    carma_ros2_utils::PubPtr<diagnostic_msgs::msg::DiagnosticArray> statistics_pub_;
+
+    // Timers
+    rclcpp::TimerBase::SharedPtr service_timer_;
+    rclcpp::TimerBase::SharedPtr statistics_timer_;
+
+    // Node configuration
+    Config config_;
+
+    // Worker class
+    std::shared_ptr<V2XSchedulerWorker> worker_;
+
+    // Number of dropped messages per class at the last statistics report
+    std::vector<size_t> last_reported_drops_;
+
+    /**
+     * \brief Callback for encoded messages waiting to be scheduled. The message is queued and any ready messages are sent.
+     */
+    void unscheduled_callback(carma_driver_msgs::msg::ByteArray::UniquePtr msg);
+
+    /**
+     * \brief Send all queued messages which fit in the current budget
+     */
+    void service_queue();
+
+    /**
+     * \brief Publish the per class statistics. Classes which dropped messages since the last report are marked WARN
+     */
+    void publish_statistics();
+
+  public:
+    /**
+     * \brief Node constructor
+     */
+    explicit V2XScheduler(const rclcpp::NodeOptions &);
+
+    ////
+    // Overrides
+    ////
+    carma_ros2_utils::CallbackReturn handle_on_configure(const rclcpp_lifecycle::State &prev_state);
+    carma_ros2_utils::CallbackReturn handle_on_activate(const rclcpp_lifecycle::State &prev_state);
+  };
+
+} // v2x_scheduler
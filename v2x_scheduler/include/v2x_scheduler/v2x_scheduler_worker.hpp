@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#pragma once
+
+#include <rclcpp/time.hpp>
+#include <carma_driver_msgs/msg/byte_array.hpp>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "v2x_scheduler/v2x_scheduler_config.hpp"
+
+namespace v2x_scheduler
+{
+
+  /**
+   * \brief Parse a message class from the message_classes parameter format
+   *
+   * \param entry A string of the form "<message_type>, <priority>, <max_age_ms>, <coalesce>" where coalesce is true or false
+   *
+   * \throw std::invalid_argument if the entry is malformed
+   *
+   * \return The parsed message class
+   */
+  MessageClassConfig parse_message_class(const std::string& entry);
+
+  /**
+   * \brief Cumulative statistics of one message class
+   */
+  struct MessageClassStatistics
+  {
+    //! Name of the class. The message type, or "default" for unconfigured types
+    std::string name;
+
+    size_t received = 0; // Messages handed to the scheduler
+    size_t sent = 0; // Messages released for transmission
+    size_t coalesced = 0; // Queued messages replaced by a newer message of the same class
+    size_t dropped_stale = 0; // Messages dropped for exceeding the class max_age_ms
+    size_t dropped_overflow = 0; // Messages dropped because the queue was full
+
+    double total_latency_ms = 0.0; // Sum of the time sent messages spent queued
+    double max_latency_ms = 0.0; // Largest time a sent message spent queued
+
+    /**
+     * \brief Returns the mean time sent messages spent queued in ms. 0 if none were sent
+     */
+    double mean_latency_ms() const;
+  };
+
+  /**
+   * \class V2XSchedulerWorker
+   * \brief Budgeted priority scheduler for outbound V2X messages
+   *
+   * Messages are grouped into classes by their message_type. Sending is limited by a token bucket which allows
+   * max_messages_per_second on average and up to burst_size back to back. When tokens are available the oldest queued
+   * message of the highest priority class is sent. Messages which exceed their class max_age_ms while queued are dropped,
+   * and classes marked coalesce only keep their newest queued message. If the queue exceeds max_queue_size the oldest
+   * message of the lowest priority class is dropped.
+   *
+   * The worker performs no ROS communication, so it can be driven directly with synthetic traffic.
+   */
+  class V2XSchedulerWorker
+  {
+  public:
+
+    /**
+     * \brief Constructor
+     *
+     * \param config The scheduler configuration
+     *
+     * \throw std::invalid_argument if the budget is not positive or a message type is configured more than once
+     */
+    explicit V2XSchedulerWorker(const Config& config);
+
+    /**
+     * \brief Queue a message for sending
+     *
+     * \param msg The encoded message
+     * \param now The current time
+     */
+    void enqueue(carma_driver_msgs::msg::ByteArray msg, const rclcpp::Time& now);
+
+    /**
+     * \brief Remove and return the messages which should be sent now, in the order they should be sent
+     *
+     * \param now The current time
+     *
+     * \return The messages to send. Empty if no messages are queued or the budget is exhausted.
+     */
+    std::vector<carma_driver_msgs::msg::ByteArray> dequeue_ready(const rclcpp::Time& now);
+
+    /**
+     * \brief Returns the statistics of each class. The last element is the default class
+     */
+    const std::vector<MessageClassStatistics>& get_statistics() const;
+
+    /**
+     * \brief Returns the number of messages currently queued
+     */
+    size_t get_queue_size() const;
+
+  private:
+
+    struct QueuedMessage
+    {
+      carma_driver_msgs::msg::ByteArray msg;
+      rclcpp::Time enqueue_time;
+    };
+
+    size_t class_index(const std::string& message_type) const;
+
+    void refill_tokens(const rclcpp::Time& now);
+
+    void drop_stale(const rclcpp::Time& now);
+
+    void enforce_queue_limit();
+
+    Config config_;
+
+    //! Configured classes followed by the default class
+    std::vector<MessageClassConfig> classes_;
+    std::unordered_map<std::string, size_t> class_lookup_;
+
+    //! One FIFO queue per class. Indexed the same as classes_
+    std::vector<std::deque<QueuedMessage>> queues_;
+    std::vector<MessageClassStatistics> statistics_;
+
+    //! Class indices ordered from highest to lowest priority
+    std::vector<size_t> priority_order_;
+
+    size_t queue_size_ = 0;
+    double tokens_ = 0.0;
+    rclcpp::Time last_refill_;
+    bool refill_initialized_ = false;
+  };
+
+} // v2x_scheduler
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#include "v2x_scheduler/v2x_scheduler_node.hpp"
+#include <lifecycle_msgs/msg/state.hpp>
+
+namespace v2x_scheduler
+{
+  namespace std_ph = std::placeholders;
+
+  V2XScheduler::V2XScheduler(const rclcpp::NodeOptions &options)
+      : carma_ros2_utils::CarmaLifecycleNode(options)
+  {
+    // Create initial config
+    config_ = Config();
+
+    // Declare parameters
+    config_.max_messages_per_second = declare_parameter<double>("max_messages_per_second", config_.max_messages_per_second);
+    config_.burst_size              = declare_parameter<int>("burst_size", config_.burst_size);
+    config_.max_queue_size          = declare_parameter<int>("max_queue_size", config_.max_queue_size);
+    config_.service_period_ms       = declare_parameter<int>("service_period_ms", config_.service_period_ms);
+    config_.statistics_period_ms    = declare_parameter<int>("statistics_period_ms", config_.statistics_period_ms);
+    config_.default_priority        = declare_parameter<int>("default_priority", config_.default_priority);
+    config_.default_max_age_ms      = declare_parameter<double>("default_max_age_ms", config_.default_max_age_ms);
+    declare_parameter<std::vector<std::string>>("message_classes", std::vector<std::string>({""}));
+  }
+
+  carma_ros2_utils::CallbackReturn V2XScheduler::handle_on_configure(const rclcpp_lifecycle::State &)
+  {
+    RCLCPP_INFO_STREAM(get_logger(), "V2XScheduler trying to configure");
+
+    // Reset config
+    config_ = Config();
+
+    // Load parameters
+    get_parameter<double>("max_messages_per_second", config_.max_messages_per_second);
+    get_parameter<int>("burst_size", config_.burst_size);
+    get_parameter<int>("max_queue_size", config_.max_queue_size);
+    get_parameter<int>("service_period_ms", config_.service_period_ms);
+    get_parameter<int>("statistics_period_ms", config_.statistics_period_ms);
+    get_parameter<int>("default_priority", config_.default_priority);
+    get_parameter<double>("default_max_age_ms", config_.default_max_age_ms);
+
+    std::vector<std::string> message_classes;
+    get_parameter<std::vector<std::string>>("message_classes", message_classes);
+
+    for (const auto& entry : message_classes)
+    {
+      if (entry.empty()) // Handle fact that parameter vectors cannot be empty
+        continue;
+
+      config_.message_classes.push_back(parse_message_class(entry));
+    }
+
+    RCLCPP_INFO_STREAM(get_logger(), "Loaded params: " << config_);
+
+    worker_ = std::make_shared<V2XSchedulerWorker>(config_);
+    last_reported_drops_.assign(worker_->get_statistics().size(), 0);
+
+    // Setup subscribers
+    unscheduled_sub_ = create_subscription<carma_driver_msgs::msg::ByteArray>("unscheduled_outbound_binary_msg", 100,
+                                                              std::bind(&V2XScheduler::unscheduled_callback, this, std_ph::_1));
+
+    // Setup publishers
+    outbound_pub_ = create_publisher<carma_driver_msgs::msg::ByteArray>("outbound_binary_msg", 100);
+    statistics_pub_ = create_publisher<diagnostic_msgs::msg::DiagnosticArray>("v2x_scheduler_statistics", 1);
+
+    // Return success if everything initialized successfully
+    return CallbackReturn::SUCCESS;
+  }
+
+  carma_ros2_utils::CallbackReturn V2XScheduler::handle_on_activate(const rclcpp_lifecycle::State &)
+  {
+    service_timer_ = create_timer(get_clock(), std::chrono::milliseconds(config_.service_period_ms),
+                                  std::bind(&V2XScheduler::service_queue, this));
+
+    statistics_timer_ = create_timer(get_clock(), std::chrono::milliseconds(config_.statistics_period_ms),
+                                     std::bind(&V2XScheduler::publish_statistics, this));
+
+    return CallbackReturn::SUCCESS;
+  }
+
+  void V2XScheduler::unscheduled_callback(carma_driver_msgs::msg::ByteArray::UniquePtr msg)
+  {
+    worker_->enqueue(std::move(*msg), this->now());
+
+    // Send immediately when the budget allows so time critical messages do not wait for the next timer
+    if (get_current_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+      service_queue();
+  }
+
+  void V2XScheduler::service_queue()
+  {
+    for (auto& msg : worker_->dequeue_ready(this->now()))
+    {
+      outbound_pub_->publish(msg);
+    }
+  }
+
+  void V2XScheduler::publish_statistics()
+  {
+    diagnostic_msgs::msg::DiagnosticArray array;
+    array.header.stamp = this->now();
+
+    const auto& statistics = worker_->get_statistics();
+
+    for (size_t i = 0; i < statistics.size(); ++i)
+    {
+      const auto& stats = statistics[i];
+
+      if (stats.received == 0)
+        continue;
+
+      size_t drops = stats.dropped_stale + stats.dropped_overflow;
+
+      diagnostic_msgs::msg::DiagnosticStatus status;
+      status.name = "v2x_scheduler: " + stats.name;
+      status.hardware_id = stats.name;
+
+      if (drops > last_reported_drops_[i])
+      {
+        status.level = diagnostic_msgs::msg::DiagnosticStatus::WARN;
+        status.message = "Dropped " + std::to_string(drops - last_reported_drops_[i]) + " messages since last report";
+        RCLCPP_WARN_STREAM(get_logger(), "Class: " << stats.name << " " << status.message);
+      }
+      else
+      {
+        status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+        status.message = "OK";
+      }
+
+      last_reported_drops_[i] = drops;
+
+      auto add_value = [&status](const std::string& key, const std::string& value)
+      {
+        diagnostic_msgs::msg::KeyValue kv;
+        kv.key = key;
+        kv.value = value;
+        status.values.push_back(kv);
+      };
+
+      add_value("received", std::to_string(stats.received));
+      add_value("sent", std::to_string(stats.sent));
+      add_value("coalesced", std::to_string(stats.coalesced));
+      add_value("dropped_stale", std::to_string(stats.dropped_stale));
+      add_value("dropped_overflow", std::to_string(stats.dropped_overflow));
+      add_value("mean_latency_ms", std::to_string(stats.mean_latency_ms()));
+      add_value("max_latency_ms", std::to_string(stats.max_latency_ms));
+
+      array.status.push_back(status);
+    }
+
+    statistics_pub_->publish(array);
+  }
+
+} // v2x_scheduler
+
+#include "rclcpp_components/register_node_macro.hpp"
+
+// Register the component with class_loader
+RCLCPP_COMPONENTS_REGISTER_NODE(v2x_scheduler::V2XScheduler)
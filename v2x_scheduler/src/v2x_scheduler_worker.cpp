@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include "v2x_scheduler/v2x_scheduler_worker.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <boost/algorithm/string.hpp>
+
+namespace v2x_scheduler
+{
+
+  MessageClassConfig parse_message_class(const std::string& entry)
+  {
+    std::vector<std::string> fields;
+    boost::split(fields, entry, boost::is_any_of(","));
+
+    if (fields.size() != 4)
+    {
+      throw std::invalid_argument("Message class entry: '" + entry + "' must have the form '<message_type>, <priority>, <max_age_ms>, <coalesce>'");
+    }
+
+    for (auto& field : fields)
+    {
+      boost::trim(field);
+    }
+
+    if (fields[0].empty())
+    {
+      throw std::invalid_argument("Message class entry: '" + entry + "' is missing a message type");
+    }
+
+    MessageClassConfig message_class;
+    message_class.message_type = fields[0];
+
+    try
+    {
+      message_class.priority = std::stoi(fields[1]);
+      message_class.max_age_ms = std::stod(fields[2]);
+    }
+    catch (const std::logic_error&)
+    {
+      throw std::invalid_argument("Message class entry: '" + entry + "' has a non numeric priority or max age");
+    }
+
+    if (fields[3] == "true")
+    {
+      message_class.coalesce = true;
+    }
+    else if (fields[3] == "false")
+    {
+      message_class.coalesce = false;
+    }
+    else
+    {
+      throw std::invalid_argument("Message class entry: '" + entry + "' must set coalesce to true or false");
+    }
+
+    return message_class;
+  }
+
+  double MessageClassStatistics::mean_latency_ms() const
+  {
+    if (sent == 0)
+      return 0.0;
+
+    return total_latency_ms / sent;
+  }
+
+  V2XSchedulerWorker::V2XSchedulerWorker(const Config& config)
+    : config_(config)
+  {
+    if (config_.max_messages_per_second <= 0.0 || config_.burst_size < 1)
+    {
+      throw std::invalid_argument("V2XSchedulerWorker requires a positive max_messages_per_second and burst_size");
+    }
+
+    classes_ = config_.message_classes;
+
+    for (size_t i = 0; i < classes_.size(); ++i)
+    {
+      if (!class_lookup_.emplace(classes_[i].message_type, i).second)
+      {
+        throw std::invalid_argument("Message type: " + classes_[i].message_type + " is configured in more than one message class");
+      }
+    }
+
+    MessageClassConfig default_class;
+    default_class.message_type = "default";
+    default_class.priority = config_.default_priority;
+    default_class.max_age_ms = config_.default_max_age_ms;
+    default_class.coalesce = false;
+    classes_.push_back(default_class);
+
+    queues_.resize(classes_.size());
+    statistics_.resize(classes_.size());
+
+    for (size_t i = 0; i < classes_.size(); ++i)
+    {
+      statistics_[i].name = classes_[i].message_type;
+    }
+
+    priority_order_.resize(classes_.size());
+    std::iota(priority_order_.begin(), priority_order_.end(), 0);
+    std::stable_sort(priority_order_.begin(), priority_order_.end(),
+                     [this](size_t a, size_t b) { return classes_[a].priority > classes_[b].priority; });
+  }
+
+  size_t V2XSchedulerWorker::class_index(const std::string& message_type) const
+  {
+    auto it = class_lookup_.find(message_type);
+
+    if (it == class_lookup_.end())
+      return classes_.size() - 1; // Default class
+
+    return it->second;
+  }
+
+  void V2XSchedulerWorker::enqueue(carma_driver_msgs::msg::ByteArray msg, const rclcpp::Time& now)
+  {
+    size_t index = class_index(msg.message_type);
+    auto& queue = queues_[index];
+    auto& stats = statistics_[index];
+
+    stats.received++;
+
+    if (classes_[index].coalesce && !queue.empty())
+    {
+      // The new message supersedes everything of this class which has not been sent yet
+      stats.coalesced += queue.size();
+      queue_size_ -= queue.size();
+      queue.clear();
+    }
+
+    queue.push_back({std::move(msg), now});
+    queue_size_++;
+
+    enforce_queue_limit();
+  }
+
+  std::vector<carma_driver_msgs::msg::ByteArray> V2XSchedulerWorker::dequeue_ready(const rclcpp::Time& now)
+  {
+    std::vector<carma_driver_msgs::msg::ByteArray> ready;
+
+    refill_tokens(now);
+    drop_stale(now);
+
+    while (tokens_ >= 1.0 && queue_size_ > 0)
+    {
+      // Pick the highest priority class with queued messages. Between classes of equal priority the oldest message wins.
+      size_t best = std::numeric_limits<size_t>::max();
+      for (auto index : priority_order_)
+      {
+        if (queues_[index].empty())
+          continue;
+
+        if (best == std::numeric_limits<size_t>::max())
+        {
+          best = index;
+          continue;
+        }
+
+        if (classes_[index].priority < classes_[best].priority)
+          break;
+
+        if (queues_[index].front().enqueue_time < queues_[best].front().enqueue_time)
+          best = index;
+      }
+
+      auto& queued = queues_[best].front();
+      auto& stats = statistics_[best];
+
+      double latency_ms = (now - queued.enqueue_time).seconds() * 1000.0;
+      stats.sent++;
+      stats.total_latency_ms += latency_ms;
+      stats.max_latency_ms = std::max(stats.max_latency_ms, latency_ms);
+
+      ready.emplace_back(std::move(queued.msg));
+      queues_[best].pop_front();
+      queue_size_--;
+      tokens_ -= 1.0;
+    }
+
+    return ready;
+  }
+
+  const std::vector<MessageClassStatistics>& V2XSchedulerWorker::get_statistics() const
+  {
+    return statistics_;
+  }
+
+  size_t V2XSchedulerWorker::get_queue_size() const
+  {
+    return queue_size_;
+  }
+
+  void V2XSchedulerWorker::refill_tokens(const rclcpp::Time& now)
+  {
+    if (!refill_initialized_)
+    {
+      tokens_ = config_.burst_size;
+      last_refill_ = now;
+      refill_initialized_ = true;
+      return;
+    }
+
+    double elapsed = (now - last_refill_).seconds();
+    if (elapsed <= 0.0)
+      return;
+
+    tokens_ = std::min(static_cast<double>(config_.burst_size), tokens_ + elapsed * config_.max_messages_per_second);
+    last_refill_ = now;
+  }
+
+  void V2XSchedulerWorker::drop_stale(const rclcpp::Time& now)
+  {
+    for (size_t i = 0; i < queues_.size(); ++i)
+    {
+      if (classes_[i].max_age_ms <= 0.0)
+        continue;
+
+      // Queues are in arrival order so the stale messages are at the front
+      auto& queue = queues_[i];
+      while (!queue.empty() && (now - queue.front().enqueue_time).seconds() * 1000.0 > classes_[i].max_age_ms)
+      {
+        queue.pop_front();
+        queue_size_--;
+        statistics_[i].dropped_stale++;
+      }
+    }
+  }
+
+  void V2XSchedulerWorker::enforce_queue_limit()
+  {
+    while (queue_size_ > static_cast<size_t>(std::max(config_.max_queue_size, 0)))
+    {
+      for (auto it = priority_order_.rbegin(); it != priority_order_.rend(); ++it)
+      {
+        if (queues_[*it].empty())
+          continue;
+
+        queues_[*it].pop_front();
+        queue_size_--;
+        statistics_[*it].dropped_overflow++;
+        break;
+      }
+    }
+  }
+
+} // v2x_scheduler
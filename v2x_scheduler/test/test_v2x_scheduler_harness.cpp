@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include "v2x_scheduler/v2x_scheduler_worker.hpp"
+
+/**
+ * Harness which drives the scheduler with synthetic producers in simulated time.
+ * No ROS communication is used so the traffic mix and budget can be varied freely to study the scheduler behavior.
+ */
+
+namespace v2x_scheduler
+{
+    /**
+     * \brief A periodic source of outbound messages
+     */
+    struct SyntheticProducer
+    {
+        std::string message_type;
+        int period_ms; // Time between batches
+        int offset_ms; // Time of the first batch
+        int batch_size; // Messages published together in each batch
+    };
+
+    struct HarnessResult
+    {
+        std::vector<MessageClassStatistics> statistics;
+        size_t total_sent = 0;
+        size_t max_sent_in_one_second = 0;
+    };
+
+    /**
+     * \brief Run the scheduler against the producers for the provided duration with 1 ms resolution.
+     *        Mirrors the node which services the queue on every received message and every service_period_ms.
+     */
+    HarnessResult run_harness(const Config& config, const std::vector<SyntheticProducer>& producers, int duration_ms)
+    {
+        V2XSchedulerWorker worker(config);
+        HarnessResult result;
+
+        rclcpp::Time start(100, 0, RCL_ROS_TIME);
+        std::vector<size_t> sent_per_second(duration_ms / 1000 + 1, 0);
+
+        auto service = [&](const rclcpp::Time& now, int t)
+        {
+            size_t sent = worker.dequeue_ready(now).size();
+            result.total_sent += sent;
+            sent_per_second[t / 1000] += sent;
+        };
+
+        for (int t = 0; t < duration_ms; t++)
+        {
+            rclcpp::Time now = start + rclcpp::Duration::from_nanoseconds(static_cast<int64_t>(t) * 1000000);
+
+            for (const auto& producer : producers)
+            {
+                if (t < producer.offset_ms || (t - producer.offset_ms) % producer.period_ms != 0)
+                    continue;
+
+                for (int i = 0; i < producer.batch_size; i++)
+                {
+                    carma_driver_msgs::msg::ByteArray msg;
+                    msg.message_type = producer.message_type;
+                    msg.content.resize(200);
+                    worker.enqueue(std::move(msg), now);
+                    service(now, t);
+                }
+            }
+
+            if (t % config.service_period_ms == 0)
+                service(now, t);
+        }
+
+        result.statistics = worker.get_statistics();
+        result.max_sent_in_one_second = *std::max_element(sent_per_second.begin(), sent_per_second.end());
+
+        return result;
+    }
+
+    void print_statistics(const HarnessResult& result)
+    {
+        std::cout << std::left << std::setw(26) << "class" << std::setw(10) << "received" << std::setw(8) << "sent"
+                  << std::setw(11) << "coalesced" << std::setw(8) << "stale" << std::setw(10) << "overflow"
+                  << std::setw(10) << "mean_ms" << "max_ms" << std::endl;
+
+        for (const auto& stats : result.statistics)
+        {
+            std::cout << std::left << std::setw(26) << stats.name << std::setw(10) << stats.received << std::setw(8) << stats.sent
+                      << std::setw(11) << stats.coalesced << std::setw(8) << stats.dropped_stale << std::setw(10) << stats.dropped_overflow
+                      << std::setw(10) << stats.mean_latency_ms() << stats.max_latency_ms << std::endl;
+        }
+    }
+
+    const MessageClassStatistics& find_stats(const HarnessResult& result, const std::string& name)
+    {
+        for (const auto& stats : result.statistics)
+        {
+            if (stats.name == name)
+                return stats;
+        }
+
+        throw std::invalid_argument("No statistics for class: " + name);
+    }
+
+    Config harness_config()
+    {
+        Config config;
+        config.max_messages_per_second = 50.0;
+        config.burst_size = 10;
+        config.max_queue_size = 100;
+        config.service_period_ms = 10;
+        config.message_classes = {
+            parse_message_class("MobilityRequest, 3, 1000.0, false"),
+            parse_message_class("MobilityResponse, 3, 1000.0, false"),
+            parse_message_class("MobilityOperation, 2, 500.0, false"),
+            parse_message_class("BSM, 1, 100.0, true"),
+            parse_message_class("MobilityPath, 1, 200.0, true"),
+            parse_message_class("SDSM, 0, 200.0, true")
+        };
+        return config;
+    }
+
+    TEST(V2XSchedulerHarness, dense_deployment)
+    {
+        // Offered load of roughly 76 messages per second against a budget of 50
+        std::vector<SyntheticProducer> producers = {
+            {"BSM", 100, 0, 1},
+            {"MobilityPath", 100, 3, 1},
+            {"SDSM", 100, 7, 1},
+            {"MobilityOperation", 100, 11, 1},
+            {"MobilityOperation", 100, 37, 1},
+            {"MobilityOperation", 100, 59, 1},
+            {"MobilityOperation", 100, 83, 1},
+            {"MobilityRequest", 1000, 500, 3},
+            {"MobilityResponse", 333, 250, 1}
+        };
+
+        auto config = harness_config();
+        auto result = run_harness(config, producers, 20000);
+        print_statistics(result);
+
+        // The budget is respected
+        EXPECT_LE(result.total_sent, static_cast<size_t>(config.max_messages_per_second * 20 + config.burst_size));
+        EXPECT_LE(result.max_sent_in_one_second, static_cast<size_t>(config.max_messages_per_second + config.burst_size));
+
+        // The budget is used when there is more traffic than budget
+        EXPECT_GE(result.total_sent, static_cast<size_t>(0.95 * config.max_messages_per_second * 20));
+
+        // Time critical messages are never dropped and wait at most a few token intervals
+        for (const auto& name : {"MobilityRequest", "MobilityResponse"})
+        {
+            const auto& stats = find_stats(result, name);
+            EXPECT_EQ(stats.received, stats.sent) << name;
+            EXPECT_LT(stats.max_latency_ms, 100.0) << name;
+        }
+
+        // Periodic messages absorb the overload
+        const auto& bsm = find_stats(result, "BSM");
+        const auto& sdsm = find_stats(result, "SDSM");
+        EXPECT_GT(bsm.coalesced + bsm.dropped_stale, 0u);
+        EXPECT_LT(sdsm.sent, bsm.sent + 1);
+        EXPECT_LE(bsm.max_latency_ms, 100.0);
+    }
+
+    TEST(V2XSchedulerHarness, light_load_passes_through)
+    {
+        std::vector<SyntheticProducer> producers = {
+            {"BSM", 100, 0, 1},
+            {"MobilityPath", 100, 3, 1},
+            {"MobilityRequest", 1000, 500, 3}
+        };
+
+        auto config = harness_config();
+        auto result = run_harness(config, producers, 10000);
+        print_statistics(result);
+
+        for (const auto& stats : result.statistics)
+        {
+            EXPECT_EQ(stats.received, stats.sent) << stats.name;
+            EXPECT_NEAR(0.0, stats.max_latency_ms, 0.001) << stats.name;
+        }
+    }
+
+} // v2x_scheduler
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 LEIDOS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <gtest/gtest.h>
+#include "v2x_scheduler/v2x_scheduler_worker.hpp"
+
+namespace v2x_scheduler
+{
+    carma_driver_msgs::msg::ByteArray make_msg(const std::string& type, uint8_t id = 0)
+    {
+        carma_driver_msgs::msg::ByteArray msg;
+        msg.message_type = type;
+        msg.content.push_back(id);
+        return msg;
+    }
+
+    Config make_config()
+    {
+        Config config;
+        config.max_messages_per_second = 10.0;
+        config.burst_size = 2;
+        config.max_queue_size = 5;
+        config.default_priority = 0;
+        config.default_max_age_ms = 0.0;
+        config.message_classes.push_back(parse_message_class("MobilityRequest, 3, 0, false"));
+        config.message_classes.push_back(parse_message_class("BSM, 1, 150, true"));
+        return config;
+    }
+
+    TEST(V2XSchedulerWorkerTest, parse_message_class)
+    {
+        auto mc = parse_message_class(" MobilityRequest, 3, 1000.0, false ");
+        EXPECT_EQ("MobilityRequest", mc.message_type);
+        EXPECT_EQ(3, mc.priority);
+        EXPECT_NEAR(1000.0, mc.max_age_ms, 0.0001);
+        EXPECT_FALSE(mc.coalesce);
+
+        EXPECT_TRUE(parse_message_class("BSM, 1, 100, true").coalesce);
+
+        EXPECT_THROW(parse_message_class("BSM, 1, 100"), std::invalid_argument);
+        EXPECT_THROW(parse_message_class("BSM, high, 100, true"), std::invalid_argument);
+        EXPECT_THROW(parse_message_class("BSM, 1, 100, yes"), std::invalid_argument);
+
+        Config config = make_config();
+        config.message_classes.push_back(parse_message_class("BSM, 2, 100, false"));
+        EXPECT_THROW(V2XSchedulerWorker worker(config), std::invalid_argument);
+
+        config = make_config();
+        config.max_messages_per_second = 0.0;
+        EXPECT_THROW(V2XSchedulerWorker worker(config), std::invalid_argument);
+    }
+
+    TEST(V2XSchedulerWorkerTest, budget_and_priority)
+    {
+        V2XSchedulerWorker worker(make_config());
+        rclcpp::Time now(1, 0, RCL_ROS_TIME);
+
+        worker.enqueue(make_msg("Unknown", 1), now);
+        worker.enqueue(make_msg("Unknown", 2), now);
+        worker.enqueue(make_msg("MobilityRequest", 3), now);
+
+        // Burst of 2 allows two messages. The request goes first
+        auto ready = worker.dequeue_ready(now);
+        ASSERT_EQ(2u, ready.size());
+        EXPECT_EQ("MobilityRequest", ready[0].message_type);
+        EXPECT_EQ(1, ready[1].content[0]);
+        EXPECT_EQ(1u, worker.get_queue_size());
+
+        // No budget left
+        EXPECT_TRUE(worker.dequeue_ready(now).empty());
+
+        // 10 messages per second refills one token every 100 ms
+        now = now + rclcpp::Duration::from_seconds(0.1);
+        ready = worker.dequeue_ready(now);
+        ASSERT_EQ(1u, ready.size());
+        EXPECT_EQ(2, ready[0].content[0]);
+
+        const auto& stats = worker.get_statistics();
+        ASSERT_EQ(3u, stats.size());
+        EXPECT_EQ("default", stats.back().name);
+        EXPECT_EQ(2u, stats.back().sent);
+        EXPECT_NEAR(50.0, stats.back().mean_latency_ms(), 0.001);
+        EXPECT_NEAR(100.0, stats.back().max_latency_ms, 0.001);
+        EXPECT_EQ(1u, stats[0].sent);
+    }
+
+    TEST(V2XSchedulerWorkerTest, coalesce_and_stale)
+    {
+        V2XSchedulerWorker worker(make_config());
+        rclcpp::Time now(1, 0, RCL_ROS_TIME);
+
+        // Use up the budget
+        worker.enqueue(make_msg("MobilityRequest"), now);
+        worker.enqueue(make_msg("MobilityRequest"), now);
+        EXPECT_EQ(2u, worker.dequeue_ready(now).size());
+
+        // Only the newest BSM is kept
+        worker.enqueue(make_msg("BSM", 1), now);
+        worker.enqueue(make_msg("BSM", 2), now);
+        EXPECT_EQ(1u, worker.get_queue_size());
+        EXPECT_EQ(1u, worker.get_statistics()[1].coalesced);
+
+        now = now + rclcpp::Duration::from_seconds(0.1);
+        auto ready = worker.dequeue_ready(now);
+        ASSERT_EQ(1u, ready.size());
+        EXPECT_EQ(2, ready[0].content[0]);
+
+        // A BSM which waits longer than 150 ms is dropped
+        worker.enqueue(make_msg("MobilityRequest"), now);
+        worker.enqueue(make_msg("BSM", 3), now);
+        now = now + rclcpp::Duration::from_seconds(0.1);
+        ready = worker.dequeue_ready(now);
+        ASSERT_EQ(1u, ready.size());
+        EXPECT_EQ("MobilityRequest", ready[0].message_type);
+
+        now = now + rclcpp::Duration::from_seconds(0.1);
+        EXPECT_TRUE(worker.dequeue_ready(now).empty());
+        EXPECT_EQ(1u, worker.get_statistics()[1].dropped_stale);
+        EXPECT_EQ(0u, worker.get_queue_size());
+    }
+
+    TEST(V2XSchedulerWorkerTest, overflow_drops_lowest_priority)
+    {
+        V2XSchedulerWorker worker(make_config());
+        rclcpp::Time now(1, 0, RCL_ROS_TIME);
+
+        for (uint8_t i = 0; i < 3; i++)
+        {
+            worker.enqueue(make_msg("Unknown", i), now);
+        }
+
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            worker.enqueue(make_msg("MobilityRequest", i), now);
+        }
+
+        // Queue limit is 5 so the two oldest unknown messages are dropped
+        EXPECT_EQ(5u, worker.get_queue_size());
+        EXPECT_EQ(2u, worker.get_statistics().back().dropped_overflow);
+        EXPECT_EQ(0u, worker.get_statistics()[0].dropped_overflow);
+
+        // Once the lower priority class is empty the higher priority class is dropped from
+        worker.enqueue(make_msg("MobilityRequest", 4), now);
+        worker.enqueue(make_msg("MobilityRequest", 5), now);
+        EXPECT_EQ(3u, worker.get_statistics().back().dropped_overflow);
+        EXPECT_EQ(1u, worker.get_statistics()[0].dropped_overflow);
+    }
+
+} // v2x_scheduler
@@ -35,6 +35,7 @@
 #include <carma_v2x_msgs/msg/trajectory.hpp>
 #include <carma_v2x_msgs/msg/plan_type.hpp>
 #include <basic_autonomy/smoothing/filters.hpp>
+#include <basic_autonomy/basic_autonomy.hpp>
 
 using oss = std::ostringstream;
 constexpr auto EPSILON {0.01}; //small value to compare doubles
@@ -449,9 +450,42 @@ namespace yield_plugin
 
     // Replace the original trajectory's associated timestamps based on the newly calculated speeds
     double prev_speed = filtered_speeds.at(0);
+    bool stopped = false;
+    const auto original_hold = basic_autonomy::waypoint_generation::get_terminal_hold(original_tp.trajectory_points);
     for(size_t i = 1; i < original_tp.trajectory_points.size(); i++)
     {
       carma_planning_msgs::msg::TrajectoryPlanPoint jmt_tpp = original_tp.trajectory_points.at(i);
+      const rclcpp::Duration original_dt = rclcpp::Time(original_tp.trajectory_points.at(i).target_time)
+        - rclcpp::Time(original_tp.trajectory_points.at(i - 1).target_time);
+
+      if (!stopped && prev_speed < EPSILON) // The vehicle has stopped at the previous point
+      {
+        // Hold at the stop point. The hold lasts as long as the original trajectory so the plan always extends past the original horizon.
+        const double stop_time = rclcpp::Time(jmt_trajectory_points.back().target_time).seconds();
+        const double hold_duration = get_trajectory_duration(original_tp);
+        RCLCPP_DEBUG_STREAM(nh_->get_logger(), "Holding at stop point x: " << jmt_trajectory_points.back().x << ", y: " << jmt_trajectory_points.back().y
+          << ", t: " << std::to_string(stop_time) << ", hold duration: " << hold_duration);
+        basic_autonomy::waypoint_generation::append_terminal_hold(jmt_trajectory_points, hold_duration, jmt_trajectory_points.back().planner_plugin_name);
+        stopped = true;
+      }
+
+      if (stopped)
+      {
+        // The rest of the original geometry is kept after the hold so the controller can still steer toward the direction of travel.
+        // These points are not driven, so they keep the original time spacing.
+        jmt_tpp.target_time = rclcpp::Time(jmt_trajectory_points.back().target_time) + original_dt;
+        jmt_trajectory_points.push_back(jmt_tpp);
+        continue;
+      }
+
+      if (original_hold && i == original_hold->stop_index + 1)
+      {
+        // The hold point of the original trajectory has no length, so it is retimed by its hold duration rather than by speed
+        jmt_tpp.target_time = rclcpp::Time(jmt_trajectory_points.back().target_time) + rclcpp::Duration::from_seconds(original_hold->duration);
+        jmt_trajectory_points.push_back(jmt_tpp);
+        stopped = true;
+        continue;
+      }
 
       // In case only subset of original trajectory needs modification,
       // the rest of the points should keep the last speed to cruise
@@ -473,24 +507,9 @@ namespace yield_plugin
       const double dt = (2 * original_traj_relative_downtracks.at(i)) / (current_speed + prev_speed);
       jmt_tpp.target_time =  rclcpp::Time(jmt_trajectory_points.back().target_time) + rclcpp::Duration(dt*1e9);
 
-      if (prev_speed < EPSILON) // Handle a special case if prev_speed (thus current_speed too) is 0
-      {
-        // NOTE: Assigning arbitrary 100 mins dt between points where normally dt is only 1 sec to model a stopping behavior.
-        // Another way to model it is to keep the trajectory point at a same location and increment time slightly. However,
-        // if the vehicle goes past the point, it may cruise toward undesirable location (for example into the intersection).
-        // Keeping the points help the controller steer the vehicle toward direction of travel even when stopping.
-        // Only downside is the trajectory plan is huge where only 15 sec is expected, but since this is stopping case, it shouldn't matter.
-        jmt_tpp.target_time = rclcpp::Time(jmt_trajectory_points.back().target_time) + rclcpp::Duration(6000 * 1e9);
-        RCLCPP_DEBUG_STREAM(nh_->get_logger(), "Zero speed = x: " << jmt_tpp.x << ", y:" << jmt_tpp.y
-          << ", t:" << std::to_string(rclcpp::Time(jmt_tpp.target_time).seconds())
-          << ", prev_speed: " << prev_speed << ", current_speed: " << current_speed);
-      }
-      else
-      {
-        RCLCPP_DEBUG_STREAM(nh_->get_logger(), "Non-zero speed = x: " << jmt_tpp.x << ", y:" << jmt_tpp.y
-          << ", t:" << std::to_string(rclcpp::Time(jmt_tpp.target_time).seconds())
-          << ", prev_speed: " << prev_speed << ", current_speed: " << current_speed);
-      }
+      RCLCPP_DEBUG_STREAM(nh_->get_logger(), "Speed = x: " << jmt_tpp.x << ", y:" << jmt_tpp.y
+        << ", t:" << std::to_string(rclcpp::Time(jmt_tpp.target_time).seconds())
+        << ", prev_speed: " << prev_speed << ", current_speed: " << current_speed);
 
       jmt_trajectory_points.push_back(jmt_tpp);
       prev_speed = current_speed;
@@ -528,7 +547,7 @@ namespace yield_plugin
       {
         RCLCPP_DEBUG_STREAM(nh_->get_logger(), "Checking llt: " << llt.id());
 
-        if (route_llt_ids_.find(llt.id()) != route_llt_ids_.end())
+        if (wm_->isOnRoute(llt.id()))
         {
           on_route = true;
           on_route_idx = j;
@@ -660,12 +679,6 @@ namespace yield_plugin
       return std::nullopt;
     }
 
-    // save route Ids for faster access
-    for (const auto& llt: wm_->getRoute()->shortestPath())
-    {
-      route_llt_ids_.insert(llt.id());
-    }
-
     RCLCPP_DEBUG_STREAM(nh_->get_logger(),"External Object List (external_objects) size: " << external_objects.size());
 
     std::map<std::uint32_t, rclcpp::Time> collision_times;
@@ -33,6 +33,7 @@
 #include <lanelet2_extension/projection/local_frame_projector.h>
 #include <lanelet2_extension/io/autoware_osm_parser.h>
 #include <carma_wm/MapConformer.hpp>
+#include <basic_autonomy/basic_autonomy.hpp>
 #include <unsupported/Eigen/Splines>
 #include <tf2/LinearMath/Vector3.h>
 #include <carma_ros2_utils/carma_lifecycle_node.hpp>
@@ -786,6 +787,37 @@ TEST(YieldPluginTest, jmt_traj)
   EXPECT_EQ(jmt_traj.trajectory_points.size(), original_tp.trajectory_points.size());
   EXPECT_LE(rclcpp::Time(jmt_traj.trajectory_points[2].target_time), rclcpp::Time(original_tp.trajectory_points[2].target_time));
 
+  // When the vehicle stops, the trajectory holds at the stop point and keeps the original geometry after the hold
+  goal_pos = 15.0;
+  goal_velocity = 0.0;
+  tp = 3;
+
+  carma_planning_msgs::msg::TrajectoryPlan stop_traj = plugin.generate_JMT_trajectory(original_tp, initial_pos, goal_pos, initial_velocity, goal_velocity, tp, 10.0);
+
+  auto hold = basic_autonomy::waypoint_generation::get_terminal_hold(stop_traj.trajectory_points);
+  ASSERT_TRUE(!!hold);
+  EXPECT_NEAR(6.0, hold->duration, 0.001);
+  EXPECT_NEAR(stop_traj.trajectory_points[hold->stop_index].x, stop_traj.trajectory_points[hold->stop_index + 1].x, 0.001);
+
+  ASSERT_EQ(original_tp.trajectory_points.size() + 1, stop_traj.trajectory_points.size());
+  EXPECT_NEAR(original_tp.trajectory_points.back().x, stop_traj.trajectory_points.back().x, 0.001);
+
+  // Target times stay strictly increasing so collision checks never divide by a zero time step
+  for (size_t i = 1; i < stop_traj.trajectory_points.size(); i++)
+  {
+    EXPECT_LT(rclcpp::Time(stop_traj.trajectory_points[i - 1].target_time), rclcpp::Time(stop_traj.trajectory_points[i].target_time));
+  }
+
+  // A hold already in the original trajectory is kept with its duration
+  carma_planning_msgs::msg::TrajectoryPlan held_tp = original_tp;
+  basic_autonomy::waypoint_generation::append_terminal_hold(held_tp.trajectory_points, 4.0, "stop_and_wait_plugin");
+
+  carma_planning_msgs::msg::TrajectoryPlan held_traj = plugin.generate_JMT_trajectory(held_tp, initial_pos, 35.0, initial_velocity, 5.0, 5, 10.0);
+
+  hold = basic_autonomy::waypoint_generation::get_terminal_hold(held_traj.trajectory_points);
+  ASSERT_TRUE(!!hold);
+  EXPECT_EQ(held_tp.trajectory_points.size() - 2, hold->stop_index);
+  EXPECT_NEAR(4.0, hold->duration, 0.001);
 }
 
 TEST(YieldPluginTest, min_digital_gap)